@@ -0,0 +1,124 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(__NORI_ASSETCACHE_H)
+#define __NORI_ASSETCACHE_H
+
+#include <nori/common.h>
+#include <tbb/task_arena.h>
+#include <future>
+#include <map>
+#include <mutex>
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * \brief Process-wide cache of immutable assets
+ *
+ * Maps a key (usually the resolved file name combined with all load
+ * parameters that affect the result, see \ref makeAssetKey()) to a
+ * reference-counted asset. The cache only holds weak references, so an
+ * asset is released as soon as the last object using it is destroyed.
+ *
+ * When several threads request the same key at once, the first one runs
+ * the loader while the others wait for its result; a failed load is
+ * reported to all of them and not cached. The loader runs in an isolated
+ * TBB region, since a thread that steals an unrelated task while waiting
+ * for the loader's internal parallel loops could otherwise end up
+ * waiting for its own load.
+ */
+template <typename T> class AssetCache {
+public:
+    typedef std::shared_ptr<const T> Pointer;
+
+    /**
+     * \brief Return the asset with the given key, loading it if necessary
+     *
+     * \param loader
+     *    Function object returning a \c std::shared_ptr to a new asset
+     * \param loaded
+     *    Optional; set to \c true if this call ran the loader
+     */
+    template <typename Loader>
+    Pointer get(const std::string &key, const Loader &loader, bool *loaded = nullptr) {
+        std::shared_future<Pointer> future;
+        std::promise<Pointer> promise;
+        bool owner = false;
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            auto it = m_assets.find(key);
+            if (it != m_assets.end()) {
+                if (Pointer asset = it->second.lock()) {
+                    if (loaded)
+                        *loaded = false;
+                    return asset;
+                }
+                m_assets.erase(it);
+            }
+            auto pending = m_pending.find(key);
+            if (pending != m_pending.end()) {
+                future = pending->second;
+            } else {
+                future = promise.get_future().share();
+                m_pending[key] = future;
+                owner = true;
+            }
+        }
+
+        if (loaded)
+            *loaded = owner;
+        if (!owner)
+            return future.get();
+
+        Pointer asset;
+        try {
+            tbb::this_task_arena::isolate([&] { asset = loader(); });
+        } catch (...) {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_pending.erase(key);
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_pending.erase(key);
+        m_assets[key] = asset;
+        promise.set_value(asset);
+        return asset;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::map<std::string, std::weak_ptr<const T>> m_assets;
+    std::map<std::string, std::shared_future<Pointer>> m_pending;
+};
+
+/**
+ * \brief Build a cache key from a prefix identifying the loader, a
+ * resolved file name and a block of plain data holding load parameters
+ */
+inline std::string makeAssetKey(const std::string &prefix, const std::string &filename,
+                                const void *params = nullptr, size_t size = 0) {
+    std::string key = prefix + "|" + filename + "|";
+    key.append((const char *) params, size);
+    return key;
+}
+
+NORI_NAMESPACE_END
+
+#endif /* __NORI_ASSETCACHE_H */
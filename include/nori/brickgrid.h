@@ -0,0 +1,179 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(__NORI_BRICKGRID_H)
+#define __NORI_BRICKGRID_H
+
+#include <nori/bbox.h>
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * \brief Header of a Mitsuba grid volume file (".vol")
+ *
+ * The header is followed by <tt>xres * yres * zres * channels</tt>
+ * 32-bit floats, with x varying fastest and the channels of a voxel
+ * stored next to each other. All values are little endian.
+ */
+struct VolHeader {
+    char    magic[3];        ///< "VOL"
+    uint8_t version;         ///< Format version (3)
+    int32_t encoding;        ///< Value encoding (1 = float32)
+    int32_t xres, yres, zres;
+    int32_t channels;
+    float   bbox[6];         ///< Bounding box (min, max)
+};
+
+static_assert(sizeof(VolHeader) == 48, "Unexpected padding in VolHeader");
+
+/**
+ * \brief Validate the header of a ".vol" file held in memory
+ *
+ * Meant for memory-mapped files (see \ref MemoryMappedFile): the voxels
+ * are used in place, so only the pages that are accessed get loaded.
+ *
+ * \return
+ *     Pointer to the voxels, which directly follow the 48-byte header
+ *     and are therefore 4-byte aligned (float32 encoding only)
+ */
+extern const float *getVolData(const char *data, size_t size, const std::string &filename, VolHeader &header);
+
+/**
+ * \brief Header of a sparse brick volume file (".bvol")
+ *
+ * The header is followed by the brick table, one 32-bit entry per brick
+ * in x-fastest order (\ref BrickGrid::EmptyBrick for empty bricks), and
+ * by the voxels of the \c brickCount stored bricks. All values are
+ * little endian. Files are written by the \c vol2brick tool.
+ */
+struct BrickVolumeHeader {
+    char     magic[4];       ///< "BVOL"
+    uint32_t version;        ///< Format version (currently 1)
+    int32_t  res[3];         ///< Voxel resolution
+    int32_t  channels;       ///< Values per voxel
+    float    bbox[6];        ///< Bounding box (min, max)
+    uint32_t brickSize;      ///< Voxels along each side of a brick
+    uint32_t brickCount;     ///< Number of stored bricks
+};
+
+static_assert(sizeof(BrickVolumeHeader) == 56, "Unexpected padding in BrickVolumeHeader");
+
+/**
+ * \brief Sparse voxel grid made of fixed-size bricks
+ *
+ * The grid is split into bricks of 8x8x8 voxels that are referenced by
+ * a top-level table. Bricks whose voxels are all zero are not stored at
+ * all, so the empty space of e.g. smoke simulations costs only one table
+ * entry per brick. Within a brick, the voxels are stored with x varying
+ * fastest and interleaved channels.
+ */
+class BrickGrid {
+public:
+    static constexpr int BrickLog2 = 3;
+    static constexpr int BrickSize = 1 << BrickLog2;
+    static constexpr int BrickMask = BrickSize - 1;
+    static constexpr int BrickVoxels = BrickSize * BrickSize * BrickSize;
+    /// Table entry of bricks that are not stored
+    static constexpr uint32_t EmptyBrick = 0xFFFFFFFFu;
+
+    /**
+     * \brief Build the grid from dense voxel data
+     *
+     * \param data
+     *     Voxels in the layout of a ".vol" file
+     * \param threshold
+     *     Values whose magnitude does not exceed the threshold are
+     *     treated as zero when deciding whether a brick is empty. Only
+     *     the dropped bricks lose their values, stored bricks are exact.
+     */
+    void build(const float *data, int xres, int yres, int zres, int channels, float threshold = 0.f);
+
+    /// Load the grid from a ".bvol" file and return its bounding box
+    BoundingBox3f load(const std::string &filename);
+
+    /// Write the grid to a ".bvol" file
+    void save(const std::string &filename, const BoundingBox3f &bbox) const;
+
+    /// Return the voxel resolution along the given axis
+    int getResolution(int axis) const { return m_res[axis]; }
+
+    /// Return the number of values per voxel
+    int getChannels() const { return m_channels; }
+
+    /// Return the number of stored bricks
+    size_t getBrickCount() const { return m_data.size() / ((size_t) BrickVoxels * m_channels); }
+
+    /// Return the number of bricks covering the grid
+    size_t getTableSize() const { return m_table.size(); }
+
+    /// Return the memory used by the table and the bricks in bytes
+    size_t getMemoryUsage() const {
+        return m_table.size() * sizeof(uint32_t) + m_data.size() * sizeof(float);
+    }
+
+    /// Return the value of a voxel inside the grid
+    float getValue(int x, int y, int z, int channel) const {
+        uint32_t brick = m_table[tableIndex(x >> BrickLog2, y >> BrickLog2, z >> BrickLog2)];
+        if (brick == EmptyBrick)
+            return 0.f;
+        return m_data[((size_t) brick * BrickVoxels + voxelIndex(x & BrickMask, y & BrickMask, z & BrickMask))
+                      * m_channels + channel];
+    }
+
+    /// Return the channels of a voxel inside the grid, or \c nullptr if its brick is empty
+    const float *getVoxel(int x, int y, int z) const {
+        uint32_t brick = m_table[tableIndex(x >> BrickLog2, y >> BrickLog2, z >> BrickLog2)];
+        if (brick == EmptyBrick)
+            return nullptr;
+        return &m_data[((size_t) brick * BrickVoxels + voxelIndex(x & BrickMask, y & BrickMask, z & BrickMask))
+                       * m_channels];
+    }
+
+    /**
+     * \brief Fetch the values at the eight corners of a cell
+     *
+     * The cell spans the voxels (x, y, z) to (x + 1, y + 1, z + 1), which
+     * must lie inside the grid. The values are returned in the order
+     * c000, c001, c010, c011, c100, c101, c110, c111, where the digits
+     * are the offsets along z, y and x.
+     */
+    void fetchCell(int x, int y, int z, int channel, float c[8]) const;
+
+    /// Return the minimum and maximum value of the voxels in [lo, hi]
+    void getRange(const int lo[3], const int hi[3], int channel, float &minValue, float &maxValue) const;
+
+private:
+    size_t tableIndex(int bx, int by, int bz) const {
+        return ((size_t) bz * m_bricks[1] + by) * m_bricks[0] + bx;
+    }
+
+    static int voxelIndex(int x, int y, int z) {
+        return (((z << BrickLog2) + y) << BrickLog2) + x;
+    }
+
+private:
+    int m_res[3] = { 0, 0, 0 };
+    int m_bricks[3] = { 0, 0, 0 };
+    int m_channels = 0;
+    std::vector<uint32_t> m_table;
+    std::vector<float> m_data;
+};
+
+NORI_NAMESPACE_END
+
+#endif /* __NORI_BRICKGRID_H */
@@ -118,6 +118,14 @@ public:
      * or not to store photons on a surface
      */
     virtual bool isDiffuse() const { return false; }
+
+    /**
+     * \brief Return whether or not this BSDF is an invisible interface
+     * that passes light through unchanged (e.g. a medium boundary).
+     * Such surfaces can be skipped during traversal, see
+     * \ref BVH::rayIntersect()
+     */
+    virtual bool isNull() const { return false; }
 };
 
 NORI_NAMESPACE_END
@@ -59,8 +59,14 @@ public:
      */
     void addShape(Shape *shape);
 
-    /// Build the BVH
-    void build();
+    /**
+     * \brief Build the BVH
+     *
+     * \param reorder
+     *    Let the shapes store their primitives in leaf order afterwards
+     *    (see \ref reorderPrimitives())
+     */
+    void build(bool reorder = true);
 
     /**
      * \brief Intersect a ray against all shapes registered
@@ -80,10 +86,21 @@ public:
     bool rayIntersect(const Ray3f &ray, Intersection &its, 
         bool shadowRay = false) const;
 
-
-    /* consecutively keep track of the intersection, until hitting mesh surface or outside the target medium*/
-    bool rayCurrIntersect(const Ray3f& ray, Intersection& its,
-        bool shadowRay = false, const Shape *shape = nullptr) const;
+    /**
+     * \brief Intersect a ray against all shapes registered with the BVH,
+     * passing through invisible interfaces
+     *
+     * Behaves like the regular \ref rayIntersect(), except that shapes
+     * reporting \ref Shape::isNullInterface() do not terminate the ray.
+     * Instead, every crossing of such a surface in front of the first
+     * real surface is appended to \c crossings (sorted by distance) within
+     * the same traversal, so that callers can track medium transitions
+     * without re-tracing the ray from the BVH root at each boundary.
+     *
+     * \return \c true If an intersection with a real surface was found
+     */
+    bool rayIntersect(const Ray3f &ray, Intersection &its,
+        std::vector<MediumCrossing> &crossings) const;
 
     /// Return the total number of shapes registered with the BVH
     uint32_t getShapeCount() const { return (uint32_t) m_shapes.size(); }
@@ -128,6 +145,12 @@ protected:
     /// Compute internal tree statistics
     std::pair<float, uint32_t> statistics(uint32_t index = 0) const;
 
+    /**
+     * \brief Let the shapes store their primitives in the order in which
+     * the leaves reference them, and renumber \c m_indices to match
+     */
+    void reorderPrimitives();
+
     /* BVH node in 32 bytes */
     struct BVHNode {
         union {
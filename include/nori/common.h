@@ -60,6 +60,9 @@
 #define SQRT_TWO     1.41421356237309504880f
 #define INV_SQRT_TWO 0.70710678118654752440f
 
+/* Largest float below one, for clamping samples to [0, 1) */
+#define OneMinusEpsilon 0x1.fffffep-1f
+
 /* Forward declarations */
 namespace filesystem {
     class path;
@@ -28,6 +28,12 @@ NORI_NAMESPACE_BEGIN
  * 
  * This data structure can be used to transform uniformly distributed
  * samples to a stored discrete probability distribution.
+ *
+ * Besides the cumulative distribution, \ref normalize() builds an alias
+ * table (Vose's variant of Walker's method), so that \ref sample() and
+ * \ref sampleReuse() take constant time regardless of the number of
+ * entries. \ref sampleCDF() provides the classic binary search, whose
+ * mapping is monotonic and thus preserves the stratification of its input.
  * 
  * \ingroup libcore
  */
@@ -43,6 +49,7 @@ public:
     void clear() {
         m_cdf.clear();
         m_cdf.push_back(0.0f);
+        m_alias.clear();
         m_normalized = false;
     }
 
@@ -102,6 +109,7 @@ public:
                 m_cdf[i] *= m_normalization;
             m_cdf[m_cdf.size()-1] = 1.0f;
             m_normalized = true;
+            buildAliasTable();
         } else {
             m_normalization = 0.0f;
         }
@@ -111,12 +119,30 @@ public:
     /**
      * \brief %Transform a uniformly distributed sample to the stored distribution
      * 
+     * Uses the alias table once the distribution has been normalized.
+     *
      * \param[in] sampleValue
      *     An uniformly distributed sample on [0,1]
      * \return
      *     The discrete index associated with the sample
      */
     size_t sample(float sampleValue) const {
+        if (m_alias.empty())
+            return sampleCDF(sampleValue);
+        float u;
+        return sampleAlias(sampleValue, u);
+    }
+
+    /**
+     * \brief %Transform a uniformly distributed sample to the stored
+     * distribution by inverting the CDF (logarithmic time)
+     *
+     * \param[in] sampleValue
+     *     An uniformly distributed sample on [0,1]
+     * \return
+     *     The discrete index associated with the sample
+     */
+    size_t sampleCDF(float sampleValue) const {
         std::vector<float>::const_iterator entry = 
                 std::lower_bound(m_cdf.begin(), m_cdf.end(), sampleValue);
         size_t index = (size_t) std::max((ptrdiff_t) 0, entry - m_cdf.begin() - 1);
@@ -150,7 +176,27 @@ public:
      *     The discrete index associated with the sample
      */
     size_t sampleReuse(float &sampleValue) const {
-        size_t index = sample(sampleValue);
+        if (!m_alias.empty())
+            return sampleAlias(sampleValue, sampleValue);
+        return sampleCDFReuse(sampleValue);
+    }
+
+    /**
+     * \brief %Transform a uniformly distributed sample by inverting the
+     * CDF and adjust it so that it can be "reused"
+     *
+     * Unlike \ref sampleReuse(), both the selection and the reused sample
+     * are monotonic in the input, so the stratification of samples
+     * (e.g. from a low-discrepancy sampler) carries over to the second
+     * sampling step.
+     *
+     * \param[in, out] sampleValue
+     *     An uniformly distributed sample on [0,1]
+     * \return
+     *     The discrete index associated with the sample
+     */
+    size_t sampleCDFReuse(float &sampleValue) const {
+        size_t index = sampleCDF(sampleValue);
         sampleValue = (sampleValue - m_cdf[index])
             / (m_cdf[index + 1] - m_cdf[index]);
         return index;
@@ -169,9 +215,8 @@ public:
      *     The discrete index associated with the sample
      */
     size_t sampleReuse(float &sampleValue, float &pdf) const {
-        size_t index = sample(sampleValue, pdf);
-        sampleValue = (sampleValue - m_cdf[index])
-            / (m_cdf[index + 1] - m_cdf[index]);
+        size_t index = sampleReuse(sampleValue);
+        pdf = operator[](index);
         return index;
     }
 
@@ -191,7 +236,78 @@ public:
         return result + "}]";
     }
 private:
+    /**
+     * \brief Look up the alias table
+     *
+     * The sample selects a column and is then compared against the
+     * column's threshold; \c reuse receives the position of the sample
+     * within the chosen part of the column, rescaled to [0,1).
+     */
+    size_t sampleAlias(float sampleValue, float &reuse) const {
+        size_t n = m_alias.size();
+        double scaled = (double) sampleValue * (double) n;
+        size_t column = std::min((size_t) scaled, n - 1);
+        float u = std::min((float) (scaled - (double) column), OneMinusEpsilon);
+        const AliasEntry &entry = m_alias[column];
+        if (u < entry.prob) {
+            reuse = u / entry.prob;
+            return column;
+        } else {
+            reuse = std::min((u - entry.prob) / (1.0f - entry.prob), OneMinusEpsilon);
+            return entry.alias;
+        }
+    }
+
+    /// Build the alias table from the normalized CDF (Vose's method)
+    void buildAliasTable() {
+        size_t n = size();
+        m_alias.resize(n);
+        std::vector<double> scaled(n);
+        std::vector<uint32_t> small, large;
+        for (size_t i = 0; i < n; ++i) {
+            /* Zero-probability entries must never be returned */
+            scaled[i] = (double) operator[](i) * (double) n;
+            (scaled[i] < 1.0 ? small : large).push_back((uint32_t) i);
+        }
+
+        while (!small.empty() && !large.empty()) {
+            uint32_t s = small.back(), l = large.back();
+            small.pop_back();
+            m_alias[s].prob = (float) scaled[s];
+            m_alias[s].alias = l;
+            scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+            if (scaled[l] < 1.0) {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+
+        /* Whatever remains has probability one up to roundoff. Leftover
+           zero-weight entries (likely, since they are pushed first) must
+           not keep their column: it goes to the most probable entry */
+        uint32_t fallback = 0;
+        for (size_t i = 1; i < n; ++i)
+            if (operator[](i) > operator[](fallback))
+                fallback = (uint32_t) i;
+        for (uint32_t i : large) {
+            m_alias[i].prob = 1.0f;
+            m_alias[i].alias = i;
+        }
+        for (uint32_t i : small) {
+            bool positive = operator[](i) > 0.0f;
+            m_alias[i].prob = positive ? 1.0f : 0.0f;
+            m_alias[i].alias = positive ? i : fallback;
+        }
+    }
+
+    /// Column of the alias table
+    struct AliasEntry {
+        float prob;       ///< Probability of keeping the column's own index
+        uint32_t alias;   ///< Index returned otherwise
+    };
+
     std::vector<float> m_cdf;
+    std::vector<AliasEntry> m_alias;
     float m_sum, m_normalization;
     bool m_normalized;
 };
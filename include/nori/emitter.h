@@ -20,10 +20,43 @@
 #define __NORI_EMITTER_H
 
 #include <nori/object.h>
+#include <nori/bbox.h>
 
 NORI_NAMESPACE_BEGIN
 
 struct Intersection;
+
+/**
+ * \brief Spatial and directional bounds of the emission of one or more
+ * emitters, as used by the light hierarchy (see \ref LightBVH)
+ *
+ * Light leaves the region \c bounds in directions that lie within
+ * \c cosTheta_e of some surface normal, and all normals lie within a
+ * cone of half-angle \c acos(cosTheta_o) around \c w.
+ */
+struct LightBounds {
+    /// Region containing the emitting points
+    BoundingBox3f bounds;
+    /// Axis of the normal cone
+    Vector3f w = Vector3f(0.f, 0.f, 1.f);
+    /// Estimated power (zero for empty bounds)
+    float phi = 0.f;
+    /// Cosine of the half-angle of the normal cone
+    float cosTheta_o = -1.f;
+    /// Cosine of the maximum emission angle relative to the normals
+    float cosTheta_e = 0.f;
+    /// Is light emitted on both sides of the surfaces?
+    bool twoSided = false;
+
+    /// Return the union of two light bounds
+    static LightBounds merge(const LightBounds &a, const LightBounds &b);
+
+    /**
+     * \brief Conservative estimate of the illumination arriving at a
+     * point with normal \c n (pass a zero normal to ignore the cosine)
+     */
+    float importance(const Point3f &p, const Normal3f &n) const;
+};
 /**
  * \brief Data record for conveniently querying and sampling the
  * direct illumination technique implemented by a emitter
@@ -41,6 +74,14 @@ struct EmitterQueryRecord {
     float pdf;
     /// Shadow ray
     Ray3f shadowRay;
+    /// Index of the emitting primitive within its shape
+    uint32_t primIndex = 0;
+    /**
+     * \brief Sample only the primitive \c primIndex, with a density
+     * conditional on it (set when the light hierarchy selects single
+     * primitives, see \ref Emitter::getPrimitiveLightCount())
+     */
+    bool fixedPrimitive = false;
 
     /// Create an unitialized query record
     EmitterQueryRecord() { }
@@ -51,9 +92,11 @@ struct EmitterQueryRecord {
     /**
      * \brief Create a query record that can be used to query the
      * sampling density after having intersected an area emitter
+     * (\c primIndex is \ref Intersection::primIndex of the hit)
      */
-    EmitterQueryRecord(const Point3f &ref, const Point3f &p, const Normal3f &n) :
-        ref(ref), p(p), n(n) {
+    EmitterQueryRecord(const Point3f &ref, const Point3f &p, const Normal3f &n,
+                       uint32_t primIndex = 0) :
+        ref(ref), p(p), n(n), primIndex(primIndex) {
         wi = (p - ref).normalized();
     }
 };
@@ -102,6 +145,42 @@ public:
     virtual float pdf(const EmitterQueryRecord &lRec) const = 0;
 
 
+    /**
+     * \brief Return an estimate of the total power emitted by the emitter
+     *
+     * Used by the scene to select emitters for direct illumination
+     * sampling. Only ratios between the estimates matter.
+     */
+    virtual Color3f getPower() const = 0;
+
+    /**
+     * \brief Return the bounds of the emission for the light hierarchy
+     *
+     * \param power
+     *     Power estimate to store in the bounds (see \ref getPower())
+     */
+    virtual LightBounds getLightBounds(float power) const = 0;
+
+    /**
+     * \brief Return the number of primitives that the light hierarchy
+     * bounds and selects individually
+     *
+     * With more than one, \ref sample() and \ref pdf() must honor
+     * \ref EmitterQueryRecord::fixedPrimitive. The default of one
+     * selects the emitter as a whole.
+     */
+    virtual uint32_t getPrimitiveLightCount() const { return 1; }
+
+    /**
+     * \brief Return the bounds of the emission of a single primitive
+     *
+     * \param power
+     *     Power estimate of the entire emitter
+     */
+    virtual LightBounds getPrimitiveLightBounds(uint32_t primIndex, float power) const {
+        return getLightBounds(power);
+    }
+
     /// Sample a photon
     virtual Color3f samplePhoton(Ray3f &ray, const Point2f &sample1, const Point2f &sample2) const {
         throw NoriException("Emitter::samplePhoton(): not implemented!");
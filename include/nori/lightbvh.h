@@ -0,0 +1,122 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(__NORI_LIGHTBVH_H)
+#define __NORI_LIGHTBVH_H
+
+#include <nori/emitter.h>
+#include <unordered_map>
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * \brief Bounding volume hierarchy over the emitters of a scene
+ *
+ * Every node stores the \ref LightBounds of its subtree, i.e. spatial
+ * bounds, power and a cone of surface normals. The leaves are the
+ * emitters, except for emitters that can be sampled per primitive (such
+ * as emissive meshes), which contribute one leaf per triangle. A leaf is
+ * selected for a shading point by a stochastic traversal that descends
+ * into each child with probability proportional to its importance for
+ * that point, so that nearby, bright and well-oriented emitters are
+ * preferred. The probability of a given leaf is recovered by replaying
+ * its path from the root (see \ref pdf()).
+ *
+ * The hierarchy is built with the orientation-aware surface area
+ * heuristic described in "Importance Sampling of Many Lights with
+ * Adaptive Tree Splitting" by Conty Estevez and Kulla.
+ */
+class LightBVH {
+public:
+    /**
+     * \brief Build the hierarchy
+     *
+     * \param emitters
+     *     Emitters to be sampled
+     * \param power
+     *     Power estimate of every emitter (must be positive)
+     */
+    LightBVH(const std::vector<Emitter *> &emitters, const std::vector<float> &power);
+
+    /**
+     * \brief Select an emitter for a shading point
+     *
+     * \param n
+     *     Shading normal, or zero for points in participating media
+     * \param sample
+     *     A uniformly distributed sample on [0,1]
+     * \param pdf
+     *     Probability of the selection
+     * \param lRec
+     *     Receives the selected primitive (\c primIndex and
+     *     \c fixedPrimitive) for the following \ref Emitter::sample()
+     * \return
+     *     The selected emitter, or \c nullptr if no emitter can
+     *     illuminate the point
+     */
+    const Emitter *sample(const Point3f &p, const Normal3f &n, float sample, float &pdf,
+                          EmitterQueryRecord &lRec) const;
+
+    /**
+     * \brief Return the probability that \ref sample() selects \c emitter,
+     * or its primitive \c lRec.primIndex if it has a leaf per primitive
+     *
+     * Sets \c lRec.fixedPrimitive accordingly, so that \ref Emitter::pdf()
+     * returns the matching conditional density.
+     */
+    float pdf(const Point3f &p, const Normal3f &n, const Emitter *emitter,
+              EmitterQueryRecord &lRec) const;
+
+    /// Return the number of nodes
+    size_t getNodeCount() const { return m_nodes.size(); }
+
+protected:
+    struct Node {
+        LightBounds bounds;
+        /// Light index for leaves, index of the second child otherwise
+        uint32_t index;
+        bool leaf;
+    };
+
+    /// A leaf: an emitter, or a single primitive of it
+    struct Light {
+        uint32_t emitter;
+        uint32_t primIndex;
+        bool fixedPrimitive;
+    };
+
+    /// Recursively build the subtree for the lights in [begin, end)
+    uint32_t build(std::vector<std::pair<uint32_t, LightBounds>> &lights,
+                   size_t begin, size_t end, uint64_t bitTrail, int depth);
+
+    /// Importance-based probability of descending into the first child
+    float childProbability(const Point3f &p, const Normal3f &n, uint32_t node) const;
+
+private:
+    std::vector<Node> m_nodes;
+    std::vector<Emitter *> m_emitters;
+    std::vector<Light> m_lights;
+    /// Index of the first light of every emitter (its primitives follow)
+    std::unordered_map<const Emitter *, uint32_t> m_firstLight;
+    /// Path from the root to every light (bit i: child taken at depth i)
+    std::vector<uint64_t> m_bitTrails;
+};
+
+NORI_NAMESPACE_END
+
+#endif /* __NORI_LIGHTBVH_H */
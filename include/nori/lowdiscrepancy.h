@@ -0,0 +1,125 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(__NORI_LOWDISCREPANCY_H)
+#define __NORI_LOWDISCREPANCY_H
+
+#include <nori/common.h>
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * \brief Generator matrices of the first two Sobol dimensions
+ *
+ * Entry \c i is the matrix column that is XORed into the result when
+ * bit \c i of the sample index is set; the most significant bit of the
+ * column corresponds to the first binary digit after the point. The two
+ * dimensions together form a (0,2)-sequence in base 2.
+ */
+static const uint32_t SobolMatrices[2][32] = {
+    {
+        0x80000000, 0x40000000, 0x20000000, 0x10000000,
+        0x08000000, 0x04000000, 0x02000000, 0x01000000,
+        0x00800000, 0x00400000, 0x00200000, 0x00100000,
+        0x00080000, 0x00040000, 0x00020000, 0x00010000,
+        0x00008000, 0x00004000, 0x00002000, 0x00001000,
+        0x00000800, 0x00000400, 0x00000200, 0x00000100,
+        0x00000080, 0x00000040, 0x00000020, 0x00000010,
+        0x00000008, 0x00000004, 0x00000002, 0x00000001
+    },
+    {
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000,
+        0x88000000, 0xcc000000, 0xaa000000, 0xff000000,
+        0x80800000, 0xc0c00000, 0xa0a00000, 0xf0f00000,
+        0x88880000, 0xcccc0000, 0xaaaa0000, 0xffff0000,
+        0x80008000, 0xc000c000, 0xa000a000, 0xf000f000,
+        0x88008800, 0xcc00cc00, 0xaa00aa00, 0xff00ff00,
+        0x80808080, 0xc0c0c0c0, 0xa0a0a0a0, 0xf0f0f0f0,
+        0x88888888, 0xcccccccc, 0xaaaaaaaa, 0xffffffff
+    }
+};
+
+/// Reverse the order of the bits of a 32-bit integer
+inline uint32_t reverseBits(uint32_t v) {
+    v = ((v >> 1) & 0x55555555u) | ((v & 0x55555555u) << 1);
+    v = ((v >> 2) & 0x33333333u) | ((v & 0x33333333u) << 2);
+    v = ((v >> 4) & 0x0f0f0f0fu) | ((v & 0x0f0f0f0fu) << 4);
+    v = ((v >> 8) & 0x00ff00ffu) | ((v & 0x00ff00ffu) << 8);
+    return (v >> 16) | (v << 16);
+}
+
+/// Finalizer of the 64-bit MurmurHash3, a fast bijective bit mixer
+inline uint64_t mixBits(uint64_t v) {
+    v ^= v >> 33;
+    v *= 0xff51afd7ed558ccdull;
+    v ^= v >> 33;
+    v *= 0xc4ceb9fe1a85ec53ull;
+    v ^= v >> 33;
+    return v;
+}
+
+/// Combine a hash value with another value
+inline uint64_t hashCombine(uint64_t seed, uint64_t v) {
+    return mixBits(seed ^ (v + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2)));
+}
+
+/**
+ * \brief Evaluate one of the Sobol dimensions in \ref SobolMatrices
+ *
+ * The first dimension is the van der Corput sequence, i.e. a bit
+ * reversal. The shuffled indices use all 32 bits, so the second one
+ * masks the columns instead of branching on every bit.
+ */
+inline uint32_t sobolSample(uint32_t index, int dim) {
+    if (dim == 0)
+        return reverseBits(index);
+    uint32_t v = 0;
+    for (const uint32_t *m = SobolMatrices[dim]; index; index >>= 1, ++m)
+        v ^= *m & (0u - (index & 1u));
+    return v;
+}
+
+/**
+ * \brief Owen scrambling of a 32-bit fixed point value
+ *
+ * Uses the hash-based permutation of Laine and Karras in the variant
+ * proposed by Burley ("Practical Hash-based Owen Scrambling", 2020).
+ * Each bit is flipped based on a hash of the bits that precede it, so
+ * the scrambling preserves the stratification of (t,m,s)-nets. Since
+ * it maps aligned power-of-two ranges of integers onto aligned ranges
+ * of the same size, it also shuffles the indices of a (t,s)-sequence
+ * without breaking its progressive nets.
+ */
+inline uint32_t owenScramble(uint32_t v, uint32_t seed) {
+    v = reverseBits(v);
+    v ^= v * 0x3d20adeau;
+    v += seed;
+    v *= (seed >> 16) | 1u;
+    v ^= v * 0x05526c56u;
+    v ^= v * 0x53a22864u;
+    return reverseBits(v);
+}
+
+/// Convert a 32-bit fixed point value into a float on <tt>[0, 1)</tt>
+inline float fixedToFloat(uint32_t v) {
+    return std::min(v * 0x1p-32f, OneMinusEpsilon);
+}
+
+NORI_NAMESPACE_END
+
+#endif /* __NORI_LOWDISCREPANCY_H */
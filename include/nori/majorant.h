@@ -0,0 +1,314 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(__NORI_MAJORANT_H)
+#define __NORI_MAJORANT_H
+
+#include <nori/bbox.h>
+#include <nori/ray.h>
+#include <nori/sampler.h>
+#include <tbb/enumerable_thread_specific.h>
+
+NORI_NAMESPACE_BEGIN
+
+class Volume;
+
+/// Part of a ray that lies in a single cell of a \ref MajorantGrid
+struct MajorantSegment {
+    /// Ray parameters where the segment begins and ends
+    float tMin, tMax;
+    /// Upper bound of the extinction coefficient inside the cell
+    float majorant;
+    /// Lower bound of the extinction coefficient inside the cell
+    float minorant;
+};
+
+class MajorantGrid;
+
+/**
+ * \brief Walks the cells of a \ref MajorantGrid along a ray (3D-DDA)
+ *
+ * Every call to \ref next() returns the next cell pierced by the ray
+ * together with its extinction bounds, in front-to-back order.
+ */
+class MajorantIterator {
+public:
+    /// Create an iterator that returns no segments
+    MajorantIterator() { }
+
+    /// Start walking the grid along \c ray between \c tMin and \c tMax
+    MajorantIterator(const MajorantGrid *grid, const Ray3f &ray, float tMin, float tMax);
+
+    /// Return the next segment, or \c false once the ray leaves the grid
+    bool next(MajorantSegment &seg);
+
+private:
+    const MajorantGrid *m_grid = nullptr;
+    float m_t = 0.f, m_tMax = 0.f;
+    float m_nextT[3], m_deltaT[3];
+    int m_cell[3], m_step[3], m_stop[3];
+};
+
+/**
+ * \brief Coarse grid of extinction bounds over the bounding box of a medium
+ *
+ * Each cell stores the largest and smallest extinction coefficient the
+ * medium can take inside of it, which lets the free-path sampling and
+ * transmittance estimators of the heterogeneous media use a tight local
+ * majorant and skip empty space. The bounds come from
+ * \ref Volume::lookupBounds(), multiplied by the density scale.
+ *
+ * The grid also counts the real and null collisions and the ratio
+ * tracking lookups of the media that use it, which are printed after
+ * rendering.
+ */
+class MajorantGrid {
+public:
+    /**
+     * \brief Build the grid
+     *
+     * \param volume
+     *     Extinction volume (its \ref Volume::lookupFloat() values)
+     * \param bbox
+     *     Region of space covered by the medium
+     * \param scale
+     *     Multiplier applied to the values of \c volume
+     * \param res
+     *     Number of cells along each axis
+     */
+    void build(const Volume *volume, const BoundingBox3f &bbox, float scale, int res);
+
+    /// Is the grid ready to use?
+    bool isValid() const { return !m_majorant.empty(); }
+
+    /// Return the bounding box covered by the grid
+    const BoundingBox3f &getBoundingBox() const { return m_bbox; }
+
+    /// Return the largest majorant of all cells
+    float getMaxMajorant() const { return m_maxMajorant; }
+
+    /// Return the bounds of the given cell
+    float getMajorant(const int cell[3]) const { return m_majorant[index(cell)]; }
+    float getMinorant(const int cell[3]) const { return m_minorant[index(cell)]; }
+
+    /// Return the number of cells along each axis
+    int getResolution() const { return m_res; }
+
+    /// Walk the cells pierced by \c ray within [tMin, tMax]
+    MajorantIterator traverse(const Ray3f &ray, float tMin, float tMax) const {
+        if (!isValid())
+            return MajorantIterator();
+        return MajorantIterator(this, ray, tMin, tMax);
+    }
+
+    /**
+     * \brief Enable the collision statistics (off by default)
+     *
+     * The counters are kept per thread and only merged by \ref getStatistics(),
+     * so the tracking loops never contend on shared cache lines.
+     */
+    void setStatistics(bool enabled) { m_statistics = enabled; }
+
+    /// Add the collisions of one tracking query to the statistics
+    void addCollisions(uint64_t real, uint64_t null) const {
+        if (!m_statistics)
+            return;
+        TrackingCounters &counters = m_counters.local();
+        counters.real += real;
+        counters.null += null;
+    }
+
+    /// Add the density lookups of one ratio tracking query to the statistics
+    void addRatioLookups(uint64_t lookups) const {
+        if (m_statistics)
+            m_counters.local().ratioLookups += lookups;
+    }
+
+    /// Return a summary of the collision statistics, empty if they are disabled
+    std::string getStatistics() const;
+
+    /// Return a human-readable summary
+    std::string toString() const;
+
+private:
+    int index(const int cell[3]) const { return (cell[2] * m_res + cell[1]) * m_res + cell[0]; }
+
+    BoundingBox3f m_bbox;
+    int m_res = 0;
+    float m_maxMajorant = 0.f;
+    size_t m_emptyCells = 0;
+    std::vector<float> m_majorant;
+    std::vector<float> m_minorant;
+    struct TrackingCounters {
+        uint64_t real = 0, null = 0, ratioLookups = 0;
+    };
+    bool m_statistics = false;
+    mutable tbb::enumerable_thread_specific<TrackingCounters> m_counters;
+};
+
+inline MajorantIterator::MajorantIterator(const MajorantGrid *grid, const Ray3f &ray, float tMin, float tMax)
+    : m_grid(grid), m_t(tMin), m_tMax(tMax) {
+    const BoundingBox3f &bbox = grid->getBoundingBox();
+    Vector3f extents = bbox.getExtents();
+    int res = grid->getResolution();
+    Point3f p = ray(tMin);
+
+    for (int i = 0; i < 3; ++i) {
+        /* Express the ray in units of cells */
+        float scale = extents[i] > 0 ? res / extents[i] : 0.f;
+        float pGrid = (p[i] - bbox.min[i]) * scale;
+        float dGrid = ray.d[i] * scale;
+        m_cell[i] = clamp((int) std::floor(pGrid), 0, res - 1);
+
+        if (dGrid == 0) {
+            m_nextT[i] = m_deltaT[i] = std::numeric_limits<float>::infinity();
+            m_step[i] = 0;
+            m_stop[i] = -1;
+        } else if (dGrid > 0) {
+            m_nextT[i] = tMin + (m_cell[i] + 1 - pGrid) / dGrid;
+            m_deltaT[i] = 1.f / dGrid;
+            m_step[i] = 1;
+            m_stop[i] = res;
+        } else {
+            m_nextT[i] = tMin + (m_cell[i] - pGrid) / dGrid;
+            m_deltaT[i] = -1.f / dGrid;
+            m_step[i] = -1;
+            m_stop[i] = -1;
+        }
+    }
+}
+
+inline bool MajorantIterator::next(MajorantSegment &seg) {
+    if (!m_grid || m_t >= m_tMax)
+        return false;
+
+    /* Find the axis of the closest cell boundary */
+    int axis = m_nextT[0] < m_nextT[1] ? (m_nextT[0] < m_nextT[2] ? 0 : 2)
+                                       : (m_nextT[1] < m_nextT[2] ? 1 : 2);
+    float tEnd = std::max(m_t, std::min(m_tMax, m_nextT[axis]));
+
+    seg.tMin = m_t;
+    seg.tMax = tEnd;
+    seg.majorant = m_grid->getMajorant(m_cell);
+    seg.minorant = m_grid->getMinorant(m_cell);
+
+    /* Step into the neighboring cell */
+    m_t = tEnd;
+    m_cell[axis] += m_step[axis];
+    m_nextT[axis] += m_deltaT[axis];
+    if (m_cell[axis] == m_stop[axis])
+        m_t = m_tMax;
+    return true;
+}
+
+/**
+ * \brief Generate the tentative collisions of delta tracking along a ray
+ *
+ * The collisions are distributed according to the local majorant of
+ * every cell pierced by the ray; cells whose majorant is zero are
+ * skipped without any sampling. The exponential distances carry over
+ * from one cell to the next, so the sequence is equivalent to tracking
+ * against a piecewise-constant majorant.
+ *
+ * \param callback
+ *     Invoked as <tt>callback(t, majorant)</tt> at every tentative
+ *     collision; returns \c false to stop the traversal
+ * \return
+ *     \c false if the callback stopped the traversal, \c true if the
+ *     ray reached \c tMax
+ */
+template <typename Callback>
+bool trackMajorant(const MajorantGrid &grid, const Ray3f &ray, float tMin, float tMax,
+                   Sampler *sampler, Callback callback) {
+    MajorantIterator it = grid.traverse(ray, tMin, tMax);
+    MajorantSegment seg;
+    /* Optical depth left until the next tentative collision */
+    float tau = -std::log(1 - sampler->next1D());
+    while (it.next(seg)) {
+        if (seg.majorant == 0)
+            continue;
+        float t = seg.tMin;
+        while (true) {
+            float dt = tau / seg.majorant;
+            if (t + dt >= seg.tMax) {
+                tau -= (seg.tMax - t) * seg.majorant;
+                break;
+            }
+            t += dt;
+            if (!callback(t, seg.majorant))
+                return false;
+            tau = -std::log(1 - sampler->next1D());
+        }
+    }
+    return true;
+}
+
+/**
+ * \brief Estimate the transmittance along a ray by residual ratio tracking
+ *
+ * The minorant of every cell serves as control extinction: its
+ * transmittance is accounted for analytically, and tentative collisions
+ * are only generated for the residual between majorant and minorant.
+ * Each of them scales the estimate by the probability of a null
+ * collision. Cells with a zero minorant reduce to plain ratio tracking,
+ * and cells whose bounds coincide need no lookups at all. Russian
+ * roulette terminates walks whose estimate has become small.
+ *
+ * \param density
+ *     Invoked as <tt>density(t)</tt>, returns the extinction coefficient
+ *     at the given position along the ray
+ * \param lookups
+ *     Incremented by the number of density lookups
+ */
+template <typename Density>
+float ratioTrack(const MajorantGrid &grid, const Ray3f &ray, float tMin, float tMax,
+                 Sampler *sampler, Density density, uint64_t &lookups) {
+    MajorantIterator it = grid.traverse(ray, tMin, tMax);
+    MajorantSegment seg;
+    float tr = 1.f;
+    /* Residual optical depth left until the next tentative collision */
+    float tau = -std::log(1 - sampler->next1D());
+    while (it.next(seg)) {
+        tr *= std::exp(-seg.minorant * (seg.tMax - seg.tMin));
+        float residual = seg.majorant - seg.minorant;
+        if (residual <= 0)
+            continue;
+        float t = seg.tMin;
+        while (true) {
+            float dt = tau / residual;
+            if (t + dt >= seg.tMax) {
+                tau -= (seg.tMax - t) * residual;
+                break;
+            }
+            t += dt;
+            tr *= 1.f - (density(t) - seg.minorant) / residual;
+            lookups++;
+            tau = -std::log(1 - sampler->next1D());
+        }
+        if (tr < 0.05f) {
+            if (sampler->next1D() < 0.75f)
+                return 0.f;
+            tr /= 0.25f;
+        }
+    }
+    return tr;
+}
+
+NORI_NAMESPACE_END
+
+#endif /* __NORI_MAJORANT_H */
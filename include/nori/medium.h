@@ -59,6 +59,7 @@ class Medium : public NoriObject {
 public:
     virtual  bool sample_freepath(MediumQueryRecord& mRec, Sampler* sampler) const = 0;
 
+    // estimate the transmittance between mRec.ref and mRec.p, both inside the medium
     virtual Color3f Tr(const MediumQueryRecord& mRec, Sampler* sampler) const { return Color3f(0); }
 
     // Return the phase function of this medium
@@ -72,6 +73,14 @@ public:
     //eval
     virtual Color3f eval_radiance(Point3f& p) const { return Color3f(0); }
 
+    /**
+     * \brief Return an estimate of the total power emitted by the medium
+     *
+     * Only meaningful for emissive media; used to weigh them against each
+     * other and against the emitters when sampling direct illumination.
+     */
+    virtual Color3f getPower() const { return Color3f(0.f); }
+
     //sample
     virtual Color3f sample_radiance(MediumQueryRecord& mRec, Sampler* sampler) const { return Color3f(0); }
 
@@ -82,9 +91,12 @@ public:
 
     virtual std::string toString() const = 0;
 
-    //generate the volume grid for perlin noise
+    //generate the volume grid for perlin noise and the majorant grid
     virtual void volGrid() {};
 
+    // summary of the tracking statistics gathered while rendering (if any)
+    virtual std::string getStatistics() const { return ""; }
+
     EClassType getClassType() const override { return EMedium; }
 
 
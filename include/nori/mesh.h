@@ -21,9 +21,45 @@
 
 #include <nori/shape.h>
 #include <nori/dpdf.h>
+#include <memory>
 
 NORI_NAMESPACE_BEGIN
 
+/// Read-only views of mesh data, which may reside in a memory-mapped file
+typedef Eigen::Map<const MatrixXf> MatrixXfMap;
+typedef Eigen::Map<const MatrixXu> MatrixXuMap;
+
+/// Vertex and face arrays of a triangle mesh, as produced by a loader
+struct MeshData {
+    MatrixXf V, N, UV;       ///< Positions, normals and texture coordinates (may be empty)
+    MatrixXu F;              ///< Faces
+    BoundingBox3f bbox;      ///< Bounding box of \c V
+
+    /* Compact attributes (see compact()), which replace N, UV and F */
+    std::vector<uint32_t> Noct;          ///< Octahedral normals (2x16 bit)
+    std::vector<uint16_t> UVq;           ///< Quantized texture coordinates
+    Point2f uvOffset = Point2f(0.f);     ///< Dequantization offset of \c UVq
+    Vector2f uvScale = Vector2f(0.f);    ///< Dequantization scale of \c UVq
+    std::vector<uint16_t> F16;           ///< 16-bit faces
+
+    /**
+     * \brief Switch to the compact attribute representation
+     *
+     * Normals are stored as 32-bit octahedral vectors, texture coordinates
+     * as 16-bit values quantized to their bounding box, and indices as
+     * 16-bit values if the mesh has at most 65536 vertices. Positions keep
+     * full precision. Loaders call this before the data is shared, so that
+     * all meshes referencing it use the compact storage.
+     */
+    void compact();
+
+    /// Number of bytes used by the arrays
+    size_t getSize() const;
+
+    /// Number of bytes the arrays take up at full precision
+    size_t getFullSize() const;
+};
+
 /**
  * \brief Triangle mesh
  *
@@ -31,6 +67,15 @@ NORI_NAMESPACE_BEGIN
  * for querying the individual triangles. Subclasses of \c Mesh implement
  * the specifics of how to create its contents (e.g. by loading from an
  * external file)
+ *
+ * The vertex and face arrays are views into storage that is shared
+ * through \ref setMeshData(). Loaders that parse their input hand over
+ * freshly allocated matrices, while binary formats can reference a
+ * memory-mapped file directly.
+ *
+ * Loaders may additionally store normals, texture coordinates and (for
+ * small meshes) indices in quantized form, see \ref MeshData::compact().
+ * The accessors below decode them transparently.
  */
 class Mesh : public Shape {
 public:
@@ -38,7 +83,9 @@ public:
     virtual void activate() override;
 
     /// Return the total number of triangles in this shape
-    virtual uint32_t getPrimitiveCount() const override { return (uint32_t) m_F.cols(); }
+    virtual uint32_t getPrimitiveCount() const override {
+        return m_faceCount;
+    }
 
     //// Return an axis-aligned bounding box containing the given triangle
     virtual BoundingBox3f getBoundingBox(uint32_t index) const override;
@@ -76,33 +123,97 @@ public:
     /// Set intersection information: hit point, shading frame, UVs
     virtual void setHitInformation(uint32_t index, const Ray3f &ray, Intersection & its) const override;
 
+    /**
+     * \brief Permute the triangles into the given order and renumber
+     * the vertices by first use
+     *
+     * The data is copied into new storage, so meshes sharing their
+     * storage are not affected. Meshes referencing a memory-mapped file
+     * keep their original order so that the mapping stays shared.
+     */
+    virtual bool reorderPrimitives(const std::vector<uint32_t> &order) override;
+
     /// Return the total number of vertices in this shape
     uint32_t getVertexCount() const { return (uint32_t) m_V.cols(); }
 
+    /// Return the index of vertex \c k (0, 1 or 2) of the given triangle
+    uint32_t getVertexIndex(uint32_t index, int k) const {
+        return m_F16 ? (uint32_t) m_F16[3 * index + k] : m_F(k, index);
+    }
+
+    /// Does the mesh provide per-vertex normals?
+    bool hasVertexNormals() const { return m_N.size() > 0 || m_Noct; }
+
+    /// Does the mesh provide per-vertex texture coordinates?
+    bool hasTexCoords() const { return m_UV.size() > 0 || m_UVq; }
+
+    /// Return the (decoded) normal of the given vertex
+    Normal3f getVertexNormal(uint32_t vertex) const;
+
+    /// Return the (decoded) texture coordinates of the given vertex
+    Point2f getVertexTexCoord(uint32_t vertex) const;
+
     /**
-     * \brief Uniformly sample a position on the mesh with
-     * respect to surface area.
+     * \brief Sample a position on the mesh
+     *
+     * A triangle is chosen in proportion to its area, unless the record
+     * fixes one. Given a reference point, a direction is then drawn
+     * uniformly from the solid angle the triangle subtends; otherwise
+     * the triangle is sampled by area.
      */
     virtual void sampleSurface(ShapeQueryRecord & sRec, const Point2f & sample) const override;
     virtual float pdfSurface(const ShapeQueryRecord & sRec) const override;
 
+    /**
+     * \brief Return the solid angle subtended by a triangle as seen from
+     * \c ref, or zero if the triangle is sampled by area instead
+     */
+    float getSolidAngle(uint32_t index, const Point3f &ref) const;
+
+    /**
+     * \brief Inside/outside test for closed meshes
+     *
+     * Counts the crossings of a ray cast from \c p along the positive
+     * X axis (parity test). The candidate triangles are looked up in a
+     * grid over the YZ plane, which is built by \ref activate() for
+     * meshes that bound a medium.
+     */
+    virtual bool contains(const Point3f &p) const override;
+
     /// Return the surface area of the given triangle
     float surfaceArea(uint32_t index) const;
 
+    /// Return the total surface area (available after \ref activate())
+    virtual float getSurfaceArea() const override { return m_pdf.getSum(); }
+
+    /// Return a cone containing the face normals (and vertex normals, if any)
+    virtual void getNormalCone(Vector3f &axis, float &cosTheta) const override;
+
+    /// Triangles can be sampled individually
+    virtual bool canSamplePrimitives() const override { return true; }
+
+    virtual float getPrimitiveArea(uint32_t index) const override { return surfaceArea(index); }
+
+    /// Return a cone around the face normal that contains the vertex normals, if any
+    virtual void getPrimitiveNormalCone(uint32_t index, Vector3f &axis, float &cosTheta) const override;
+
     Point3f getInterpolatedVertex(uint32_t index, const Vector3f & bc) const;
     Normal3f getInterpolatedNormal(uint32_t index, const Vector3f & bc) const;
 
     /// Return a pointer to the vertex positions
-    const MatrixXf &getVertexPositions() const { return m_V; }
+    const MatrixXfMap &getVertexPositions() const { return m_V; }
 
     /// Return a pointer to the vertex normals (or \c nullptr if there are none)
-    const MatrixXf &getVertexNormals() const { return m_N; }
+    const MatrixXfMap &getVertexNormals() const { return m_N; }
 
     /// Return a pointer to the texture coordinates (or \c nullptr if there are none)
-    const MatrixXf &getVertexTexCoords() const { return m_UV; }
+    const MatrixXfMap &getVertexTexCoords() const { return m_UV; }
 
     /// Return a pointer to the triangle vertex index list
-    const MatrixXu &getIndices() const { return m_F; }
+    const MatrixXuMap &getIndices() const { return m_F; }
+
+    /* Note: the three accessors above return empty matrices for
+       attributes that were converted by MeshData::compact() */
 
 
     /// Return the name of this mesh
@@ -115,14 +226,58 @@ protected:
     /// Create an empty mesh
     Mesh();
 
+    /// Take ownership of freshly loaded mesh data (\c N and \c UV may be empty)
+    void setMeshData(MatrixXf &&V, MatrixXf &&N, MatrixXf &&UV, MatrixXu &&F);
+
+    /**
+     * \brief Reference mesh data that may be shared with other meshes
+     *
+     * The data is treated as immutable. \ref reorderPrimitives() only
+     * replaces it once this mesh holds the last reference to it.
+     */
+    void setMeshData(const std::shared_ptr<const MeshData> &data);
+
+    /**
+     * \brief Reference mesh data stored in external memory
+     *
+     * \param storage
+     *    Object that keeps the referenced memory alive (e.g. a file mapping)
+     * \param N, UV, areas
+     *    Optional arrays, may be \c nullptr. When per-triangle areas are
+     *    given, \ref activate() uses them instead of recomputing them.
+     */
+    void setMeshData(const std::shared_ptr<const void> &storage,
+                     uint32_t vertexCount, uint32_t faceCount,
+                     const float *V, const float *N, const float *UV,
+                     const uint32_t *F, const float *areas = nullptr);
+
 protected:
     std::string m_name;                  ///< Identifying name
-    MatrixXf      m_V;                   ///< Vertex positions
-    MatrixXf      m_N;                   ///< Vertex normals
-    MatrixXf      m_UV;                  ///< Vertex texture coordinates
-    MatrixXu      m_F;                   ///< Faces
+    MatrixXfMap   m_V{nullptr, 3, 0};    ///< Vertex positions
+    MatrixXfMap   m_N{nullptr, 3, 0};    ///< Vertex normals
+    MatrixXfMap   m_UV{nullptr, 2, 0};   ///< Vertex texture coordinates
+    MatrixXuMap   m_F{nullptr, 3, 0};    ///< Faces
+    const float  *m_areas = nullptr;     ///< Precomputed triangle areas, if any
+    std::shared_ptr<const void> m_storage; ///< Keeps the memory behind the views alive
+    const MeshData *m_meshData = nullptr; ///< Set if \c m_storage refers to a \ref MeshData
+    uint32_t m_faceCount = 0;            ///< Number of triangles
+
+    /* Compact attributes of m_meshData (see MeshData::compact()), or nullptr */
+    const uint32_t *m_Noct = nullptr;    ///< Octahedral normals (2x16 bit)
+    const uint16_t *m_UVq = nullptr;     ///< Quantized texture coordinates
+    Point2f m_uvOffset = Point2f(0.f);   ///< Dequantization offset of m_UVq
+    Vector2f m_uvScale = Vector2f(0.f);  ///< Dequantization scale of m_UVq
+    const uint16_t *m_F16 = nullptr;     ///< 16-bit faces
 
     DiscretePDF m_pdf;
+
+    /* Grid over the YZ plane used by contains(), in compressed row storage */
+    Vector2i m_insideRes = Vector2i(0);  ///< Cell count along Y and Z
+    std::vector<uint32_t> m_insideCells; ///< Offset of each cell into m_insideTris
+    std::vector<uint32_t> m_insideTris;  ///< Triangle indices overlapping each cell
+
+    /// Build the grid used by contains()
+    void buildInsideGrid();
 };
 
 NORI_NAMESPACE_END
@@ -0,0 +1,59 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(__NORI_NMESH_H)
+#define __NORI_NMESH_H
+
+#include <nori/mesh.h>
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * \brief Header of the native binary mesh format (".nmesh")
+ *
+ * The header is followed by the arrays it references. Every array
+ * starts at a 64-byte aligned offset and is stored column-major exactly
+ * like the corresponding matrix of \ref Mesh, so that a mapped file can
+ * be used without any conversion. Optional arrays have an offset of 0.
+ * All values are little endian.
+ */
+struct NMeshHeader {
+    char     magic[4];       ///< "NMSH"
+    uint32_t version;        ///< Format version (currently 1)
+    uint32_t vertexCount;    ///< Number of vertices
+    uint32_t faceCount;      ///< Number of triangles
+    float    bboxMin[3];     ///< Bounding box of the vertex positions
+    float    bboxMax[3];
+    uint64_t offsetV;        ///< Positions (3 floats per vertex)
+    uint64_t offsetN;        ///< Normals (3 floats per vertex, optional)
+    uint64_t offsetUV;       ///< Texture coordinates (2 floats per vertex, optional)
+    uint64_t offsetF;        ///< Vertex indices (3 uint32 per triangle)
+    uint64_t offsetArea;     ///< Triangle areas (1 float per triangle, optional)
+};
+
+static_assert(sizeof(NMeshHeader) == 80, "Unexpected padding in NMeshHeader");
+
+/// Alignment of the arrays within an nmesh file
+static const uint64_t NMESH_ALIGNMENT = 64;
+
+/// Write a mesh in nmesh format, optionally including its triangle areas
+extern void writeNMesh(const std::string &filename, const Mesh *mesh, bool storeAreas);
+
+NORI_NAMESPACE_END
+
+#endif /* __NORI_NMESH_H */
@@ -0,0 +1,132 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(__NORI_PLYFILE_H)
+#define __NORI_PLYFILE_H
+
+#include <nori/common.h>
+#include <fstream>
+#include <memory>
+
+NORI_NAMESPACE_BEGIN
+
+/// Scalar types that may appear in a PLY file
+enum EPLYType {
+    EPLYInvalid = 0,
+    EPLYInt8,
+    EPLYUInt8,
+    EPLYInt16,
+    EPLYUInt16,
+    EPLYInt32,
+    EPLYUInt32,
+    EPLYFloat32,
+    EPLYFloat64
+};
+
+/// Single property of a PLY element (either a scalar or a list)
+struct PLYProperty {
+    /// Name of the property
+    std::string name;
+    /// Type of the value (or of the list entries)
+    EPLYType type = EPLYInvalid;
+    /// Type of the list length prefix, \c EPLYInvalid for scalars
+    EPLYType countType = EPLYInvalid;
+
+    /// Is this a list property?
+    bool isList() const { return countType != EPLYInvalid; }
+};
+
+/// Element declaration of a PLY file (e.g. "vertex" or "face")
+struct PLYElement {
+    /// Name of the element
+    std::string name;
+    /// Number of records stored in the file
+    size_t count = 0;
+    /// Properties of every record, in file order
+    std::vector<PLYProperty> properties;
+
+    /// Return the index of the property with the given name, or -1
+    int find(const std::string &name) const;
+
+    /// Size of one binary record in bytes, or 0 if it contains lists
+    size_t recordSize() const;
+};
+
+/// Return the size in bytes of a PLY scalar type
+extern size_t plyTypeSize(EPLYType type);
+
+/**
+ * \brief Sequential reader for ASCII and binary PLY files
+ *
+ * The constructor parses the header; afterwards the element data is
+ * read value by value through \ref read() in the order given by
+ * \ref getElements(). Binary payloads pass through a fixed-size
+ * buffer, so arbitrarily large files are streamed with bounded memory.
+ */
+class PLYReader {
+public:
+    /// Open a PLY file and parse its header
+    PLYReader(const std::string &filename);
+
+    /// Return the element declarations found in the header
+    const std::vector<PLYElement> &getElements() const { return m_elements; }
+
+    /// Return the index of the element with the given name, or -1
+    int findElement(const std::string &name) const;
+
+    /// Is the payload stored in binary form?
+    bool isBinary() const { return m_binary; }
+
+    /// Read the next value of the given type and convert it to double
+    double read(EPLYType type) {
+        if (!m_binary)
+            return readASCII();
+        char buf[8];
+        readRaw(buf, plyTypeSize(type));
+        return decode(buf, type);
+    }
+
+    /// Read \c size raw payload bytes (binary files only)
+    void readRaw(char *dst, size_t size);
+
+    /// Skip the remainder of a record given the index of its next property
+    void skip(const PLYProperty &prop);
+
+    /// Decode a binary value that was obtained via \ref readRaw()
+    double decode(const char *ptr, EPLYType type) const;
+
+    /// Return the file name (for error messages)
+    const std::string &getFilename() const { return m_filename; }
+
+private:
+    double readASCII();
+    void refill();
+
+private:
+    std::string m_filename;
+    std::ifstream m_is;
+    std::vector<PLYElement> m_elements;
+    bool m_binary = false;
+    bool m_swap = false;
+    std::unique_ptr<char[]> m_buffer;
+    size_t m_pos = 0, m_end = 0;
+};
+
+NORI_NAMESPACE_END
+
+#endif /* __NORI_PLYFILE_H */
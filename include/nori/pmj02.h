@@ -0,0 +1,76 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(__NORI_PMJ02_H)
+#define __NORI_PMJ02_H
+
+#include <nori/common.h>
+#include <memory>
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * \brief Header of a precomputed progressive multi-jittered (0,2)
+ * sequence table (".pmj")
+ *
+ * The header is followed by \c setCount independent sequences of
+ * \c sampleCount points each. A point is stored as two 32-bit fixed
+ * point coordinates (x, y) on <tt>[0, 1)</tt>. Every prefix of a
+ * sequence whose length is a power of two is a (0,m,2)-net. All values
+ * are little endian.
+ */
+struct PMJ02Header {
+    char     magic[4];       ///< "PMJ2"
+    uint32_t version;        ///< Format version (currently 1)
+    uint32_t setCount;       ///< Number of independent sequences
+    uint32_t sampleCount;    ///< Points per sequence (a power of two)
+};
+
+static_assert(sizeof(PMJ02Header) == 16, "Unexpected padding in PMJ02Header");
+
+/**
+ * \brief In-memory PMJ02 table
+ *
+ * Tables are generated offline by the \c pmj02gen tool, which writes
+ * either a ".pmj" file or the C++ source of the table that is compiled
+ * into Nori (see \ref getDefault()).
+ */
+struct PMJ02Table {
+    uint32_t setCount = 0;
+    uint32_t sampleCount = 0;
+    /// Coordinates of all points, set by set
+    std::vector<uint32_t> points;
+
+    /// Return the fixed point coordinates of a point
+    const uint32_t *get(uint32_t set, uint32_t index) const {
+        return &points[2 * ((size_t) set * sampleCount + index)];
+    }
+
+    /// Load a table from a ".pmj" file
+    static std::shared_ptr<PMJ02Table> load(const std::string &filename);
+
+    /// Write the table to a ".pmj" file
+    void save(const std::string &filename) const;
+
+    /// Return the table that is compiled into Nori
+    static std::shared_ptr<const PMJ02Table> getDefault();
+};
+
+NORI_NAMESPACE_END
+
+#endif /* __NORI_PMJ02_H */
@@ -0,0 +1,52 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(__NORI_RIS_H)
+#define __NORI_RIS_H
+
+#include <nori/emitter.h>
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * \brief Sample direct illumination by resampled importance sampling
+ *
+ * Draws \c candidates light samples through the scene's emitter
+ * selection and keeps one of them by weighted reservoir sampling, with
+ * weights given by the unshadowed contribution (luminance of BSDF times
+ * emitted radiance times cosine). Only the kept sample needs a shadow
+ * ray, which the caller traces through \c lRec.shadowRay.
+ *
+ * \param its
+ *     Shading point
+ * \param wi
+ *     Direction towards the previous path vertex (world space)
+ * \param candidates
+ *     Number of candidate samples
+ * \param lRec
+ *     Receives the selected light sample
+ * \return
+ *     The unshadowed contribution of the selected sample divided by its
+ *     effective probability density, or zero if no candidate contributes
+ */
+extern Color3f sampleDirectRIS(const Scene *scene, Sampler *sampler, const Intersection &its,
+                               const Vector3f &wi, int candidates, EmitterQueryRecord &lRec);
+
+NORI_NAMESPACE_END
+
+#endif /* __NORI_RIS_H */
@@ -89,6 +89,18 @@ public:
     /// Advance to the next sample
     virtual void advance() = 0;
 
+    /**
+     * \brief Prepare to generate a specific sample of a pixel
+     *
+     * The renderer calls this function before it traces the sample
+     * with index \c index through the pixel \c pixel, which allows
+     * samplers to key their sample streams by pixel and sample index.
+     * Components are then requested in a fixed order: the 2D position
+     * on the image plane, the 2D aperture sample, followed by whatever
+     * the integrator consumes. The default implementation does nothing.
+     */
+    virtual void startPixelSample(const Point2i &pixel, uint32_t index) { }
+
     /// Retrieve the next component value from the current sample
     virtual float next1D() = 0;
 
@@ -22,6 +22,9 @@
 #include <nori/bvh.h>
 #include <nori/emitter.h>
 #include <nori/medium.h>
+#include <nori/dpdf.h>
+#include <nori/lightbvh.h>
+#include <unordered_map>
 //class Shape;
 
 NORI_NAMESPACE_BEGIN
@@ -65,37 +68,85 @@ public:
     /// Return a reference to an array containing all lights
     const std::vector<Emitter *> &getLights() const { return m_emitters; }
 
-    /// Return a random emitter
-    const Emitter * getRandomEmitter(float rnd) const {
-        auto const & n = m_emitters.size();
-        size_t index = std::min(
-                static_cast<size_t>(std::floor(n*rnd)),
-                n-1);
+    /**
+     * \brief Select an emitter with probability proportional to its
+     * estimated power (see \ref Emitter::getPower())
+     *
+     * \param rnd
+     *     A uniformly distributed sample on [0,1]
+     * \param pdf
+     *     Probability of the selection, to be divided out by the caller
+     */
+    const Emitter *getRandomEmitter(float rnd, float &pdf) const {
+        size_t index = m_emitterPdf.sample(rnd, pdf);
         return m_emitters[index];
     }
+
+    /// Return the probability that \ref getRandomEmitter() selects \c emitter
+    float getEmitterPdf(const Emitter *emitter) const {
+        auto it = m_emitterIndex.find(emitter);
+        return it != m_emitterIndex.end() ? m_emitterPdf[it->second] : 0.f;
+    }
+
+    /**
+     * \brief Select an emitter to illuminate a given shading point
+     *
+     * With <tt>lightSampling = "bvh"</tt>, the choice takes the position
+     * and orientation of the emitters relative to the point into account
+     * (see \ref LightBVH) and may pick a single triangle of an emissive
+     * mesh; otherwise it only depends on the power of the emitters.
+     *
+     * \param n
+     *     Shading normal, or zero for points in participating media
+     * \param lRec
+     *     Record for the following \ref Emitter::sample(), which receives
+     *     the selected primitive (if any)
+     * \return
+     *     The selected emitter, or \c nullptr if none can contribute
+     */
+    const Emitter *getRandomEmitter(const Point3f &p, const Normal3f &n, float rnd, float &pdf,
+                                    EmitterQueryRecord &lRec) const;
+
+    /**
+     * \brief Return the probability that the above function selects
+     * \c emitter (and the primitive \c lRec.primIndex of it)
+     *
+     * Call this before \ref Emitter::pdf(), as it sets
+     * \c lRec.fixedPrimitive to match the selection.
+     */
+    float getEmitterPdf(const Point3f &p, const Normal3f &n, const Emitter *emitter,
+                        EmitterQueryRecord &lRec) const;
+
     const std::vector<Medium *>& getMedia() const { return m_media; }
 
     const std::vector<Medium*>& getEmissiveMedia() const { return m_emissiveMedia; }
 
-    const Medium * getRandomEmissiveMedia(float rnd) const {
-        auto const& n = m_emissiveMedia.size();
-        size_t index = std::min(
-            static_cast<size_t>(std::floor(n * rnd)),
-            n - 1);
+    /// Select an emissive medium with probability proportional to its estimated power
+    const Medium *getRandomEmissiveMedia(float rnd, float &pdf) const {
+        size_t index = m_emissiveMediaPdf.sample(rnd, pdf);
         return m_emissiveMedia[index];
     }
 
-    //determine whether to sample the emitters or the emissive media
-    const bool sampleEmitter(float rnd) const {
-        int n_emitters = m_emitters.size();
-        int n_emissiveMedia = m_emissiveMedia.size();
-        int total = n_emitters + n_emissiveMedia;
-        int index = std::min(
-            static_cast<int>(std::floor(total * rnd)),
-            total - 1);
-        return index < m_emitters.size();
+    /**
+     * \brief Determine whether to sample the emitters or the emissive media
+     *
+     * The choice is proportional to the total power of both groups, so that
+     * together with \ref getRandomEmitter() and \ref getRandomEmissiveMedia()
+     * every light source is chosen in proportion to its power.
+     *
+     * \param pdf
+     *     Probability of the returned choice
+     * \return \c true if an emitter should be sampled
+     */
+    bool sampleEmitter(float rnd, float &pdf) const {
+        bool emitter = rnd < m_emitterFraction;
+        pdf = emitter ? m_emitterFraction : 1.f - m_emitterFraction;
+        return emitter;
     }
 
+    /// Return the probability that \ref sampleEmitter() chooses the emitters
+    float getEmitterFraction() const { return m_emitterFraction; }
+
     /**
      * \brief Intersect a ray against all triangles stored in the scene
      * and return detailed intersection information
@@ -114,6 +165,30 @@ public:
         return m_bvh->rayIntersect(ray, its, false);
     }
 
+    /**
+     * \brief Intersect a ray against all triangles stored in the scene,
+     * passing through invisible interfaces (e.g. medium boundaries with a
+     * null BSDF)
+     *
+     * \param ray
+     *    A 3-dimensional ray data structure with minimum/maximum
+     *    extent information
+     *
+     * \param its
+     *    A detailed intersection record for the first real surface,
+     *    which will be filled by the intersection query
+     *
+     * \param crossings
+     *    Ordered list of the invisible interfaces crossed in front of
+     *    the first real surface
+     *
+     * \return \c true if an intersection with a real surface was found
+     */
+    bool rayIntersect(const Ray3f &ray, Intersection &its,
+                      std::vector<MediumCrossing> &crossings) const {
+        return m_bvh->rayIntersect(ray, its, crossings);
+    }
+
     /**
      * \brief Intersect a ray against all triangles stored in the scene
      * and \a only determine whether or not there is an intersection.
@@ -134,10 +209,48 @@ public:
         return m_bvh->rayIntersect(ray, its, true);
     }
 
-    bool rayCurrIntersect(const Ray3f& ray, const Shape *shape) const {
-        Intersection its; /* Unused */
-        return m_bvh->rayCurrIntersect(ray, its, true, shape);
+    /**
+     * \brief Estimate the transmittance along a shadow ray
+     *
+     * Unlike the binary \ref rayIntersect(), the ray passes through
+     * invisible interfaces (e.g. medium boundaries with a null BSDF) and
+     * the transmittance of every participating medium along the way is
+     * estimated through \ref Medium::Tr(). Media are assumed not to
+     * overlap: leaving a medium returns the ray to vacuum.
+     *
+     * \param ray
+     *    A 3-dimensional ray data structure with minimum/maximum
+     *    extent information
+     *
+     * \param medium
+     *    Medium that contains the ray origin (may be \c nullptr)
+     *
+     * \return The estimated transmittance, zero if a real surface
+     *    blocks the ray
+     */
+    Color3f transmittance(const Ray3f &ray, Sampler *sampler, const Medium *medium) const;
+
+    /**
+     * \brief Return the medium that a shadow ray leaving a surface starts in
+     *
+     * \param its
+     *    The surface that the shadow ray leaves
+     *
+     * \param d
+     *    Direction of the shadow ray
+     *
+     * \param medium
+     *    Medium through which the path arrived at the surface
+     */
+    static const Medium *getShadowMedium(const Intersection &its, const Vector3f &d, const Medium *medium) {
+        const Medium *inside = its.mesh->getMedium();
+        if (!inside)
+            return medium;
+        if (its.shFrame.n.dot(d) < 0.0f)
+            return inside;
+        return inside == medium ? nullptr : medium;
     }
+
     /**
      * \brief Return an axis-aligned box that bounds the scene
      */
@@ -164,6 +277,9 @@ public:
 
     virtual EClassType getClassType() const override { return EScene; }
 private:
+    /// Build the power-proportional light selection distributions
+    void buildLightDistributions();
+
     std::vector<Shape *> m_shapes;
     std::vector<Medium*> m_media;
     std::vector<Medium*> m_emissiveMedia;
@@ -173,6 +289,14 @@ private:
     BVH *m_bvh = nullptr;
     Medium* m_cameraMedium = nullptr;
     std::vector<Emitter *> m_emitters;
+
+    /* Power-proportional light selection, built by activate() */
+    DiscretePDF m_emitterPdf;
+    DiscretePDF m_emissiveMediaPdf;
+    std::unordered_map<const Emitter *, size_t> m_emitterIndex;
+    float m_emitterFraction = 1.f;
+    LightBVH *m_lightBVH = nullptr;
+    bool m_useLightBVH = false;
 };
 
 NORI_NAMESPACE_END
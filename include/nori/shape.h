@@ -48,9 +48,11 @@ struct Intersection {
     Frame geoFrame;
     /// Pointer to the associated shape
     const Shape *mesh;
+    /// Index of the intersected primitive within the shape
+    uint32_t primIndex;
 
     /// Create an uninitialized intersection record
-    Intersection() : mesh(nullptr) { }
+    Intersection() : mesh(nullptr), primIndex(0) { }
 
     /// Transform a direction vector into the local shading frame
     Vector3f toLocal(const Vector3f &d) const {
@@ -68,6 +70,27 @@ struct Intersection {
 
 
 
+/**
+ * \brief Crossing of an invisible (null) interface along a ray
+ *
+ * Records where a ray passes through a surface whose BSDF does not
+ * interact with light, along with the medium that is entered or left
+ * at that point. See \ref BVH::rayIntersect().
+ */
+struct MediumCrossing {
+    /// Distance along the ray
+    float t;
+    /// Position of the crossing
+    Point3f p;
+    /// Pointer to the crossed shape
+    const Shape *mesh;
+    /// Medium bounded by the crossed shape (may be \c nullptr)
+    const Medium *medium;
+    /// Does the ray enter the shape (i.e. travel against the shading normal)?
+    bool entering;
+};
+
+
 /**
  * \brief Data record for conveniently querying and sampling the
  * a point on a shape
@@ -81,13 +104,25 @@ struct ShapeQueryRecord {
     Normal3f n;
     /// Probability of the sample
     float pdf;
+    /// Index of the primitive that contains \c p
+    uint32_t primIndex;
+    /// Is \c ref valid? Without it, shapes sample uniformly by area
+    bool hasRef;
+    /**
+     * \brief Sample only the primitive \c primIndex, with a density
+     * conditional on it (see \ref Shape::canSamplePrimitives())
+     */
+    bool fixedPrimitive;
 
     /// Empty constructor
-    ShapeQueryRecord() {}
+    ShapeQueryRecord() : primIndex(0), hasRef(false), fixedPrimitive(false) {}
     /// Data structure with ref to call sampleSurface()
-    ShapeQueryRecord(const Point3f & ref_) : ref(ref_) {}
+    ShapeQueryRecord(const Point3f & ref_) : ref(ref_), primIndex(0), hasRef(true), fixedPrimitive(false) {}
     /// Data structure with ref and p to call pdfSurface()
-    ShapeQueryRecord(const Point3f & ref_, const Point3f & p_) : ref(ref_), p(p_) {}
+    ShapeQueryRecord(const Point3f & ref_, const Point3f & p_) : ref(ref_), p(p_), primIndex(0), hasRef(true), fixedPrimitive(false) {}
+    /// Data structure with ref, p, n and the primitive index to call pdfSurface()
+    ShapeQueryRecord(const Point3f & ref_, const Point3f & p_, const Normal3f & n_, uint32_t primIndex_)
+        : ref(ref_), p(p_), n(n_), primIndex(primIndex_), hasRef(true), fixedPrimitive(false) {}
 
 };
 
@@ -129,6 +164,12 @@ public:
     /// Return a pointer to the BSDF associated with this mesh
     const BSDF *getBSDF() const { return m_bsdf; }
 
+    /**
+     * \brief Is this shape an invisible interface (a null BSDF without
+     * an attached emitter) that rays may pass through unchanged?
+     */
+    bool isNullInterface() const;
+
 
 
     /// Return the total number of primitives in this shape
@@ -146,18 +187,73 @@ public:
     /// Set the intersection information: hit point, shading frame, UVs, etc.
     virtual void setHitInformation(uint32_t index, const Ray3f &ray, Intersection & its) const = 0;
 
+    /**
+     * \brief Reorder the primitives of this shape for memory locality
+     *
+     * Called once the BVH has been built, with the primitive indices in
+     * the order in which the BVH leaves reference them. A shape that
+     * adopts the order returns \c true; primitive \c i must then be the
+     * former primitive \c order[i]. The default implementation keeps
+     * the original order.
+     */
+    virtual bool reorderPrimitives(const std::vector<uint32_t> &order) { return false; }
+
     /**
      * \brief Sample a point on the surface (potentially using the point sRec.ref to importance sample)
-     * This method should set sRec.p, sRec.n and sRec.pdf
+     * This method should set sRec.p, sRec.n, sRec.pdf and sRec.primIndex
      * Probability should be with respect to area
      * */
     virtual void sampleSurface(ShapeQueryRecord & sRec, const Point2f & sample) const = 0;
     /**
      * \brief Return the probability of sampling a point sRec.p by the sampleSurface() method (sRec.ref should be set before)
-     * sRec.n and sRec.pdf are ignored
+     * Shapes that sample by solid angle also read sRec.n and sRec.primIndex
+     * to convert their density to area measure; sRec.pdf is ignored
      * */
     virtual float pdfSurface(const ShapeQueryRecord & sRec) const = 0;
 
+    /**
+     * \brief Return the total surface area of the shape
+     *
+     * The default implementation assumes that \ref sampleSurface() is
+     * uniform with respect to area when no reference point is given.
+     * */
+    virtual float getSurfaceArea() const {
+        ShapeQueryRecord sRec;
+        sampleSurface(sRec, Point2f(0.5f));
+        return sRec.pdf > 0.f ? 1.f / sRec.pdf : 0.f;
+    }
+
+    /**
+     * \brief Return a cone that contains all surface normals
+     *
+     * \param axis
+     *     Axis of the cone
+     * \param cosTheta
+     *     Cosine of its half-angle; the default implementation returns
+     *     the entire sphere of directions (-1)
+     * */
+    virtual void getNormalCone(Vector3f &axis, float &cosTheta) const {
+        axis = Vector3f(0.f, 0.f, 1.f);
+        cosTheta = -1.f;
+    }
+
+    /**
+     * \brief Can \ref sampleSurface() and \ref pdfSurface() be restricted
+     * to a single primitive (see \ref ShapeQueryRecord::fixedPrimitive)?
+     *
+     * The light hierarchy then bounds and selects the primitives of an
+     * emissive shape individually.
+     * */
+    virtual bool canSamplePrimitives() const { return false; }
+
+    /// Return the surface area of a primitive
+    virtual float getPrimitiveArea(uint32_t index) const { return getSurfaceArea(); }
+
+    /// Return a cone that contains the surface normals of a primitive
+    virtual void getPrimitiveNormalCone(uint32_t index, Vector3f &axis, float &cosTheta) const {
+        getNormalCone(axis, cosTheta);
+    }
+
     //virtual void sampleVolume(ShapeQueryRecord& sRec, const Point3f& sample) const { this->getBoundingBox().sampleVolume(sRec, sample); }
     virtual void sampleVolume(ShapeQueryRecord& sRec, const Point3f& sample) const {
         BoundingBox3f bbox = this->getBoundingBox();
@@ -170,6 +266,15 @@ public:
     }
     /* return sRec.pdf and sRec.p*/
     virtual float pdfVolume(ShapeQueryRecord& sRec) const { return 0.f; }
+
+    /**
+     * \brief Check whether a point lies inside the volume enclosed by the shape
+     *
+     * Used to decide whether points sampled inside the bounding box of a
+     * medium actually belong to it. The default implementation only tests
+     * against the bounding box.
+     */
+    virtual bool contains(const Point3f &p) const { return m_bbox.contains(p); }
     /**
      * \brief Return the type of object (i.e. Mesh/BSDF/etc.)
      * provided by this instance
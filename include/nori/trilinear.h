@@ -0,0 +1,118 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(__NORI_TRILINEAR_H)
+#define __NORI_TRILINEAR_H
+
+#include <nori/common.h>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#  include <emmintrin.h>
+#  define NORI_TRILINEAR_SSE 1
+#endif
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * \brief Trilinear interpolation of one channel
+ *
+ * Kept scalar: with a single channel the cost is dominated by the eight
+ * scattered loads, and shuffling them into a register is not faster.
+ *
+ * \param c
+ *     Values at the corners of the cell in the order c000, c001, c010,
+ *     c011, c100, c101, c110, c111 (offsets along z, y and x)
+ * \param xd, yd, zd
+ *     Position inside the cell on <tt>[0, 1]^3</tt>
+ */
+inline float trilinear(const float c[8], float xd, float yd, float zd) {
+    float c00 = c[0] + (c[1] - c[0]) * xd;
+    float c01 = c[2] + (c[3] - c[2]) * xd;
+    float c10 = c[4] + (c[5] - c[4]) * xd;
+    float c11 = c[6] + (c[7] - c[6]) * xd;
+    float c0 = c00 + (c01 - c00) * yd;
+    float c1 = c10 + (c11 - c10) * yd;
+    return c0 + (c1 - c0) * zd;
+}
+
+/**
+ * \brief Trilinear interpolation of up to eight interleaved channels
+ *
+ * All channels of a voxel are interpolated together, four per SIMD
+ * register, so that a cell is only located and fetched once no matter
+ * how many channels are needed.
+ *
+ * \param corners
+ *     Pointers to the channels of the voxels at the corners of the cell,
+ *     in the order of \ref trilinear(). A null pointer stands for a voxel
+ *     whose channels are all zero.
+ * \param channels
+ *     Number of channels per voxel, at most 8
+ * \param out
+ *     Receives the interpolated channels
+ */
+inline void trilinearChannels(const float *const corners[8], int channels,
+                              float xd, float yd, float zd, float *out) {
+#if defined(NORI_TRILINEAR_SSE)
+    __m128 wx = _mm_set1_ps(xd), wy = _mm_set1_ps(yd), wz = _mm_set1_ps(zd);
+    for (int lane = 0; lane < channels; lane += 4) {
+        int n = std::min(channels - lane, 4);
+        __m128 v[8];
+        for (int i = 0; i < 8; ++i) {
+            const float *src = corners[i];
+            if (!src) {
+                v[i] = _mm_setzero_ps();
+            } else if (n == 4) {
+                v[i] = _mm_loadu_ps(src + lane);
+            } else {
+                float tmp[4] = { 0.f, 0.f, 0.f, 0.f };
+                for (int k = 0; k < n; ++k)
+                    tmp[k] = src[lane + k];
+                v[i] = _mm_loadu_ps(tmp);
+            }
+        }
+        __m128 c00 = _mm_add_ps(v[0], _mm_mul_ps(_mm_sub_ps(v[1], v[0]), wx));
+        __m128 c01 = _mm_add_ps(v[2], _mm_mul_ps(_mm_sub_ps(v[3], v[2]), wx));
+        __m128 c10 = _mm_add_ps(v[4], _mm_mul_ps(_mm_sub_ps(v[5], v[4]), wx));
+        __m128 c11 = _mm_add_ps(v[6], _mm_mul_ps(_mm_sub_ps(v[7], v[6]), wx));
+        __m128 c0 = _mm_add_ps(c00, _mm_mul_ps(_mm_sub_ps(c01, c00), wy));
+        __m128 c1 = _mm_add_ps(c10, _mm_mul_ps(_mm_sub_ps(c11, c10), wy));
+        __m128 r = _mm_add_ps(c0, _mm_mul_ps(_mm_sub_ps(c1, c0), wz));
+        if (n == 4) {
+            _mm_storeu_ps(out + lane, r);
+        } else {
+            float tmp[4];
+            _mm_storeu_ps(tmp, r);
+            for (int k = 0; k < n; ++k)
+                out[lane + k] = tmp[k];
+        }
+    }
+#else
+    for (int k = 0; k < channels; ++k) {
+        float c[8];
+        for (int i = 0; i < 8; ++i)
+            c[i] = corners[i] ? corners[i][k] : 0.f;
+        out[k] = trilinear(c, xd, yd, zd);
+    }
+#endif
+}
+
+NORI_NAMESPACE_END
+
+#endif /* __NORI_TRILINEAR_H */
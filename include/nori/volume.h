@@ -3,17 +3,49 @@
 #include <nori/object.h>
 #include <nori/warp.h>
 #include <nori/medium.h>
+#include <nori/bbox.h>
 
 NORI_NAMESPACE_BEGIN
 
+/// Coefficients of a heterogeneous medium at one point, see \ref Volume::lookupMedium()
+struct MediumSample {
+	/// Extinction coefficient (before the medium's scale)
+	float sigmaT = 0.f;
+	/// Single-scattering albedo
+	Color3f albedo = Color3f(0.f);
+	/// Emitted radiance
+	Color3f radiance = Color3f(0.f);
+};
 
 class Volume : public NoriObject {
 public:
 	virtual float lookupFloat(const Point3f& p) const = 0;
 	virtual Color3f lookupRGB(const Point3f& p) const = 0;
+	/**
+	 * \brief Return conservative bounds of \ref lookupFloat() inside a box
+	 *
+	 * Used to build the majorant grids of the heterogeneous media. The
+	 * default assumes values normalized to [0, 1].
+	 */
+	virtual void lookupBounds(const BoundingBox3f& box, float& minValue, float& maxValue) const {
+		minValue = 0.f;
+		maxValue = 1.f;
+	}
+	/**
+	 * \brief Fused lookup of all coefficients of a packed volume
+	 *
+	 * Packed volumes store the extinction in channel 0, the albedo in
+	 * channels 1-3 and optionally the radiance in channels 4-6 (or a gray
+	 * radiance in channel 4), so that a medium fetches and interpolates the
+	 * surrounding cell once per collision instead of once per coefficient.
+	 */
+	virtual void lookupMedium(const Point3f& p, MediumSample& sample) const {
+		throw NoriException("Volume::lookupMedium(): %s is not a packed volume!", toString());
+	}
 	EClassType getClassType() const override{ return EVolume; }
 	virtual void setMedium(const Medium* medium) { m_medium = medium; }
 	virtual bool isPerlin() { return false; }
+	/// Called by the medium once its shape (and hence the volume's extent) is known
 	virtual void gridGeneration() {}
 protected:
 	const Medium * m_medium = nullptr;
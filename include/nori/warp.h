@@ -84,6 +84,20 @@ public:
 
     static Vector3f squareToUniformTriangle(const Point2f &sample);
 
+    /**
+     * \brief Uniformly sample a direction inside the spherical triangle
+     * spanned by the unit vectors 'a', 'b' and 'c' (Arvo's method)
+     */
+    static Vector3f squareToSphericalTriangle(const Point2f &sample,
+        const Vector3f &a, const Vector3f &b, const Vector3f &c);
+
+    /// Probability density of \ref squareToSphericalTriangle()
+    static float squareToSphericalTrianglePdf(const Vector3f &v,
+        const Vector3f &a, const Vector3f &b, const Vector3f &c);
+
+    /// Solid angle of the spherical triangle spanned by the unit vectors 'a', 'b' and 'c'
+    static float sphericalTriangleArea(const Vector3f &a, const Vector3f &b, const Vector3f &c);
+
 };
 
 NORI_NAMESPACE_END
@@ -52,9 +52,12 @@ public:
             throw NoriException("There is no shape attached to this Area light!");
 
         ShapeQueryRecord sRec(lRec.ref);
+        sRec.primIndex = lRec.primIndex;
+        sRec.fixedPrimitive = lRec.fixedPrimitive;
         m_shape->sampleSurface(sRec, sample);
         lRec.p = sRec.p;
         lRec.n = sRec.n;
+        lRec.primIndex = sRec.primIndex;
         lRec.wi = (lRec.p - lRec.ref).normalized();
         lRec.shadowRay = Ray3f(lRec.ref, lRec.wi, Epsilon, (lRec.p - lRec.ref).norm()-Epsilon);
         lRec.pdf = pdf(lRec);
@@ -72,7 +75,8 @@ public:
 
         float cosTheta = lRec.n.dot(-lRec.wi);
         if (cosTheta > 0.f) {
-            ShapeQueryRecord sRec(lRec.ref, lRec.p);
+            ShapeQueryRecord sRec(lRec.ref, lRec.p, lRec.n, lRec.primIndex);
+            sRec.fixedPrimitive = lRec.fixedPrimitive;
             return m_shape->pdfSurface(sRec) * (lRec.p - lRec.ref).squaredNorm() / cosTheta;
         } else {
             return 0.f;
@@ -97,6 +101,46 @@ public:
         return m_radiance * M_PI / sRec.pdf;
     }
 
+    virtual Color3f getPower() const override {
+        if(!m_shape)
+            throw NoriException("There is no shape attached to this Area light!");
+
+        /* One-sided diffuse emission */
+        return m_radiance * M_PI * m_shape->getSurfaceArea();
+    }
+
+    virtual LightBounds getLightBounds(float power) const override {
+        if(!m_shape)
+            throw NoriException("There is no shape attached to this Area light!");
+
+        LightBounds lb;
+        lb.bounds = m_shape->getBoundingBox();
+        lb.phi = power;
+        m_shape->getNormalCone(lb.w, lb.cosTheta_o);
+        lb.cosTheta_e = 0.f; /* Emission covers the hemisphere around the normal */
+        return lb;
+    }
+
+    virtual uint32_t getPrimitiveLightCount() const override {
+        if(!m_shape)
+            throw NoriException("There is no shape attached to this Area light!");
+
+        return m_shape->canSamplePrimitives() ? m_shape->getPrimitiveCount() : 1;
+    }
+
+    virtual LightBounds getPrimitiveLightBounds(uint32_t primIndex, float power) const override {
+        if (!m_shape->canSamplePrimitives())
+            return getLightBounds(power);
+
+        /* The radiance is uniform, so the power splits by area */
+        LightBounds lb;
+        lb.bounds = m_shape->getBoundingBox(primIndex);
+        lb.phi = power * m_shape->getPrimitiveArea(primIndex) / m_shape->getSurfaceArea();
+        m_shape->getPrimitiveNormalCone(primIndex, lb.w, lb.cosTheta_o);
+        lb.cosTheta_e = 0.f;
+        return lb;
+    }
+
     virtual bool onSurface() const { return true; }
 
 
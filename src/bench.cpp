@@ -0,0 +1,582 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/dpdf.h>
+#include <nori/timer.h>
+#include <nori/sampler.h>
+#include <nori/proplist.h>
+#include <nori/majorant.h>
+#include <nori/volume.h>
+#include <nori/brickgrid.h>
+#include <nori/trilinear.h>
+#include <nori/mesh.h>
+#include <nori/bvh.h>
+#include <pcg32.h>
+#include <functional>
+#include <map>
+
+using namespace nori;
+
+/* Micro-benchmarks for performance-critical building blocks */
+
+/// Prevents the compiler from discarding the benchmarked computation
+static volatile size_t sink;
+
+/// Run \c fn on \c count samples and print the average time per sample
+static void measure(const std::string &name, size_t count, const std::function<size_t(float)> &fn) {
+    pcg32 rng;
+    size_t acc = 0;
+    Timer timer;
+    for (size_t i = 0; i < count; ++i)
+        acc += fn(rng.nextFloat());
+    double ms = timer.elapsed();
+    sink = acc;
+    cout << tfm::format("  %-14s %8.2f ns/sample\n", name, ms * 1e6 / (double) count);
+}
+
+/* Compares CDF inversion and alias table lookups of DiscretePDF */
+static int benchDiscretePDF(const std::vector<std::string> &args) {
+    size_t entries = args.size() > 0 ? (size_t) std::stoull(args[0]) : 1000000;
+    size_t samples = args.size() > 1 ? (size_t) std::stoull(args[1]) : 10000000;
+
+    const char *names[] = { "uniform", "random", "power law" };
+    for (int type = 0; type < 3; ++type) {
+        pcg32 rng(7, type);
+        DiscretePDF pdf(entries);
+        for (size_t i = 0; i < entries; ++i) {
+            float weight = 1.0f;
+            if (type == 1)
+                weight = rng.nextFloat();
+            else if (type == 2)
+                weight = 1.0f / std::pow((float) (i + 1), 1.5f);
+            pdf.append(weight);
+        }
+
+        Timer timer;
+        pdf.normalize();
+        cout << tfm::format("%s weights, %i entries (normalize + alias table: %s)\n",
+            names[type], entries, timer.elapsedString(true));
+
+        measure("sampleCDF", samples, [&](float u) { return pdf.sampleCDF(u); });
+        measure("sample", samples, [&](float u) { return pdf.sample(u); });
+        measure("sampleReuse", samples, [&](float u) {
+            size_t index = pdf.sampleReuse(u);
+            return index + (size_t) (u * 2);
+        });
+    }
+    return 0;
+}
+
+/* Compares the convergence of the samplers on integrands with known values */
+static int benchSamplers(const std::vector<std::string> &args) {
+    std::vector<std::string> types = { "independent", "sobol", "pmj02" };
+    if (!args.empty())
+        types = args;
+    const int trials = 1024, maxSamples = 1024;
+
+    /* Each integrand consumes three 2D samples, like a camera ray
+       followed by one bounce, and has the expected value 1 */
+    struct Integrand { const char *name; std::function<float(const Point2f *)> f; };
+    std::vector<Integrand> integrands = {
+        { "smooth", [](const Point2f *u) {
+            return (u[0].x() + u[0].y()) * (u[1].x() + u[1].y()) * (u[2].x() + u[2].y()); } },
+        { "disk", [](const Point2f *u) {
+            return u[0].squaredNorm() < 1.f ? (float) (4.0 / M_PI) : 0.f; } },
+        { "edges", [](const Point2f *u) {
+            return (u[0].x() < u[1].y() ? 2.f : 0.f) * (u[2].x() + u[2].y() < 1.f ? 2.f : 0.f); } }
+    };
+
+    for (const Integrand &integrand : integrands) {
+        cout << tfm::format("%s integrand, RMSE over %i pixels\n", integrand.name, trials);
+        cout << tfm::format("  %6s", "spp");
+        for (const std::string &type : types)
+            cout << tfm::format(" %12s", type);
+        cout << endl;
+
+        std::vector<std::vector<double>> errors(types.size());
+        for (size_t t = 0; t < types.size(); ++t) {
+            PropertyList props;
+            props.setInteger("sampleCount", maxSamples);
+            std::unique_ptr<Sampler> sampler(static_cast<Sampler *>(
+                NoriObjectFactory::createInstance(types[t], props)));
+
+            std::vector<double> sqErr;
+            for (int trial = 0; trial < trials; ++trial) {
+                double sum = 0;
+                sampler->generate();
+                for (int k = 1; k <= maxSamples; ++k) {
+                    sampler->startPixelSample(Point2i(trial, 0), (uint32_t) k - 1);
+                    Point2f u[3];
+                    for (int i = 0; i < 3; ++i)
+                        u[i] = sampler->next2D();
+                    sum += integrand.f(u);
+                    sampler->advance();
+                    if ((k & (k - 1)) == 0) {
+                        int level = 0;
+                        while ((1 << level) < k)
+                            ++level;
+                        if ((int) sqErr.size() <= level)
+                            sqErr.resize(level + 1, 0.0);
+                        double err = sum / k - 1.0;
+                        sqErr[level] += err * err;
+                    }
+                }
+            }
+            for (double e : sqErr)
+                errors[t].push_back(std::sqrt(e / trials));
+        }
+
+        for (size_t level = 0; level < errors[0].size(); ++level) {
+            cout << tfm::format("  %6i", 1 << level);
+            for (size_t t = 0; t < types.size(); ++t)
+                cout << tfm::format(" %12.6f", errors[t][level]);
+            cout << endl;
+        }
+    }
+    return 0;
+}
+
+/* Measures how much of the error of the Sobol sampler is removed by a
+   small blur with and without the blue noise mode */
+static int benchBlueNoise(const std::vector<std::string> &args) {
+    const int size = 128, radius = 1;
+    std::vector<int> sampleCounts = { 1, 2, 4, 8, 16 };
+    if (!args.empty())
+        sampleCounts = { std::stoi(args[0]) };
+
+    cout << tfm::format("Error of a %ix%i image of a 2D disk integrand (raw / after a %ix%i box filter)\n",
+                        size, size, 2 * radius + 1, 2 * radius + 1);
+    cout << tfm::format("  %6s %21s %21s\n", "spp", "sobol", "sobol (blue noise)");
+    for (int spp : sampleCounts) {
+        cout << tfm::format("  %6i", spp);
+        for (int blueNoise = 0; blueNoise < 2; ++blueNoise) {
+            PropertyList props;
+            props.setInteger("sampleCount", spp);
+            props.setBoolean("blueNoise", blueNoise != 0);
+            std::unique_ptr<Sampler> sampler(static_cast<Sampler *>(
+                NoriObjectFactory::createInstance("sobol", props)));
+
+            std::vector<double> error(size * size);
+            for (int y = 0; y < size; ++y) {
+                for (int x = 0; x < size; ++x) {
+                    double sum = 0;
+                    for (int k = 0; k < spp; ++k) {
+                        sampler->startPixelSample(Point2i(x, y), (uint32_t) k);
+                        sum += sampler->next2D().squaredNorm() < 1.f ? 4.0 / M_PI : 0.0;
+                    }
+                    error[y * size + x] = sum / spp - 1.0;
+                }
+            }
+
+            double raw = 0, filtered = 0;
+            for (int y = 0; y < size; ++y) {
+                for (int x = 0; x < size; ++x) {
+                    double sum = 0;
+                    for (int dy = -radius; dy <= radius; ++dy)
+                        for (int dx = -radius; dx <= radius; ++dx)
+                            sum += error[mod(y + dy, size) * size + mod(x + dx, size)];
+                    sum /= (2 * radius + 1) * (2 * radius + 1);
+                    raw += error[y * size + x] * error[y * size + x];
+                    filtered += sum * sum;
+                }
+            }
+            cout << tfm::format(" %10.5f / %8.5f", std::sqrt(raw / (size * size)),
+                                std::sqrt(filtered / (size * size)));
+        }
+        cout << endl;
+    }
+    return 0;
+}
+
+/// Sparse smoke-like density: a few Gaussian puffs in the unit cube
+class PuffVolume : public nori::Volume {
+public:
+    PuffVolume() {
+        pcg32 rng;
+        for (int i = 0; i < 6; ++i)
+            m_puffs.push_back(Vector4f(0.3f + 0.4f * rng.nextFloat(), 0.3f + 0.4f * rng.nextFloat(),
+                                       0.3f + 0.4f * rng.nextFloat(), 0.03f + 0.04f * rng.nextFloat()));
+    }
+    float lookupFloat(const Point3f &p) const override {
+        float sum = 0;
+        for (const Vector4f &puff : m_puffs)
+            sum += std::exp(-(p - puff.head<3>()).squaredNorm() / (2 * puff.w() * puff.w()));
+        return std::min(sum, 1.f);
+    }
+    Color3f lookupRGB(const Point3f &) const override { return Color3f(0.f); }
+    void lookupBounds(const BoundingBox3f &box, float &minValue, float &maxValue) const override {
+        minValue = maxValue = 0.f;
+        for (const Vector4f &puff : m_puffs) {
+            Point3f c = puff.head<3>();
+            float near = box.squaredDistanceTo(c), far = 0;
+            for (int i = 0; i < 3; ++i)
+                far += std::pow(std::max(std::abs(c[i] - box.min[i]), std::abs(c[i] - box.max[i])), 2.f);
+            float s = 2 * puff.w() * puff.w();
+            minValue += std::exp(-far / s);
+            maxValue += std::exp(-near / s);
+        }
+        minValue = std::min(minValue, 1.f);
+        maxValue = std::min(maxValue, 1.f);
+    }
+    std::string toString() const override { return "PuffVolume[]"; }
+private:
+    std::vector<Vector4f> m_puffs;
+};
+
+/* Counts the null collisions of delta tracking through a sparse medium
+   for different majorant grid resolutions */
+static int benchMajorant(const std::vector<std::string> &args) {
+    size_t rays = args.size() > 0 ? (size_t) std::stoull(args[0]) : 1000000;
+    const float scale = 20.f;
+    PuffVolume volume;
+    BoundingBox3f bbox(Point3f(0.f), Point3f(1.f));
+    std::unique_ptr<Sampler> sampler(static_cast<Sampler *>(
+        NoriObjectFactory::createInstance("independent", PropertyList())));
+
+    cout << tfm::format("Delta tracking of %i rays through a sparse medium (scale %.0f)\n", rays, scale);
+    cout << tfm::format("  %6s %10s %12s %12s %14s\n", "res", "empty", "null/ray", "escaped", "time/ray");
+    for (int res : { 1, 4, 8, 16, 32, 64 }) {
+        MajorantGrid grid;
+        grid.build(&volume, bbox, scale, res);
+        pcg32 rng;
+        uint64_t nullCollisions = 0, escaped = 0;
+        Timer timer;
+        for (size_t i = 0; i < rays; ++i) {
+            Point3f o = bbox.getCenter() + Warp::squareToUniformSphere(Point2f(rng.nextFloat(), rng.nextFloat())) * 2.f;
+            Point3f target(rng.nextFloat(), rng.nextFloat(), rng.nextFloat());
+            Ray3f ray(o, (target - o).normalized());
+            float mint, maxt;
+            if (!bbox.rayIntersect(ray, mint, maxt))
+                continue;
+            escaped += trackMajorant(grid, ray, mint, maxt, sampler.get(), [&](float t, float majorant) {
+                if (volume.lookupFloat(ray(t)) * scale > majorant * sampler->next1D())
+                    return false;
+                nullCollisions++;
+                return true;
+            });
+        }
+        double ms = timer.elapsed();
+        size_t empty = 0;
+        for (int z = 0; z < res; ++z)
+            for (int y = 0; y < res; ++y)
+                for (int x = 0; x < res; ++x) {
+                    int cell[3] = { x, y, z };
+                    empty += grid.getMajorant(cell) == 0;
+                }
+        cout << tfm::format("  %6i %9.1f%% %12.3f %12.5f %11.1f ns\n", res,
+                            100.0 * empty / ((double) res * res * res),
+                            nullCollisions / (double) rays, escaped / (double) rays, ms * 1e6 / rays);
+    }
+    return 0;
+}
+
+/* Compares memory use and trilinear lookup throughput of dense and
+   sparse brick storage on a smoke-like grid */
+static int benchBricks(const std::vector<std::string> &args) {
+    int res = args.size() > 0 ? std::stoi(args[0]) : 256;
+    size_t lookups = args.size() > 1 ? (size_t) std::stoull(args[1]) : 10000000;
+
+    /* Rasterize the puffs, cutting off their tails like a simulation cache */
+    PuffVolume volume;
+    std::vector<float> dense((size_t) res * res * res);
+    for (int z = 0; z < res; ++z)
+        for (int y = 0; y < res; ++y)
+            for (int x = 0; x < res; ++x) {
+                float value = volume.lookupFloat(Point3f(x, y, z) / (float) (res - 1));
+                dense[((size_t) z * res + y) * res + x] = value > 1e-3f ? value : 0.f;
+            }
+
+    BrickGrid bricks;
+    bricks.build(dense.data(), res, res, res, 1);
+    cout << tfm::format("%i^3 grid: %i of %i bricks stored, %s instead of %s (%.1f%%)\n", res,
+                        bricks.getBrickCount(), bricks.getTableSize(), memString(bricks.getMemoryUsage()),
+                        memString(dense.size() * sizeof(float)),
+                        100.0 * bricks.getMemoryUsage() / (dense.size() * sizeof(float)));
+
+    auto lerp = [](const float c[8], float xd, float yd, float zd) {
+        float c0 = (c[0] * (1 - xd) + c[1] * xd) * (1 - yd) + (c[2] * (1 - xd) + c[3] * xd) * yd;
+        float c1 = (c[4] * (1 - xd) + c[5] * xd) * (1 - yd) + (c[6] * (1 - xd) + c[7] * xd) * yd;
+        return c0 * (1 - zd) + c1 * zd;
+    };
+    auto lookup = [&](bool sparse, const Point3f &p) {
+        Point3f g = p * (float) (res - 1);
+        int x = std::min((int) g.x(), res - 2), y = std::min((int) g.y(), res - 2), z = std::min((int) g.z(), res - 2);
+        float c[8];
+        if (sparse) {
+            bricks.fetchCell(x, y, z, 0, c);
+        } else {
+            for (int i = 0; i < 8; ++i)
+                c[i] = dense[((size_t) (z + (i >> 2)) * res + y + ((i >> 1) & 1)) * res + x + (i & 1)];
+        }
+        return lerp(c, g.x() - x, g.y() - y, g.z() - z);
+    };
+
+    /* Both storages must interpolate identically */
+    pcg32 rng;
+    float maxError = 0;
+    for (int i = 0; i < 100000; ++i) {
+        Point3f p(rng.nextFloat(), rng.nextFloat(), rng.nextFloat());
+        maxError = std::max(maxError, std::abs(lookup(true, p) - lookup(false, p)));
+    }
+    cout << tfm::format("  max. difference: %g\n", maxError);
+
+    /* Random points inside the puffs' bounding box, as hit by tracking */
+    for (int sparse = 0; sparse < 2; ++sparse) {
+        pcg32 rng2;
+        double sum = 0;
+        Timer timer;
+        for (size_t i = 0; i < lookups; ++i)
+            sum += lookup(sparse != 0, Point3f(0.2f + 0.6f * rng2.nextFloat(), 0.2f + 0.6f * rng2.nextFloat(),
+                                               0.2f + 0.6f * rng2.nextFloat()));
+        double ms = timer.elapsed();
+        sink = (size_t) sum;
+        cout << tfm::format("  %-14s %8.2f ns/lookup\n", sparse ? "bricks" : "dense", ms * 1e6 / (double) lookups);
+    }
+    return 0;
+}
+
+/* Compares per-channel scalar trilinear lookups of the extinction and albedo
+   with a single fused SIMD lookup of a packed 4-channel grid */
+static int benchVolume(const std::vector<std::string> &args) {
+    int res = args.size() > 0 ? std::stoi(args[0]) : 128;
+    size_t lookups = args.size() > 1 ? (size_t) std::stoull(args[1]) : 10000000;
+    const int channels = 4;
+
+    /* Packed voxels: extinction followed by an RGB albedo */
+    PuffVolume volume;
+    std::vector<float> packed((size_t) res * res * res * channels);
+    for (int z = 0; z < res; ++z)
+        for (int y = 0; y < res; ++y)
+            for (int x = 0; x < res; ++x) {
+                Point3f p = Point3f(x, y, z) / (float) (res - 1);
+                float *voxel = &packed[(((size_t) z * res + y) * res + x) * channels];
+                voxel[0] = volume.lookupFloat(p);
+                voxel[1] = p.x();
+                voxel[2] = p.y();
+                voxel[3] = p.z();
+            }
+
+    auto lerp = [](const float c[8], float xd, float yd, float zd) {
+        float c0 = (c[0] * (1 - xd) + c[1] * xd) * (1 - yd) + (c[2] * (1 - xd) + c[3] * xd) * yd;
+        float c1 = (c[4] * (1 - xd) + c[5] * xd) * (1 - yd) + (c[6] * (1 - xd) + c[7] * xd) * yd;
+        return c0 * (1 - zd) + c1 * zd;
+    };
+    auto locate = [&](const Point3f &p, int &x, int &y, int &z, Vector3f &d) {
+        Point3f g = p * (float) (res - 1);
+        x = std::min((int) g.x(), res - 2);
+        y = std::min((int) g.y(), res - 2);
+        z = std::min((int) g.z(), res - 2);
+        d = Vector3f(g.x() - x, g.y() - y, g.z() - z);
+    };
+    auto corner = [&](int x, int y, int z, int i) {
+        return &packed[(((size_t) (z + (i >> 2)) * res + y + ((i >> 1) & 1)) * res + x + (i & 1)) * channels];
+    };
+    /* One cell fetch and scalar interpolation per coefficient, as separate volumes do */
+    auto separate = [&](const Point3f &p, float *out, int count) {
+        for (int k = 0; k < count; ++k) {
+            int x, y, z;
+            Vector3f d;
+            locate(p, x, y, z, d);
+            float c[8];
+            for (int i = 0; i < 8; ++i)
+                c[i] = corner(x, y, z, i)[k];
+            out[k] = lerp(c, d.x(), d.y(), d.z());
+        }
+    };
+    /* A single fetch of the cell for all channels */
+    auto fused = [&](const Point3f &p, float *out, int) {
+        int x, y, z;
+        Vector3f d;
+        locate(p, x, y, z, d);
+        const float *corners[8];
+        for (int i = 0; i < 8; ++i)
+            corners[i] = corner(x, y, z, i);
+        trilinearChannels(corners, channels, d.x(), d.y(), d.z(), out);
+    };
+
+    pcg32 rng;
+    float maxError = 0;
+    for (int i = 0; i < 100000; ++i) {
+        Point3f p(rng.nextFloat(), rng.nextFloat(), rng.nextFloat());
+        float a[4], b[4];
+        separate(p, a, channels);
+        fused(p, b, channels);
+        for (int k = 0; k < channels; ++k)
+            maxError = std::max(maxError, std::abs(a[k] - b[k]));
+    }
+    cout << tfm::format("%i^3 packed grid, %i channels, max. difference: %g\n", res, channels, maxError);
+
+    std::vector<std::pair<std::string, std::function<void(const Point3f &, float *, int)>>> variants = {
+        { "scalar", separate }, { "fused", fused }
+    };
+    /* Extinction only (null collisions), then extinction and albedo (real collisions) */
+    for (int count : { 1, channels }) {
+        cout << tfm::format("  %s:\n", count == 1 ? "extinction" : "extinction + albedo");
+        for (auto &variant : variants) {
+            pcg32 rng2;
+            double sum = 0;
+            float out[4];
+            Timer timer;
+            for (size_t i = 0; i < lookups; ++i) {
+                variant.second(Point3f(rng2.nextFloat(), rng2.nextFloat(), rng2.nextFloat()), out, count);
+                sum += out[0] + out[count - 1];
+            }
+            double ms = timer.elapsed();
+            sink = (size_t) sum;
+            cout << tfm::format("    %-12s %8.2f ns/lookup\n", variant.first, ms * 1e6 / (double) lookups);
+        }
+    }
+    return 0;
+}
+
+/// Height field over [-1, 1]^2 tessellated into a regular grid of triangles
+class TerrainMesh : public Mesh {
+public:
+    TerrainMesh(int res, bool shuffle) {
+        MatrixXf V(3, (size_t) (res + 1) * (res + 1));
+        for (int i = 0; i <= res; ++i) {
+            for (int j = 0; j <= res; ++j) {
+                float x = 2.f * j / res - 1.f, y = 2.f * i / res - 1.f;
+                float z = 0.1f * std::sin(17 * x) * std::sin(13 * y) + 0.02f * std::sin(90 * x + 70 * y);
+                V.col((size_t) i * (res + 1) + j) = Vector3f(x, y, z);
+            }
+        }
+        MatrixXu F(3, (size_t) 2 * res * res);
+        size_t f = 0;
+        for (int i = 0; i < res; ++i) {
+            for (int j = 0; j < res; ++j) {
+                uint32_t a = i * (res + 1) + j, b = a + 1, c = a + res + 1, d = c + 1;
+                F(0, f) = a; F(1, f) = b; F(2, f) = c; ++f;
+                F(0, f) = b; F(1, f) = d; F(2, f) = c; ++f;
+            }
+        }
+
+        /* Scatter triangles and vertices, like a mesh exported without regard to locality */
+        if (shuffle) {
+            pcg32 rng(1);
+            std::vector<uint32_t> perm(V.cols());
+            for (uint32_t i = 0; i < perm.size(); ++i)
+                perm[i] = i;
+            rng.shuffle(perm.begin(), perm.end());
+            MatrixXf V2(3, V.cols());
+            for (uint32_t i = 0; i < perm.size(); ++i)
+                V2.col(perm[i]) = V.col(i);
+            V = std::move(V2);
+            for (size_t i = 0; i < (size_t) F.size(); ++i)
+                F.data()[i] = perm[F.data()[i]];
+            for (size_t i = F.cols() - 1; i > 0; --i)
+                F.col(i).swap(F.col(rng.nextUInt((uint32_t) i + 1)));
+        }
+
+        for (size_t i = 0; i < (size_t) V.cols(); ++i)
+            m_bbox.expandBy(Point3f(V.col(i)));
+        m_name = shuffle ? "shuffled" : "grid order";
+        setMeshData(std::move(V), MatrixXf(), MatrixXf(), std::move(F));
+    }
+};
+
+/* Ray traversal of a large mesh with its triangles in random order, with
+   and without reordering them into the leaf order of the BVH */
+static int benchReorder(const std::vector<std::string> &args) {
+    int res = args.size() > 0 ? std::stoi(args[0]) : 700;
+    size_t rays = args.size() > 1 ? (size_t) std::stoull(args[1]) : 500000;
+    const int repetitions = 5;
+
+    struct Variant { const char *name; bool shuffle, reorder; };
+    Variant variants[] = {
+        { "grid order", false, false },
+        { "shuffled", true, false },
+        { "shuffled + reordered", true, true }
+    };
+    std::vector<std::unique_ptr<BVH>> bvhs;
+    for (const Variant &variant : variants) {
+        bvhs.emplace_back(new BVH());
+        bvhs.back()->addShape(new TerrainMesh(res, variant.shuffle));
+        bvhs.back()->build(variant.reorder);
+    }
+
+    /* Primary rays of a pinhole camera (coherent) and rays between random
+       points (incoherent). The variants take turns, and the fastest of
+       several repetitions is reported to suppress noise from other processes. */
+    int side = (int) std::sqrt((double) rays);
+    double best[3][2];
+    for (int rep = 0; rep < repetitions; ++rep) {
+        for (int v = 0; v < 3; ++v) {
+            for (int pattern = 0; pattern < 2; ++pattern) {
+                pcg32 rng;
+                size_t hits = 0, count = pattern == 0 ? (size_t) side * side : rays;
+                Timer timer;
+                for (size_t i = 0; i < count; ++i) {
+                    Ray3f ray;
+                    if (pattern == 0) {
+                        Point3f o(0.f, -2.f, 1.5f);
+                        Vector3f d(2.f * ((i % side) + 0.5f) / side - 1.f, 1.5f, -1.f - 0.6f * ((i / side) + 0.5f) / side);
+                        ray = Ray3f(o, d.normalized());
+                    } else {
+                        Point3f o = Warp::squareToUniformHemisphere(Point2f(rng.nextFloat(), rng.nextFloat())) * 3.f;
+                        Point3f target(2.f * rng.nextFloat() - 1.f, 2.f * rng.nextFloat() - 1.f, 0.f);
+                        ray = Ray3f(o, (target - o).normalized());
+                    }
+                    Intersection its;
+                    hits += bvhs[v]->rayIntersect(ray, its);
+                }
+                double ns = timer.elapsed() * 1e6 / (double) count;
+                sink = hits;
+                best[v][pattern] = rep == 0 ? ns : std::min(best[v][pattern], ns);
+            }
+        }
+    }
+
+    cout << tfm::format("Terrain with %i triangles, best of %i runs of %i rays\n", 2 * res * res, repetitions, rays);
+    cout << tfm::format("  %-22s %12s %12s\n", "ns/ray", "coherent", "incoherent");
+    for (int v = 0; v < 3; ++v)
+        cout << tfm::format("  %-22s %12.1f %12.1f\n", variants[v].name, best[v][0], best[v][1]);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    std::map<std::string, std::function<int(const std::vector<std::string> &)>> benchmarks = {
+        { "dpdf", benchDiscretePDF },
+        { "samplers", benchSamplers },
+        { "bluenoise", benchBlueNoise },
+        { "majorant", benchMajorant },
+        { "bricks", benchBricks },
+        { "volume", benchVolume },
+        { "reorder", benchReorder }
+    };
+
+    if (argc < 2 || benchmarks.find(argv[1]) == benchmarks.end()) {
+        cerr << "Syntax: " << argv[0] << " <benchmark> [arguments]" << endl << endl;
+        cerr << "Available benchmarks:" << endl;
+        cerr << "  dpdf [entries] [samples]   DiscretePDF sampling (CDF vs. alias table)" << endl;
+        cerr << "  samplers [type ...]        Convergence of the samplers on analytic integrands" << endl;
+        cerr << "  bluenoise [spp]            Screen-space error distribution of the Sobol sampler" << endl;
+        cerr << "  majorant [rays]            Null collisions of delta tracking vs. majorant grid resolution" << endl;
+        cerr << "  bricks [res] [lookups]     Memory and lookup speed of dense vs. sparse brick grids" << endl;
+        cerr << "  volume [res] [lookups]     Scalar vs. fused SIMD trilinear lookups of packed volumes" << endl;
+        cerr << "  reorder [res] [rays]       BVH traversal of a shuffled mesh with and without reordering" << endl;
+        return -1;
+    }
+
+    try {
+        return benchmarks[argv[1]](std::vector<std::string>(argv + 2, argv + argc));
+    } catch (const std::exception &e) {
+        cerr << "Error: " << e.what() << endl;
+        return 1;
+    }
+}
@@ -0,0 +1,219 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/brickgrid.h>
+#include <fstream>
+#include <cstring>
+
+NORI_NAMESPACE_BEGIN
+
+static void checkEndianness() {
+    uint16_t probe = 1;
+    if (*((uint8_t *) &probe) != 1)
+        throw NoriException("Brick volumes can only be used on little endian machines!");
+}
+
+const float *getVolData(const char *data, size_t size, const std::string &filename, VolHeader &header) {
+    checkEndianness();
+
+    if (size < sizeof(VolHeader))
+        throw NoriException("\"%s\" is not a volume data file!", filename);
+    memcpy(&header, data, sizeof(VolHeader));
+    if (memcmp(header.magic, "VOL", 3) != 0)
+        throw NoriException("\"%s\" is not a volume data file!", filename);
+    if (header.encoding != 1)
+        throw NoriException("Volume \"%s\": unsupported encoding %i!", filename, header.encoding);
+    if (header.xres < 1 || header.yres < 1 || header.zres < 1 || header.channels < 1)
+        throw NoriException("Volume \"%s\" has an invalid size!", filename);
+
+    size_t count = (size_t) header.xres * header.yres * header.zres * header.channels;
+    if (size < sizeof(VolHeader) + count * sizeof(float))
+        throw NoriException("Volume \"%s\" is truncated!", filename);
+    return (const float *) (data + sizeof(VolHeader));
+}
+
+void BrickGrid::build(const float *data, int xres, int yres, int zres, int channels, float threshold) {
+    if (xres < 1 || yres < 1 || zres < 1 || channels < 1)
+        throw NoriException("BrickGrid: invalid resolution %ix%ix%i (%i channels)!", xres, yres, zres, channels);
+
+    int res[3] = { xres, yres, zres };
+    for (int i = 0; i < 3; ++i) {
+        m_res[i] = res[i];
+        m_bricks[i] = (res[i] + BrickMask) >> BrickLog2;
+    }
+    m_channels = channels;
+    m_table.assign((size_t) m_bricks[0] * m_bricks[1] * m_bricks[2], EmptyBrick);
+    m_data.clear();
+
+    std::vector<float> brick((size_t) BrickVoxels * channels);
+    uint32_t brickCount = 0;
+    for (int bz = 0; bz < m_bricks[2]; ++bz) {
+        for (int by = 0; by < m_bricks[1]; ++by) {
+            for (int bx = 0; bx < m_bricks[0]; ++bx) {
+                /* Gather the brick, padding the border of the grid with zeros */
+                bool empty = true;
+                std::fill(brick.begin(), brick.end(), 0.f);
+                for (int z = 0; z < BrickSize; ++z) {
+                    int gz = (bz << BrickLog2) + z;
+                    for (int y = 0; y < BrickSize; ++y) {
+                        int gy = (by << BrickLog2) + y;
+                        for (int x = 0; x < BrickSize; ++x) {
+                            int gx = (bx << BrickLog2) + x;
+                            if (gx >= xres || gy >= yres || gz >= zres)
+                                continue;
+                            const float *src = data + (((size_t) gz * yres + gy) * xres + gx) * channels;
+                            float *dst = &brick[(size_t) voxelIndex(x, y, z) * channels];
+                            for (int c = 0; c < channels; ++c) {
+                                dst[c] = src[c];
+                                empty &= std::abs(src[c]) <= threshold;
+                            }
+                        }
+                    }
+                }
+                if (empty)
+                    continue;
+                m_table[tableIndex(bx, by, bz)] = brickCount++;
+                m_data.insert(m_data.end(), brick.begin(), brick.end());
+            }
+        }
+    }
+    m_data.shrink_to_fit();
+}
+
+BoundingBox3f BrickGrid::load(const std::string &filename) {
+    checkEndianness();
+
+    std::ifstream is(filename, std::ios::binary);
+    if (is.fail())
+        throw NoriException("Unable to open brick volume \"%s\"!", filename);
+
+    BrickVolumeHeader header;
+    is.read((char *) &header, sizeof(BrickVolumeHeader));
+    if (is.fail() || memcmp(header.magic, "BVOL", 4) != 0)
+        throw NoriException("\"%s\" is not a brick volume!", filename);
+    if (header.version != 1)
+        throw NoriException("Brick volume \"%s\": unsupported version %i!", filename, header.version);
+    if (header.brickSize != BrickSize)
+        throw NoriException("Brick volume \"%s\": unsupported brick size %i!", filename, header.brickSize);
+    if (header.res[0] < 1 || header.res[1] < 1 || header.res[2] < 1 || header.channels < 1)
+        throw NoriException("Brick volume \"%s\" has an invalid size!", filename);
+
+    for (int i = 0; i < 3; ++i) {
+        m_res[i] = header.res[i];
+        m_bricks[i] = (header.res[i] + BrickMask) >> BrickLog2;
+    }
+    m_channels = header.channels;
+    m_table.resize((size_t) m_bricks[0] * m_bricks[1] * m_bricks[2]);
+    m_data.resize((size_t) header.brickCount * BrickVoxels * m_channels);
+    is.read((char *) m_table.data(), (std::streamsize) (m_table.size() * sizeof(uint32_t)));
+    is.read((char *) m_data.data(), (std::streamsize) (m_data.size() * sizeof(float)));
+    if (is.fail())
+        throw NoriException("Brick volume \"%s\" is truncated!", filename);
+    for (uint32_t entry : m_table) {
+        if (entry != EmptyBrick && entry >= header.brickCount)
+            throw NoriException("Brick volume \"%s\" has an invalid brick table!", filename);
+    }
+
+    return BoundingBox3f(Point3f(header.bbox[0], header.bbox[1], header.bbox[2]),
+                         Point3f(header.bbox[3], header.bbox[4], header.bbox[5]));
+}
+
+void BrickGrid::save(const std::string &filename, const BoundingBox3f &bbox) const {
+    checkEndianness();
+
+    std::ofstream os(filename, std::ios::binary);
+    if (os.fail())
+        throw NoriException("Unable to write brick volume \"%s\"!", filename);
+
+    BrickVolumeHeader header;
+    memcpy(header.magic, "BVOL", 4);
+    header.version = 1;
+    header.channels = m_channels;
+    for (int i = 0; i < 3; ++i) {
+        header.res[i] = m_res[i];
+        header.bbox[i] = bbox.min[i];
+        header.bbox[i + 3] = bbox.max[i];
+    }
+    header.brickSize = BrickSize;
+    header.brickCount = (uint32_t) getBrickCount();
+
+    os.write((const char *) &header, sizeof(BrickVolumeHeader));
+    os.write((const char *) m_table.data(), (std::streamsize) (m_table.size() * sizeof(uint32_t)));
+    os.write((const char *) m_data.data(), (std::streamsize) (m_data.size() * sizeof(float)));
+    if (os.fail())
+        throw NoriException("Error while writing brick volume \"%s\"!", filename);
+}
+
+void BrickGrid::fetchCell(int x, int y, int z, int channel, float c[8]) const {
+    int lx = x & BrickMask, ly = y & BrickMask, lz = z & BrickMask;
+    if (lx == BrickMask || ly == BrickMask || lz == BrickMask) {
+        /* The cell straddles a brick boundary */
+        for (int i = 0; i < 8; ++i)
+            c[i] = getValue(x + (i & 1), y + ((i >> 1) & 1), z + (i >> 2), channel);
+        return;
+    }
+
+    uint32_t brick = m_table[tableIndex(x >> BrickLog2, y >> BrickLog2, z >> BrickLog2)];
+    if (brick == EmptyBrick) {
+        for (int i = 0; i < 8; ++i)
+            c[i] = 0.f;
+        return;
+    }
+
+    const float *ptr = &m_data[((size_t) brick * BrickVoxels + voxelIndex(lx, ly, lz)) * m_channels + channel];
+    size_t dx = m_channels, dy = (size_t) BrickSize * m_channels, dz = (size_t) BrickSize * BrickSize * m_channels;
+    c[0] = ptr[0];       c[1] = ptr[dx];
+    c[2] = ptr[dy];      c[3] = ptr[dy + dx];
+    c[4] = ptr[dz];      c[5] = ptr[dz + dx];
+    c[6] = ptr[dz + dy]; c[7] = ptr[dz + dy + dx];
+}
+
+void BrickGrid::getRange(const int lo[3], const int hi[3], int channel, float &minValue, float &maxValue) const {
+    minValue = std::numeric_limits<float>::infinity();
+    maxValue = -std::numeric_limits<float>::infinity();
+    for (int bz = lo[2] >> BrickLog2; bz <= hi[2] >> BrickLog2; ++bz) {
+        for (int by = lo[1] >> BrickLog2; by <= hi[1] >> BrickLog2; ++by) {
+            for (int bx = lo[0] >> BrickLog2; bx <= hi[0] >> BrickLog2; ++bx) {
+                uint32_t brick = m_table[tableIndex(bx, by, bz)];
+                if (brick == EmptyBrick) {
+                    minValue = std::min(minValue, 0.f);
+                    maxValue = std::max(maxValue, 0.f);
+                    continue;
+                }
+                /* Visit the part of the brick that overlaps the range */
+                int from[3], to[3], b[3] = { bx, by, bz };
+                for (int i = 0; i < 3; ++i) {
+                    from[i] = std::max(lo[i] - (b[i] << BrickLog2), 0);
+                    to[i] = std::min(hi[i] - (b[i] << BrickLog2), BrickMask);
+                }
+                const float *base = &m_data[(size_t) brick * BrickVoxels * m_channels + channel];
+                for (int z = from[2]; z <= to[2]; ++z) {
+                    for (int y = from[1]; y <= to[1]; ++y) {
+                        for (int x = from[0]; x <= to[0]; ++x) {
+                            float value = base[(size_t) voxelIndex(x, y, z) * m_channels];
+                            minValue = std::min(minValue, value);
+                            maxValue = std::max(maxValue, value);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+NORI_NAMESPACE_END
@@ -326,7 +326,7 @@ void BVH::clear() {
     m_indices.shrink_to_fit();
 }
 
-void BVH::build() {
+void BVH::build(bool reorder) {
     uint32_t size  = getPrimitiveCount();
     if (size == 0)
         return;
@@ -379,6 +379,51 @@ void BVH::build() {
         << ")." << endl;
 
     m_nodes = std::move(compactified);
+
+    if (reorder)
+        reorderPrimitives();
+}
+
+void BVH::reorderPrimitives() {
+    cout << "Reordering primitives to match the BVH leaves .. ";
+    cout.flush();
+    Timer timer;
+
+    /* Collect the primitives of each shape in leaf order */
+    uint32_t shapeCount = getShapeCount();
+    std::vector<std::vector<uint32_t>> orders(shapeCount);
+    for (uint32_t s = 0; s < shapeCount; ++s)
+        orders[s].reserve(m_shapeOffset[s + 1] - m_shapeOffset[s]);
+    for (uint32_t idx : m_indices) {
+        uint32_t shapeIdx = findShape(idx);
+        orders[shapeIdx].push_back(idx);
+    }
+
+    std::vector<uint8_t> reordered(shapeCount, 0);
+    tbb::parallel_for(tbb::blocked_range<uint32_t>(0u, shapeCount, 1),
+        [&](const tbb::blocked_range<uint32_t> &range) {
+            for (uint32_t s = range.begin(); s != range.end(); ++s) {
+                if (orders[s].size() > 1)
+                    reordered[s] = m_shapes[s]->reorderPrimitives(orders[s]);
+                std::vector<uint32_t>().swap(orders[s]);
+            }
+        }
+    );
+
+    /* Leaves now visit the primitives of reordered shapes sequentially */
+    std::vector<uint32_t> next(m_shapeOffset.begin(), m_shapeOffset.end() - 1);
+    uint32_t count = 0;
+    for (uint32_t &index : m_indices) {
+        uint32_t idx = index;
+        uint32_t shapeIdx = findShape(idx);
+        if (reordered[shapeIdx])
+            index = next[shapeIdx]++;
+    }
+    for (uint32_t s = 0; s < shapeCount; ++s)
+        count += reordered[s];
+
+    cout << "done (" << count << " of " << shapeCount << " shapes, took "
+        << timer.elapsedString() << ")." << endl;
 }
 
 std::pair<float, uint32_t> BVH::statistics(uint32_t node_idx) const {
@@ -460,10 +505,12 @@ bool BVH::rayIntersect(const Ray3f &_ray, Intersection &its, bool shadowRay) con
     return foundIntersection;
 }
 
-bool BVH::rayCurrIntersect(const Ray3f& _ray, Intersection& its, bool shadowRay, const Shape *_shape) const {
+bool BVH::rayIntersect(const Ray3f &_ray, Intersection &its,
+                       std::vector<MediumCrossing> &crossings) const {
     uint32_t node_idx = 0, stack_idx = 0, stack[64];
 
     its.t = std::numeric_limits<float>::infinity();
+    crossings.clear();
 
     /* Use an adaptive ray epsilon */
     Ray3f ray(_ray);
@@ -477,7 +524,7 @@ bool BVH::rayCurrIntersect(const Ray3f& _ray, Intersection& its, bool shadowRay,
     uint32_t f = 0;
 
     while (true) {
-        const BVHNode& node = m_nodes[node_idx];
+        const BVHNode &node = m_nodes[node_idx];
 
         if (!node.bbox.rayIntersect(ray)) {
             if (stack_idx == 0)
@@ -489,21 +536,31 @@ bool BVH::rayCurrIntersect(const Ray3f& _ray, Intersection& its, bool shadowRay,
         if (node.isInner()) {
             stack[stack_idx++] = node.inner.rightChild;
             node_idx++;
-            assert(stack_idx < 64);
-        }
-        else {
+            assert(stack_idx<64);
+        } else {
             for (uint32_t i = node.start(), end = node.end(); i < end; ++i) {
                 uint32_t idx = m_indices[i];
-                const Shape* shape = m_shapes[findShape(idx)];
+                const Shape *shape = m_shapes[findShape(idx)];
 
                 float u, v, t;
-                if (shape->rayIntersect(idx, ray, u, v, t)) {
-                    if (t > _ray.maxt) {
-                        return false;
-                    }
-                    else if (shape == _shape ) {
-                        return true;
-                    }
+                if (!shape->rayIntersect(idx, ray, u, v, t))
+                    continue;
+
+                if (shape->isNullInterface()) {
+                    /* Record the crossing, but don't shorten the ray */
+                    Intersection crossing;
+                    crossing.t = t;
+                    crossing.uv = Point2f(u, v);
+                    shape->setHitInformation(idx, ray, crossing);
+                    crossings.push_back(MediumCrossing {
+                        t, crossing.p, shape, shape->getMedium(),
+                        crossing.shFrame.n.dot(ray.d) < 0.0f });
+                } else {
+                    foundIntersection = true;
+                    ray.maxt = its.t = t;
+                    its.uv = Point2f(u, v);
+                    its.mesh = shape;
+                    f = idx;
                 }
             }
             if (stack_idx == 0)
@@ -513,7 +570,24 @@ bool BVH::rayCurrIntersect(const Ray3f& _ray, Intersection& its, bool shadowRay,
         }
     }
 
-    return false;
+    /* Discard crossings behind the closest real surface and sort the rest */
+    crossings.erase(std::remove_if(crossings.begin(), crossings.end(),
+        [&](const MediumCrossing &c) { return c.t > its.t; }), crossings.end());
+    std::sort(crossings.begin(), crossings.end(),
+        [](const MediumCrossing &c1, const MediumCrossing &c2) { return c1.t < c2.t; });
+
+    /* A ray through a shared edge or vertex of a boundary mesh hits several of
+       its triangles; keep a single crossing per shape, distance and direction */
+    float eps = std::max(Epsilon, ray.mint);
+    crossings.erase(std::unique(crossings.begin(), crossings.end(),
+        [&](const MediumCrossing &c1, const MediumCrossing &c2) {
+            return c1.mesh == c2.mesh && c1.entering == c2.entering && std::abs(c2.t - c1.t) < eps;
+        }), crossings.end());
+
+    if (foundIntersection) {
+        its.mesh->setHitInformation(f,ray,its);
+    }
+    return foundIntersection;
 }
 
 NORI_NAMESPACE_END
@@ -11,6 +11,9 @@ public:
     virtual float lookupFloat(const Point3f& p) const override {
         return m_value;
     };
+    virtual void lookupBounds(const BoundingBox3f& box, float& minValue, float& maxValue) const override {
+        minValue = maxValue = m_value;
+    }
     virtual Color3f lookupRGB(const Point3f& p) const override {
         //not used
         return Color3f(0.0f);
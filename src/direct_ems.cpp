@@ -22,19 +22,19 @@ public:
 
         /* compute Le when intersection is an emitter */
         if (its.mesh->isEmitter()) {
-            EmitterQueryRecord lRec(ray.o, its.p, its.shFrame.n);
+            EmitterQueryRecord lRec(ray.o, its.p, its.shFrame.n, its.primIndex);
             color += its.mesh->getEmitter()->eval(lRec);
         }
 
         /* compute Lr */
-        int n_lights = scene->getLights().size();
-        auto l = scene->getRandomEmitter(sampler->next1D());
+        float lightPdf;
+        auto l = scene->getRandomEmitter(sampler->next1D(), lightPdf);
         EmitterQueryRecord lRec(its.p);
         Color3f Li = l->sample(lRec, sampler->next2D());
         if (!scene->rayIntersect(lRec.shadowRay)) {  // if shadow ray is NOT occluded
             float cosTheta = its.shFrame.n.dot(lRec.wi);
             BSDFQueryRecord bRec(its.toLocal(-ray.d), its.toLocal(lRec.wi), ESolidAngle);
-            color += its.mesh->getBSDF()->eval(bRec) * Li * cosTheta * n_lights;
+            color += its.mesh->getBSDF()->eval(bRec) * Li * cosTheta / lightPdf;
         }
 
         return color;
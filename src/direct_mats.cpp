@@ -22,7 +22,7 @@ public:
 
         /* compute Le when intersection is an emitter */
         if (its.mesh->isEmitter()) {
-            EmitterQueryRecord lRec(ray.o, its.p, its.shFrame.n);
+            EmitterQueryRecord lRec(ray.o, its.p, its.shFrame.n, its.primIndex);
             color += its.mesh->getEmitter()->eval(lRec);
         }
 
@@ -37,7 +37,7 @@ public:
         Intersection its_wo;
         if (scene->rayIntersect(ray_wo, its_wo)) {
             if (its_wo.mesh->isEmitter()) {
-                EmitterQueryRecord lRec(its.p, its_wo.p, its_wo.shFrame.n);
+                EmitterQueryRecord lRec(its.p, its_wo.p, its_wo.shFrame.n, its_wo.primIndex);
                 color += brdf * its_wo.mesh->getEmitter()->eval(lRec);
             }
         }
@@ -22,14 +22,15 @@ public:
 
         /* compute Le when intersection is an emitter */
         if (its.mesh->isEmitter()) {
-            EmitterQueryRecord lRec(ray.o, its.p, its.shFrame.n);
+            EmitterQueryRecord lRec(ray.o, its.p, its.shFrame.n, its.primIndex);
             color += its.mesh->getEmitter()->eval(lRec);
         }
 
         /* initialization */
         auto bsdf = its.mesh->getBSDF();
-        auto light = scene->getRandomEmitter(sampler->next1D());
-        int n_lights = scene->getLights().size();
+        float lightPdf;
+        EmitterQueryRecord lRec(its.p);
+        auto light = scene->getRandomEmitter(its.p, its.shFrame.n, sampler->next1D(), lightPdf, lRec);
 
         /* sample brdf */
         BSDFQueryRecord bRec(its.toLocal((-ray.d).normalized()));
@@ -43,10 +44,11 @@ public:
         Intersection its_wo;
         if (scene->rayIntersect(ray_wo, its_wo)) {
             if (its_wo.mesh->isEmitter()) {
-                EmitterQueryRecord lRec(its.p, its_wo.p, its_wo.shFrame.n);
-                Color3f Li = its_wo.mesh->getEmitter()->eval(lRec);
+                EmitterQueryRecord lRec_mat(its.p, its_wo.p, its_wo.shFrame.n, its_wo.primIndex);
+                Color3f Li = its_wo.mesh->getEmitter()->eval(lRec_mat);
                 float pdf_mat = bsdf->pdf(bRec);
-                float pdf_em = its_wo.mesh->getEmitter()->pdf(lRec);
+                float lightPdf_mat = scene->getEmitterPdf(its.p, its.shFrame.n, its_wo.mesh->getEmitter(), lRec_mat);
+                float pdf_em = its_wo.mesh->getEmitter()->pdf(lRec_mat) * lightPdf_mat;
                 if (pdf_em + pdf_mat > 1e-8) {
                     float w_mat = pdf_mat / (pdf_mat + pdf_em);
                     color += w_mat * brdf * Li;
@@ -55,19 +57,19 @@ public:
         }
 
         /* sample emitter */
-        EmitterQueryRecord lRec(its.p);
-        Color3f Li = light->sample(lRec, sampler->next2D());
+        Point2f lightSample = sampler->next2D();
+        Color3f Li = light ? light->sample(lRec, lightSample) : Color3f(0.f);
 
         /* compute emitter component */
-        if (!scene->rayIntersect(lRec.shadowRay)) {  // if shadow ray is NOT occluded
+        if (light && !scene->rayIntersect(lRec.shadowRay)) {  // if shadow ray is NOT occluded
             float cosTheta = its.shFrame.n.dot(lRec.wi);
             BSDFQueryRecord bRec(its.toLocal(-ray.d), its.toLocal(lRec.wi), ESolidAngle);
             bRec.uv = its.uv;
-            float pdf_em = light->pdf(lRec);
+            float pdf_em = light->pdf(lRec) * lightPdf;
             float pdf_mat = bsdf->pdf(bRec);
             if (pdf_em + pdf_mat > 1e-8) {
                 float w_em = pdf_em / (pdf_mat + pdf_em);
-                color += w_em * bsdf->eval(bRec) * Li * cosTheta * n_lights;
+                color += w_em * bsdf->eval(bRec) * Li * cosTheta / lightPdf;
             }
         }
 
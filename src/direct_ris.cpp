@@ -0,0 +1,74 @@
+#include <nori/emitter.h>
+#include <nori/integrator.h>
+#include <nori/scene.h>
+#include <nori/bsdf.h>
+#include <nori/ris.h>
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * \brief Direct illumination by resampled importance sampling
+ *
+ * Evaluates the unshadowed contribution of several candidate light
+ * samples and traces a single shadow ray for the one selected among
+ * them (see \ref sampleDirectRIS()), which pays off when shadow rays
+ * are expensive compared to BSDF and emitter evaluations. Delta BSDFs
+ * cannot be handled by light sampling and use BSDF sampling instead.
+ */
+class DirectRIS : public Integrator {
+public:
+    DirectRIS(const PropertyList &props) {
+        /* Number of candidate light samples per shading point */
+        m_candidates = props.getInteger("candidates", 8);
+        if (m_candidates < 1)
+            throw NoriException("direct_ris: at least one candidate is required!");
+    }
+
+    Color3f Li(const Scene *scene, Sampler *sampler, const Ray3f &ray) const {
+        Intersection its;
+        Color3f color = 0;
+
+        /* return black when no intersection */
+        if (!scene->rayIntersect(ray, its))
+            return 0;
+
+        /* compute Le when intersection is an emitter */
+        if (its.mesh->isEmitter()) {
+            EmitterQueryRecord lRec(ray.o, its.p, its.shFrame.n, its.primIndex);
+            color += its.mesh->getEmitter()->eval(lRec);
+        }
+
+        /* resampled emitter sample, one shadow ray */
+        EmitterQueryRecord lRec(its.p);
+        Color3f Lr = sampleDirectRIS(scene, sampler, its, -ray.d, m_candidates, lRec);
+        if (Lr.maxCoeff() > 0.f && !scene->rayIntersect(lRec.shadowRay))
+            color += Lr;
+
+        /* specular reflection and refraction of emitters */
+        auto bsdf = its.mesh->getBSDF();
+        BSDFQueryRecord bRec(its.toLocal((-ray.d).normalized()));
+        bRec.p = its.p;
+        bRec.uv = its.uv;
+        Color3f brdf = bsdf->sample(bRec, sampler->next2D());
+        if (bRec.measure == EDiscrete) {
+            Ray3f ray_wo(its.p, its.toWorld(bRec.wo), Epsilon, INFINITY);
+            Intersection its_wo;
+            if (scene->rayIntersect(ray_wo, its_wo) && its_wo.mesh->isEmitter()) {
+                EmitterQueryRecord eRec(its.p, its_wo.p, its_wo.shFrame.n, its_wo.primIndex);
+                color += brdf * its_wo.mesh->getEmitter()->eval(eRec);
+            }
+        }
+
+        return color;
+    }
+
+    std::string toString() const {
+        return tfm::format("DirectRIS[candidates = %i]", m_candidates);
+    }
+
+private:
+    int m_candidates;
+};
+
+NORI_REGISTER_CLASS(DirectRIS, "direct_ris")
+NORI_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <nori/medium.h>
 #include <nori/shape.h>
 #include <nori/volume.h>
+#include <nori/majorant.h>
 
 NORI_NAMESPACE_BEGIN
 using namespace std;
@@ -10,9 +11,10 @@ public:
 
     EmissiveMedium(const PropertyList& propList) {
         m_scale = propList.getFloat("scale", 1.f);
-
-        m_maxDensity = m_scale;
-        m_invMaxDensity = 1.0f / m_scale;
+        // cells per axis of the majorant grid, 1 falls back to a single global majorant
+        m_majorantRes = propList.getInteger("majorantResolution", 16);
+        // count the real and null collisions, printed after rendering
+        m_statistics = propList.getBoolean("statistics", false);
         m_isRGB = propList.getBoolean("isRGB", true);
         if (m_isRGB) {
             m_scale = propList.getFloat("scale", 1.f);
@@ -23,46 +25,41 @@ public:
 
     }
 
-    // sample the freepath based on delta tracking
+    // sample the freepath based on delta tracking against the per-cell majorants
     bool sample_freepath(MediumQueryRecord& mRec, Sampler* sampler) const override {
         Ray3f ray = Ray3f(mRec.ref, -mRec.wi, 0, mRec.tMax);
-        Color3f transmittance = Color3f(1);
-        Color3f Le(0.0f);
         float mint, maxt;
         if (!m_shape->getBoundingBox().rayIntersect(ray, mint, maxt))
             return false;
         mint = std::max(mint, ray.mint);
         maxt = std::min(maxt, ray.maxt);
-        float t = mint, densityP, albedoAtT = 0;
-        while (true) {
-            t += - log(1 - sampler->next1D()) * m_invMaxDensity;
-            if (t >= maxt)
-                break;
+        uint64_t nullCollisions = 0;
+
+        bool escaped = trackMajorant(m_majorant, ray, mint, maxt, sampler, [&](float t, float majorant) {
             Point3f p = ray(t);
-            densityP = m_extinction->lookupFloat(p) * m_scale;
-            transmittance = exp(-densityP * t);
-            // combination of line and point integral
-            //if ((sampler->next1D()) >= transmittance.x()) {
-            //    Le += m_radiance->lookupFloat(p) * (1 - albedoAtT) * (1 - exp(-densityAtT * t));
-            //}
-            //else {
-            //    Le += m_radiance->lookupFloat(p) * (1 - albedoAtT);
-            //}
-            if (densityP * m_invMaxDensity > sampler->next1D()) {
+            MediumSample s;
+            lookup(p, s);
+            if (s.sigmaT * m_scale > majorant * sampler->next1D()) {
                 mRec.p = p;
-                mRec.ret = m_albedo->lookupRGB(p);
-                mRec.radiance = eval_radiance(p);
-                return true;
+                mRec.ret = m_packed ? s.albedo : m_albedo->lookupRGB(p);
+                mRec.radiance = m_packed ? s.radiance : eval_radiance(p);
+                return false;
             }
-        }
+            nullCollisions++;
+            return true;
+        });
+        m_majorant.addCollisions(escaped ? 0 : 1, nullCollisions);
+        if (!escaped)
+            return true;
+
         mRec.p = mRec.ref + mRec.tMax * (- mRec.wi);
         mRec.ret = 1.f;
         return false;
     }
 
 
-    /* evaluate the transmittance between mRec.ref and mRec.p
-    set mRec*/
+    /* estimate the transmittance between mRec.ref and mRec.p by
+    residual ratio tracking against the majorant grid*/
     Color3f Tr(const MediumQueryRecord& mRec, Sampler* sampler) const override {
         Ray3f ray = Ray3f(mRec.ref, (mRec.p - mRec.ref).normalized(), 0, (mRec.p - mRec.ref).norm());
         float mint, maxt;
@@ -70,25 +67,22 @@ public:
             return Color3f(1.f);
         mint = std::max(mint, ray.mint);
         maxt = std::min(maxt, ray.maxt);
-        float result = 0;
-            float t = mint;
-            while (true) {
-                t += -log(1 - sampler->next1D()) * m_invMaxDensity;
-                if (t >= maxt) {
-                    result += 1;
-                    break;
-                }
-                Point3f p = ray(t);
-                float density = m_extinction->lookupFloat(p) * m_scale;
-                if (density * m_invMaxDensity > sampler->next1D())
-                    break;
-            }
-        return Color3f(result);
+        uint64_t lookups = 0;
+        float tr = ratioTrack(m_majorant, ray, mint, maxt, sampler, [&](float t) {
+            return m_extinction->lookupFloat(ray(t)) * m_scale;
+        }, lookups);
+        m_majorant.addRatioLookups(lookups);
+        return Color3f(tr);
     }
 
     /* evaluate the radiance at given point*/
 
     virtual Color3f eval_radiance(Point3f& p) const override{
+        if (m_packed) {
+            MediumSample s;
+            m_packed->lookupMedium(p, s);
+            return s.radiance;
+        }
         return Color3f(m_radiance->lookupFloat(p));
     }
 
@@ -112,6 +106,29 @@ public:
         return eval_radiance(mRec.p);
     }
 
+    /**
+     * \brief Estimate the emitted power by integrating the radiance over
+     * a stratified grid of points inside the medium shape
+     * */
+    virtual Color3f getPower() const override {
+        if (!m_shape || (!m_radiance && !m_packed))
+            return Color3f(0.f);
+        const int res = 16;
+        Color3f sum(0.f);
+        for (int z = 0; z < res; ++z) {
+            for (int y = 0; y < res; ++y) {
+                for (int x = 0; x < res; ++x) {
+                    ShapeQueryRecord sRec;
+                    m_shape->sampleVolume(sRec, Point3f((x + 0.5f) / res, (y + 0.5f) / res, (z + 0.5f) / res));
+                    if (sRec.pdf > 0.f && m_shape->contains(sRec.p))
+                        sum += eval_radiance(sRec.p) / sRec.pdf;
+                }
+            }
+        }
+        /* Isotropic emission */
+        return sum * (4.f * M_PI / (res * res * res));
+    }
+
     void addChild(NoriObject* obj) {
         switch (obj->getClassType()) {
         case EPhaseFunction:
@@ -125,6 +142,11 @@ public:
                 m_albedo = static_cast<Volume*>(obj);
                 m_albedo->setMedium(static_cast<Medium*>(this));
             }
+            else if (obj->getIdName() == "packed") {
+                // the extinction lookups of the majorant grid and ratio tracking read channel 0
+                m_packed = m_extinction = static_cast<Volume*>(obj);
+                m_packed->setMedium(static_cast<Medium*>(this));
+            }
             else if (obj->getIdName() == "sigma_t") {
                 m_extinction = static_cast<Volume*>(obj);
                 m_extinction->setMedium(static_cast<Medium*>(this));
@@ -143,16 +165,17 @@ public:
     virtual bool isHeterogeneous() const override { return true; }
     virtual bool isEmissive() const { return true; }
     virtual void volGrid() {
-        if (m_extinction->isPerlin()) {
-            m_extinction->gridGeneration();
-        }
-        if (m_albedo->isPerlin()) {
-            m_albedo->gridGeneration();
+        if (!m_extinction || (!m_packed && (!m_albedo || !m_radiance)))
+            throw NoriException("EmissiveMedium: needs either a packed volume or sigma_t, albedo and radiance volumes!");
+        for (Volume* volume : { m_extinction, m_albedo, m_radiance }) {
+            if (volume)
+                volume->gridGeneration();
         }
-        if (m_radiance->isPerlin()) {
-            m_radiance->gridGeneration();
-        }
-
+        m_majorant.build(m_extinction, m_shape->getBoundingBox(), m_scale, m_majorantRes);
+        m_majorant.setStatistics(m_statistics);
+    }
+    virtual std::string getStatistics() const override {
+        return m_majorant.getStatistics();
     }
     std::string toString() const override {
         return tfm::format(
@@ -160,22 +183,33 @@ public:
             "  scale = %s,\n"
             "  sigmaT = %s,\n"
             "  albedo = %s,\n"
-
+            "  majorant = %s\n"
             "]",
             m_scale,
             m_extinction->toString(),
-            m_albedo->toString());
+            m_albedo ? m_albedo->toString() : (m_packed ? "packed" : "null"),
+            m_majorant.toString());
     }
 
 
 protected:
+    /* extinction at p; a packed volume also returns the other coefficients
+    of the same cell, which saves their lookups at real collisions */
+    void lookup(const Point3f& p, MediumSample& s) const {
+        if (m_packed)
+            m_packed->lookupMedium(p, s);
+        else
+            s.sigmaT = m_extinction->lookupFloat(p);
+    }
 
     Volume* m_extinction = nullptr;
     Volume* m_albedo = nullptr;
     Volume* m_radiance = nullptr;
+    Volume* m_packed = nullptr;
     float m_scale;
-    float m_maxDensity;
-    float m_invMaxDensity;
+    int m_majorantRes;
+    bool m_statistics;
+    MajorantGrid m_majorant;
     bool m_isRGB;
 };
 
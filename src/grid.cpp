@@ -3,156 +3,226 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <cstring>
+#include <filesystem/resolver.h>
 #include <nori/volume.h>
 #include <nori/shape.h>
+#include <nori/brickgrid.h>
+#include <nori/trilinear.h>
+#include <nori/mmap.h>
+#include <nori/assetcache.h>
 
 NORI_NAMESPACE_BEGIN
 using namespace std;
 /* The Grid Volume class parse a Mitsuba-standard .vol file, create a corresponding axis-aligned boundingbox.
-and is responsible for retrieving the value at a given point based on its position inside the bounding box*/
+and is responsible for retrieving the value at a given point based on its position inside the bounding box.
+The voxels are either stored densely or, with "sparse" enabled, in 8^3 bricks that skip empty space.
+Sparse brick volumes (.bvol) written by vol2brick are loaded directly*/
 
 class GridVolume : public Volume {
 
 public:
     GridVolume(const PropertyList& props) {
-        m_filename =props.getString("filename");
+        m_filename = getFileResolver()->resolve(props.getString("filename")).str();
+        m_sparse = props.getBoolean("sparse", false);
+        // values of at most this magnitude count as empty space when building bricks
+        float threshold = props.getFloat("threshold", 0.f);
+
         std::ifstream file(m_filename, std::ios::binary);
-        if (!file.is_open()) {
-            std::cerr << "Error opening file: " << m_filename << std::endl;
-            return;
-        }
+        if (!file.is_open())
+            throw NoriException("GridVolume: unable to open \"%s\"!", m_filename);
+        char magic[4] = { 0, 0, 0, 0 };
+        file.read(magic, 4);
+        file.close();
 
-        //byte 1-3
-        char header[3];
-        file.read(header, 3);
-        if (std::string(header, 3) != "VOL") {
-            std::cerr << "Invalid volume data file!" << std::endl;
-            return;
+        if (memcmp(magic, "BVOL", 4) == 0) {
+            m_bricks.load(m_filename);
+            m_sparse = true;
+            m_xres = m_bricks.getResolution(0);
+            m_yres = m_bricks.getResolution(1);
+            m_zres = m_bricks.getResolution(2);
+            m_channels = m_bricks.getChannels();
         }
-
-        //byte 4
-        int version;
-        file.read(reinterpret_cast<char*>(&version), sizeof(char));
-        //if (version != 3) {
-        //    std::cerr << "Unsupported version!" << std::endl;
-        //    return;
-        //}
-        //byte 5-8
-        int encoding;
-        file.read(reinterpret_cast<char*>(&encoding), sizeof(int));
-        //byte 9-12
-        file.read(reinterpret_cast<char*>(&m_xres), sizeof(int));
-        //byte 13-16
-        file.read(reinterpret_cast<char*>(&m_yres), sizeof(int));
-        //byte 17-20
-        file.read(reinterpret_cast<char*>(&m_zres), sizeof(int));
-        //byte 21-24
-        file.read(reinterpret_cast<char*>(&m_channels), sizeof(int));
-        cout << "channel number: " << m_channels << endl;
-        cout << "xres: " << m_xres << endl;
-        cout << "yres: " << m_yres << endl;
-        cout << "zres: " << m_zres << endl;
-        //byte 25-48
-        float boundingBox[6];
-        for (int i = 0; i < 6; ++i) {
-            file.read(reinterpret_cast<char*>(&boundingBox[i]), sizeof(float));
-            cout << "bb" << i << ": " << boundingBox[i] << endl;
+        else {
+            /* The voxels are used in place from a read-only mapping that all volumes
+               of the file share; pages are loaded on demand and shared between processes */
+            static AssetCache<MemoryMappedFile> cache;
+            m_file = cache.get(makeAssetKey("vol", m_filename),
+                [&] { return std::make_shared<MemoryMappedFile>(m_filename); });
+            VolHeader header;
+            m_data = getVolData(m_file->getData(), m_file->getSize(), m_filename, header);
+            m_xres = header.xres;
+            m_yres = header.yres;
+            m_zres = header.zres;
+            m_channels = header.channels;
+            if (m_sparse) {
+                m_bricks.build(m_data, m_xres, m_yres, m_zres, m_channels, threshold);
+                m_file.reset();
+                m_data = nullptr;
+            }
         }
-        //Read binary data
-        int dataSize = m_xres * m_yres * m_zres * m_channels;
-        data.resize(dataSize);
-        file.read(reinterpret_cast<char*>(data.data()), dataSize * sizeof(float));
-        file.close();
+
+        size_t denseSize = (size_t) m_xres * m_yres * m_zres * m_channels * sizeof(float);
+        if (m_sparse)
+            cout << tfm::format("GridVolume: %ix%ix%i voxels, %i channel(s), %i/%i bricks stored (%s instead of %s)",
+                m_xres, m_yres, m_zres, m_channels, m_bricks.getBrickCount(), m_bricks.getTableSize(),
+                memString(m_bricks.getMemoryUsage()), memString(denseSize)) << endl;
+        else
+            cout << tfm::format("GridVolume: %ix%ix%i voxels, %i channel(s) (%s)",
+                m_xres, m_yres, m_zres, m_channels, memString(denseSize)) << endl;
     }
 
-    float lookupFloat(const Point3f& p) const override{
+    /* cache the mapping from world space to voxel coordinates, the extent of the
+    grid is the bounding box of the medium's shape */
+    virtual void gridGeneration() override {
         BoundingBox3f bbox = this->m_medium->getShape()->getBoundingBox();
         Vector3f diag = bbox.getExtents();
-        Point3f min = bbox.min;
-        Point3f bb_p = p - min;
-        bb_p = Point3f(bb_p.x() / diag.x() * (m_xres - 1), bb_p.y() / diag.y() * (m_yres - 1), bb_p.z() / diag.z() * (m_zres - 1));
-        int x1 = static_cast<int>(std::floor(bb_p.x()));
-        int y1 = static_cast<int>(std::floor(bb_p.y()));
-        int z1 = static_cast<int>(std::floor(bb_p.z()));
-        int chan = 0;
-        if (x1 < 0 || y1 < 0 || z1 < 0 || x1 >= m_xres - 1 || y1 >= m_yres - 1 || z1 >= m_zres - 1 || chan < 0 || chan >= m_channels) {
+        m_origin = bbox.min;
+        m_toVoxel = Vector3f((m_xres - 1) / diag.x(), (m_yres - 1) / diag.y(), (m_zres - 1) / diag.z());
+    }
+
+    float lookupFloat(const Point3f& p) const override{
+        int x1, y1, z1;
+        float xd, yd, zd;
+        if (!toGrid(p, x1, y1, z1, xd, yd, zd) || m_channels < 1) {
             std::cerr << "Invalid lookup position or channel" << std::endl;
             return 0.0f; // Or any default value as needed
         }
 
-        float xd = bb_p.x() - x1;
-        float yd = bb_p.y() - y1;
-        float zd = bb_p.z() - z1;
-
-
         //trilinear interpolation to get the value
-        float c000 = data[((z1 * m_yres + y1) * m_xres + x1) * m_channels + chan];
-        float c001 = data[((z1 * m_yres + y1) * m_xres + x1 + 1) * m_channels + chan];
-        float c010 = data[((z1 * m_yres + y1 + 1) * m_xres + x1) * m_channels + chan];
-        float c011 = data[((z1 * m_yres + y1 + 1) * m_xres + x1 + 1) * m_channels + chan];
-        float c100 = data[((z1 + 1) * m_yres + y1) * m_xres + x1 * m_channels + chan];
-        float c101 = data[((z1 + 1) * m_yres + y1) * m_xres + (x1 + 1) * m_channels + chan];
-        float c110 = data[((z1 + 1) * m_yres + y1 + 1) * m_xres + x1 * m_channels + chan];
-        float c111 = data[((z1 + 1) * m_yres + y1 + 1) * m_xres + (x1 + 1) * m_channels + chan];
-
-        float c00 = c000 * (1 - xd) + c001 * xd;
-        float c01 = c010 * (1 - xd) + c011 * xd;
-        float c10 = c100 * (1 - xd) + c101 * xd;
-        float c11 = c110 * (1 - xd) + c111 * xd;
-
-        float c0 = c00 * (1 - yd) + c01 * yd;
-        float c1 = c10 * (1 - yd) + c11 * yd;
-
-        return c0 * (1 - zd) + c1 * zd;
+        float c[8];
+        fetchCell(x1, y1, z1, 0, c);
+        return trilinear(c, xd, yd, zd);
     }
-    virtual Color3f lookupRGB(const Point3f& p) const override {
-        Color3f result(0);
-        BoundingBox3f bbox = this->m_medium->getShape()->getBoundingBox();
-        Vector3f diag = bbox.getExtents();
-        Point3f min = bbox.min;
-        Point3f bb_p = p - min;
-        bb_p = Point3f(bb_p.x() / diag.x() * (m_xres - 1), bb_p.y() / diag.y() * (m_yres - 1), bb_p.z() / diag.z() * (m_zres - 1));
-        int x1 = static_cast<int>(std::floor(bb_p.x()));
-        int y1 = static_cast<int>(std::floor(bb_p.y()));
-        int z1 = static_cast<int>(std::floor(bb_p.z()));
-        for (int i = 0; i < m_channels; i++) {
-            if (x1 < 0 || y1 < 0 || z1 < 0 || x1 >= m_xres - 1 || y1 >= m_yres - 1 || z1 >= m_zres - 1 || i < 0 || i >= m_channels) {
-                std::cerr << "Invalid lookup position or channel" << std::endl;
-                return 0.0f; // Or any default value as needed
+    /* The trilinear interpolant is bounded by the voxels surrounding the box */
+    virtual void lookupBounds(const BoundingBox3f& box, float& minValue, float& maxValue) const override {
+        if (m_xres < 1 || m_channels < 1) {
+            minValue = maxValue = 0.f;
+            return;
+        }
+        int res[3] = { m_xres, m_yres, m_zres };
+        int lo[3], hi[3];
+        for (int i = 0; i < 3; i++) {
+            lo[i] = clamp(static_cast<int>(std::floor((box.min[i] - m_origin[i]) * m_toVoxel[i])), 0, res[i] - 1);
+            hi[i] = clamp(static_cast<int>(std::floor((box.max[i] - m_origin[i]) * m_toVoxel[i])) + 1, 0, res[i] - 1);
+        }
+        if (m_sparse) {
+            m_bricks.getRange(lo, hi, 0, minValue, maxValue);
+            return;
+        }
+        minValue = std::numeric_limits<float>::infinity();
+        maxValue = -std::numeric_limits<float>::infinity();
+        for (int z = lo[2]; z <= hi[2]; z++) {
+            for (int y = lo[1]; y <= hi[1]; y++) {
+                for (int x = lo[0]; x <= hi[0]; x++) {
+                    float value = m_data[(((size_t) z * m_yres + y) * m_xres + x) * m_channels];
+                    minValue = std::min(minValue, value);
+                    maxValue = std::max(maxValue, value);
+                }
             }
-
-            float xd = bb_p.x() - x1;
-            float yd = bb_p.y() - y1;
-            float zd = bb_p.z() - z1;
-
-            float c000 = data[((z1 * m_yres + y1) * m_xres + x1) * m_channels + i];
-            float c001 = data[((z1 * m_yres + y1) * m_xres + x1 + 1) * m_channels + i];
-            float c010 = data[((z1 * m_yres + y1 + 1) * m_xres + x1) * m_channels + i];
-            float c011 = data[((z1 * m_yres + y1 + 1) * m_xres + x1 + 1) * m_channels + i];
-            float c100 = data[((z1 + 1) * m_yres + y1) * m_xres + x1 * m_channels + i];
-            float c101 = data[((z1 + 1) * m_yres + y1) * m_xres + (x1 + 1) * m_channels + i];
-            float c110 = data[((z1 + 1) * m_yres + y1 + 1) * m_xres + x1 * m_channels + i];
-            float c111 = data[((z1 + 1) * m_yres + y1 + 1) * m_xres + (x1 + 1) * m_channels + i];
-
-            float c00 = c000 * (1 - xd) + c001 * xd;
-            float c01 = c010 * (1 - xd) + c011 * xd;
-            float c10 = c100 * (1 - xd) + c101 * xd;
-            float c11 = c110 * (1 - xd) + c111 * xd;
-
-            float c0 = c00 * (1 - yd) + c01 * yd;
-            float c1 = c10 * (1 - yd) + c11 * yd;
-
-            result[i] = c0 * (1 - zd) + c1 * zd;
         }
-        return result;
+    }
+    /* all channels are interpolated together from a single fetch of the cell */
+    virtual Color3f lookupRGB(const Point3f& p) const override {
+        int x1, y1, z1;
+        float xd, yd, zd;
+        if (!toGrid(p, x1, y1, z1, xd, yd, zd)) {
+            std::cerr << "Invalid lookup position or channel" << std::endl;
+            return 0.0f; // Or any default value as needed
+        }
+        const float* corners[8];
+        fetchCorners(x1, y1, z1, corners);
+        // a fourth channel rides along for free and keeps the loads aligned to whole registers
+        float out[4] = { 0.f, 0.f, 0.f, 0.f };
+        trilinearChannels(corners, std::min(m_channels, 4), xd, yd, zd, out);
+        return Color3f(out[0], out[1], out[2]);
+    }
+    /* packed volume: extinction, albedo and (optionally) radiance of one cell */
+    virtual void lookupMedium(const Point3f& p, MediumSample& sample) const override {
+        if (m_channels < 4)
+            throw NoriException("GridVolume: \"%s\" has %i channel(s), a packed volume needs at least 4!",
+                m_filename, m_channels);
+        int x1, y1, z1;
+        float xd, yd, zd;
+        if (!toGrid(p, x1, y1, z1, xd, yd, zd)) {
+            sample = MediumSample();
+            return;
+        }
+        const float* corners[8];
+        fetchCorners(x1, y1, z1, corners);
+        float out[8] = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f };
+        trilinearChannels(corners, std::min(m_channels, 8), xd, yd, zd, out);
+        sample.sigmaT = out[0];
+        sample.albedo = Color3f(out[1], out[2], out[3]);
+        if (m_channels >= 7)
+            sample.radiance = Color3f(out[4], out[5], out[6]);
+        else if (m_channels >= 5)
+            sample.radiance = Color3f(out[4]);
+        else
+            sample.radiance = Color3f(0.f);
     }
     std::string toString() const override {
-        return tfm::format("GridVolume[]");
+        return tfm::format("GridVolume[filename = \"%s\", sparse = %s]", m_filename, m_sparse ? "true" : "false");
     }
 private:
-    std::vector<float> data;
-    int m_xres, m_yres, m_zres, m_channels;
+    /* map a point of the medium's bounding box to its cell and the offsets inside of it */
+    bool toGrid(const Point3f& p, int& x1, int& y1, int& z1, float& xd, float& yd, float& zd) const {
+        Point3f bb_p = (p - m_origin).cwiseProduct(m_toVoxel);
+        x1 = static_cast<int>(std::floor(bb_p.x()));
+        y1 = static_cast<int>(std::floor(bb_p.y()));
+        z1 = static_cast<int>(std::floor(bb_p.z()));
+        if (x1 < 0 || y1 < 0 || z1 < 0 || x1 >= m_xres - 1 || y1 >= m_yres - 1 || z1 >= m_zres - 1)
+            return false;
+        xd = bb_p.x() - x1;
+        yd = bb_p.y() - y1;
+        zd = bb_p.z() - z1;
+        return true;
+    }
+
+    /* fetch the 8 voxels of a cell, ordered c000 .. c111 (offsets along z, y, x) */
+    void fetchCell(int x1, int y1, int z1, int chan, float c[8]) const {
+        if (m_sparse) {
+            m_bricks.fetchCell(x1, y1, z1, chan, c);
+            return;
+        }
+        c[0] = m_data[(((size_t) z1 * m_yres + y1) * m_xres + x1) * m_channels + chan];
+        c[1] = m_data[(((size_t) z1 * m_yres + y1) * m_xres + x1 + 1) * m_channels + chan];
+        c[2] = m_data[(((size_t) z1 * m_yres + y1 + 1) * m_xres + x1) * m_channels + chan];
+        c[3] = m_data[(((size_t) z1 * m_yres + y1 + 1) * m_xres + x1 + 1) * m_channels + chan];
+        c[4] = m_data[((((size_t) z1 + 1) * m_yres + y1) * m_xres + x1) * m_channels + chan];
+        c[5] = m_data[((((size_t) z1 + 1) * m_yres + y1) * m_xres + x1 + 1) * m_channels + chan];
+        c[6] = m_data[((((size_t) z1 + 1) * m_yres + y1 + 1) * m_xres + x1) * m_channels + chan];
+        c[7] = m_data[((((size_t) z1 + 1) * m_yres + y1 + 1) * m_xres + x1 + 1) * m_channels + chan];
+    }
+
+    /* pointers to the channels of the 8 voxels of a cell, in the order of fetchCell();
+    voxels of empty bricks are null */
+    void fetchCorners(int x1, int y1, int z1, const float* corners[8]) const {
+        if (m_sparse) {
+            for (int i = 0; i < 8; i++)
+                corners[i] = m_bricks.getVoxel(x1 + (i & 1), y1 + ((i >> 1) & 1), z1 + (i >> 2));
+            return;
+        }
+        size_t dx = m_channels, dy = (size_t) m_xres * m_channels, dz = (size_t) m_yres * dy;
+        const float* base = m_data + (((size_t) z1 * m_yres + y1) * m_xres + x1) * m_channels;
+        corners[0] = base;
+        corners[1] = base + dx;
+        corners[2] = base + dy;
+        corners[3] = base + dy + dx;
+        corners[4] = base + dz;
+        corners[5] = base + dz + dx;
+        corners[6] = base + dz + dy;
+        corners[7] = base + dz + dy + dx;
+    }
+
+    std::shared_ptr<const MemoryMappedFile> m_file;
+    const float* m_data = nullptr;
+    BrickGrid m_bricks;
+    bool m_sparse;
+    int m_xres = 0, m_yres = 0, m_zres = 0, m_channels = 0;
+    Point3f m_origin = Point3f(0.f);
+    Vector3f m_toVoxel = Vector3f(0.f);
     std::string m_filename;
 };
 NORI_REGISTER_CLASS(GridVolume, "grid");
-NORI_NAMESPACE_END
\ No newline at end of file
+NORI_NAMESPACE_END
@@ -19,6 +19,13 @@ public:
         return m_value * exp(-b * h);
         
     };
+    virtual void lookupBounds(const BoundingBox3f& box, float& minValue, float& maxValue) const override {
+        // the density decays monotonically with the height
+        float zMin = this->m_medium->getShape()->getZMin();
+        float b = 6;
+        minValue = m_value * exp(-b * (box.max.z() - zMin));
+        maxValue = m_value * exp(-b * (box.min.z() - zMin));
+    }
     virtual Color3f lookupRGB(const Point3f& p) const override {
         //not used
         return Color3f(0.0f);
@@ -1,6 +1,7 @@
 #include <nori/medium.h>
 #include <nori/shape.h>
 #include <nori/volume.h>
+#include <nori/majorant.h>
 
 NORI_NAMESPACE_BEGIN
 using namespace std;
@@ -10,9 +11,10 @@ public:
 
     Heterogeneous(const PropertyList& propList) {
         m_scale = propList.getFloat("scale", 1.f);
-
-        m_maxDensity = m_scale;
-        m_invMaxDensity = 1.0f / m_scale;
+        // cells per axis of the majorant grid, 1 falls back to a single global majorant
+        m_majorantRes = propList.getInteger("majorantResolution", 16);
+        // count the real and null collisions, printed after rendering
+        m_statistics = propList.getBoolean("statistics", false);
         m_isRGB = propList.getBoolean("isRGB", true);
         if (m_isRGB) {
 
@@ -25,35 +27,59 @@ public:
     }
 
     bool sample_freepath(MediumQueryRecord& mRec, Sampler* sampler) const override{        
-        // sample distance based on delta tracking method, the majorant can be further refined
+        // sample distance based on delta tracking against the per-cell majorants
         Ray3f ray = Ray3f(mRec.ref, -mRec.wi, 0, mRec.tMax);
-        Color3f transmittance = Color3f(1);
         float mint, maxt;
         if (!m_shape->getBoundingBox().rayIntersect(ray, mint, maxt))
             return false;
         mint = std::max(mint, ray.mint);
         maxt = std::min(maxt, ray.maxt);
-        float t = mint;
-        float densityP = 0;
-        
-        while (true) {
-            t += - log(1 - sampler->next1D()) * m_invMaxDensity;
-            if (t >= maxt)
-                break;
+        uint64_t nullCollisions = 0;
+
+        bool escaped = trackMajorant(m_majorant, ray, mint, maxt, sampler, [&](float t, float majorant) {
             Point3f p = ray(t);
-            densityP = m_extinction->lookupFloat(p) * m_scale;
-            if (densityP * m_invMaxDensity > sampler->next1D()) {
+            MediumSample s;
+            lookup(p, s);
+            if (s.sigmaT * m_scale > majorant * sampler->next1D()) {
                 mRec.p = p;
-                mRec.ret = m_albedo->lookupRGB(p);
-                return true;
+                mRec.ret = m_packed ? s.albedo : m_albedo->lookupRGB(p);
+                return false;
             }
-        }
+            nullCollisions++;
+            return true;
+        });
+        m_majorant.addCollisions(escaped ? 0 : 1, nullCollisions);
+        if (!escaped)
+            return true;
+
         mRec.p = mRec.ref + mRec.tMax * (-mRec.wi);
         mRec.ret = 1.f;
         return false;
     }
 
+    /* estimate the transmittance between mRec.ref and mRec.p by
+    residual ratio tracking against the majorant grid*/
+    Color3f Tr(const MediumQueryRecord& mRec, Sampler* sampler) const override {
+        Ray3f ray = Ray3f(mRec.ref, (mRec.p - mRec.ref).normalized(), 0, (mRec.p - mRec.ref).norm());
+        float mint, maxt;
+        if (!m_shape->getBoundingBox().rayIntersect(ray, mint, maxt))
+            return Color3f(1.f);
+        mint = std::max(mint, ray.mint);
+        maxt = std::min(maxt, ray.maxt);
+        uint64_t lookups = 0;
+        float tr = ratioTrack(m_majorant, ray, mint, maxt, sampler, [&](float t) {
+            return m_extinction->lookupFloat(ray(t)) * m_scale;
+        }, lookups);
+        m_majorant.addRatioLookups(lookups);
+        return Color3f(tr);
+    }
+
     Color3f eval(const MediumQueryRecord& mRec) const {
+        if (m_packed) {
+            MediumSample s;
+            m_packed->lookupMedium(mRec.ref, s);
+            return s.albedo;
+        }
         return m_albedo->lookupFloat(mRec.ref);
     }
 
@@ -72,6 +98,11 @@ public:
                 m_albedo = static_cast<Volume*>(obj);
                 m_albedo->setMedium(static_cast<Medium*>(this));
             }
+            else if (obj->getIdName() == "packed") {
+                // the extinction lookups of the majorant grid and ratio tracking read channel 0
+                m_packed = m_extinction = static_cast<Volume*>(obj);
+                m_packed->setMedium(static_cast<Medium*>(this));
+            }
             else if (obj->getIdName() == "sigma_t") {
                 m_extinction = static_cast<Volume*>(obj);
                 m_extinction->setMedium(static_cast<Medium*>(this));
@@ -85,12 +116,17 @@ public:
 
     virtual bool isHeterogeneous() const override{ return true; }
     virtual void volGrid() {
-        if (m_extinction->isPerlin()) {
-            m_extinction->gridGeneration();
-        }
-        if (m_albedo->isPerlin()) {
-            m_albedo->gridGeneration();
+        if (!m_extinction || (!m_packed && !m_albedo))
+            throw NoriException("Heterogeneous: needs either a packed volume or sigma_t and albedo volumes!");
+        for (Volume* volume : { m_extinction, m_albedo }) {
+            if (volume)
+                volume->gridGeneration();
         }
+        m_majorant.build(m_extinction, m_shape->getBoundingBox(), m_scale, m_majorantRes);
+        m_majorant.setStatistics(m_statistics);
+    }
+    virtual std::string getStatistics() const override {
+        return m_majorant.getStatistics();
     }
     std::string toString() const override {
         return tfm::format(
@@ -98,21 +134,32 @@ public:
             "  scale = %s,\n"
             "  sigmaT = %s,\n"
             "  albedo = %s,\n"
-
+            "  majorant = %s\n"
             "]",
             m_scale,
             m_extinction->toString(),
-            m_albedo->toString());
+            m_albedo ? m_albedo->toString() : (m_packed ? "packed" : "null"),
+            m_majorant.toString());
     }
 
 
 protected:
+    /* extinction at p; a packed volume also returns the other coefficients
+    of the same cell, which saves their lookups at real collisions */
+    void lookup(const Point3f& p, MediumSample& s) const {
+        if (m_packed)
+            m_packed->lookupMedium(p, s);
+        else
+            s.sigmaT = m_extinction->lookupFloat(p);
+    }
 
     Volume* m_extinction = nullptr;
     Volume* m_albedo = nullptr;
+    Volume* m_packed = nullptr;
     float m_scale;
-    float m_maxDensity;
-    float m_invMaxDensity;
+    int m_majorantRes;
+    bool m_statistics;
+    MajorantGrid m_majorant;
     bool m_isRGB;
 };
 
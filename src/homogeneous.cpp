@@ -108,6 +108,14 @@ public:
         }
     }
 
+    /* evaluate the transmittance between mRec.ref and mRec.p analytically */
+    Color3f Tr(const MediumQueryRecord& mRec, Sampler* sampler) const override {
+        float distance = (mRec.p - mRec.ref).norm();
+        if (m_isRGB)
+            return (-m_sigma_t * distance).exp();
+        return Color3f(exp(-m_sigmaT_f * distance));
+    }
+
     Color3f eval(const MediumQueryRecord& mRec) const {
         return m_albedo;
     }
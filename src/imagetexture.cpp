@@ -4,6 +4,7 @@
 #include <nori/lodepng.h>
 #include <nori/object.h>
 #include <nori/texture.h>
+#include <nori/assetcache.h>
 #include <filesystem/resolver.h>
 
 NORI_NAMESPACE_BEGIN
@@ -19,11 +20,19 @@ public:
         filesystem::path filePath = getFileResolver()->resolve(m_name);
         //decode from https://raw.githubusercontent.com/lvandeve/lodepng/master/examples/example_decode.cpp
         //row wise. so first we have first row, then second row...
-        unsigned error = lodepng::decode(m_image, m_width, m_height, filePath.str());
+        //textures referenced several times are decoded once and shared
+        static AssetCache<Image> cache;
+        m_image = cache.get(makeAssetKey("png", filePath.str()), [&] {
+            auto image = std::make_shared<Image>();
+            unsigned error = lodepng::decode(image->pixels, image->width, image->height, filePath.str());
+            //if there's an error, display it
+            if(error) std::cout << "decoder error " << error << ": " << lodepng_error_text(error) << std::endl;
+            return image;
+        });
+        m_width = m_image->width;
+        m_height = m_image->height;
         std::cout << "width: " << m_width << endl;
         std::cout << "height: " << m_height << endl;
-        //if there's an error, display it
-        if(error) std::cout << "decoder error " << error << ": " << lodepng_error_text(error) << std::endl;
     }
 
 
@@ -41,13 +50,14 @@ public:
         if (v > m_height - 1) v = m_height - 1;*/
         //i find the index by multiplying the v for the width. this way i know in which row I am. then i add u for the cell
         long index = (v * m_width +u )*4;
-        index = index % m_image.size(); //MODULO DIMENSIONE DELLA IMMAGINE (numero di pixel, every pixel has rgb values). in modo da avere unindice compreso tra 0 e dimensione immagine (RGBA)
+        const std::vector<unsigned char> &pixels = m_image->pixels;
+        index = index % pixels.size(); //MODULO DIMENSIONE DELLA IMMAGINE (numero di pixel, every pixel has rgb values). in modo da avere unindice compreso tra 0 e dimensione immagine (RGBA)
 
         //http://viclw17.github.io/2019/04/12/raytracing-uv-mapping-and-texturing/
         // RGBA RGBA RGBA RGBA......
-        float r = m_image[index] / 255.0;
-        float g = m_image[index + 1] / 255.0;
-        float b = m_image[index + 2] / 255.0;
+        float r = pixels[index] / 255.0;
+        float g = pixels[index + 1] / 255.0;
+        float b = pixels[index + 2] / 255.0;
 
         return Color3f(r, g, b);
     }
@@ -68,9 +78,16 @@ public:
     }
 
 protected:
+    //decoded RGBA pixels, row wise
+    struct Image {
+        std::vector<unsigned char> pixels;
+        unsigned width = 0;
+        unsigned height = 0;
+    };
+
     Vector2f m_scale;
     std::string m_name;
-    std::vector<unsigned char> m_image;
+    std::shared_ptr<const Image> m_image;
     unsigned m_width;
     unsigned m_height;
 };
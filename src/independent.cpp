@@ -18,6 +18,7 @@
 
 #include <nori/sampler.h>
 #include <nori/block.h>
+#include <nori/lowdiscrepancy.h>
 #include <pcg32.h>
 
 NORI_NAMESPACE_BEGIN
@@ -29,11 +30,20 @@ NORI_NAMESPACE_BEGIN
  * This class is essentially just a wrapper around the pcg32 pseudorandom
  * number generator. For more details on what sample generators do in
  * general, refer to the \ref Sampler class.
+ *
+ * When the renderer announces a pixel sample via \ref startPixelSample(),
+ * the generator is seeded from a hash of the pixel and the \c seed
+ * property and then advanced to the start of the sample's own section
+ * of the stream (2^16 values per sample). Every number is therefore a
+ * function of (pixel, sample index, dimension) alone, so images do not
+ * depend on the block size, the thread count or the scheduling, and
+ * any pixel sample can be regenerated in isolation.
  */
 class Independent : public Sampler {
 public:
     Independent(const PropertyList &propList) {
         m_sampleCount = (size_t) propList.getInteger("sampleCount", 1);
+        m_seed = (uint32_t) propList.getInteger("seed", 0);
     }
 
     virtual ~Independent() { }
@@ -41,6 +51,7 @@ public:
     std::unique_ptr<Sampler> clone() const {
         std::unique_ptr<Independent> cloned(new Independent());
         cloned->m_sampleCount = m_sampleCount;
+        cloned->m_seed = m_seed;
         cloned->m_random = m_random;
         return std::move(cloned);
     }
@@ -55,6 +66,13 @@ public:
     void generate() { /* No-op for this sampler */ }
     void advance()  { /* No-op for this sampler */ }
 
+    void startPixelSample(const Point2i &pixel, uint32_t index) {
+        uint64_t hash = hashCombine(mixBits(((uint64_t) (uint32_t) pixel.x() << 32) |
+                                            (uint32_t) pixel.y()), m_seed);
+        m_random.seed(hash, mixBits(hash));
+        m_random.advance((int64_t) index * SampleStride);
+    }
+
     float next1D() {
         return m_random.nextFloat();
     }
@@ -67,12 +85,16 @@ public:
     }
 
     virtual std::string toString() const override {
-        return tfm::format("Independent[sampleCount=%i]", m_sampleCount);
+        return tfm::format("Independent[sampleCount=%i, seed=%i]", m_sampleCount, m_seed);
     }
 protected:
     Independent() { }
 
 private:
+    /// Length of the section of the random stream reserved for one sample
+    static const int64_t SampleStride = 1 << 16;
+
+    uint32_t m_seed = 0;
     pcg32 m_random;
 };
 
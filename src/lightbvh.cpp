@@ -0,0 +1,307 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/lightbvh.h>
+#include <Eigen/Geometry>
+#include <algorithm>
+
+NORI_NAMESPACE_BEGIN
+
+static inline float safeSqrt(float value) { return std::sqrt(std::max(value, 0.f)); }
+static inline float safeAcos(float value) { return std::acos(clamp(value, -1.f, 1.f)); }
+
+/// cos(max(0, a - b)) given the sines and cosines of both angles
+static inline float cosSubClamped(float sinA, float cosA, float sinB, float cosB) {
+    return cosA > cosB ? 1.f : cosA * cosB + sinA * sinB;
+}
+
+/// sin(max(0, a - b)) given the sines and cosines of both angles
+static inline float sinSubClamped(float sinA, float cosA, float sinB, float cosB) {
+    return cosA > cosB ? 0.f : sinA * cosB - cosA * sinB;
+}
+
+LightBounds LightBounds::merge(const LightBounds &a, const LightBounds &b) {
+    if (a.phi == 0.f)
+        return b;
+    if (b.phi == 0.f)
+        return a;
+
+    LightBounds result;
+    result.bounds = BoundingBox3f::merge(a.bounds, b.bounds);
+    result.phi = a.phi + b.phi;
+    result.cosTheta_e = std::min(a.cosTheta_e, b.cosTheta_e);
+    result.twoSided = a.twoSided || b.twoSided;
+
+    /* Smallest cone containing both normal cones */
+    float theta_a = safeAcos(a.cosTheta_o), theta_b = safeAcos(b.cosTheta_o);
+    float theta_d = safeAcos(a.w.dot(b.w));
+    if (std::min(theta_d + theta_b, M_PI) <= theta_a) {
+        result.w = a.w;
+        result.cosTheta_o = a.cosTheta_o;
+    } else if (std::min(theta_d + theta_a, M_PI) <= theta_b) {
+        result.w = b.w;
+        result.cosTheta_o = b.cosTheta_o;
+    } else {
+        float theta_o = 0.5f * (theta_a + theta_d + theta_b);
+        Vector3f wr = a.w.cross(b.w);
+        if (theta_o >= M_PI || wr.squaredNorm() == 0.f) {
+            result.w = a.w;
+            result.cosTheta_o = -1.f;
+        } else {
+            result.w = (Eigen::AngleAxisf(theta_o - theta_a, wr.normalized()) * a.w).normalized();
+            result.cosTheta_o = std::cos(theta_o);
+        }
+    }
+    return result;
+}
+
+float LightBounds::importance(const Point3f &p, const Normal3f &n) const {
+    Point3f pc = bounds.getCenter();
+    float d2 = (p - pc).squaredNorm();
+    float radius = 0.5f * bounds.getExtents().norm();
+    /* Avoid the singularity when the point is close to the light */
+    d2 = std::max(d2, radius);
+
+    Vector3f wi = (p - pc).normalized();
+    if (!std::isfinite(wi.x()))
+        wi = Vector3f(0.f, 0.f, 1.f);
+    float cosTheta_w = w.dot(wi);
+    if (twoSided)
+        cosTheta_w = std::abs(cosTheta_w);
+    float sinTheta_w = safeSqrt(1.f - cosTheta_w * cosTheta_w);
+
+    /* Angle subtended by the bounding sphere of the bounds */
+    float cosTheta_b = -1.f;
+    float dist2 = (p - pc).squaredNorm();
+    if (dist2 > radius * radius)
+        cosTheta_b = safeSqrt(1.f - radius * radius / dist2);
+    float sinTheta_b = safeSqrt(1.f - cosTheta_b * cosTheta_b);
+
+    /* Minimum angle between the emitted directions and the direction to p */
+    float sinTheta_o = safeSqrt(1.f - cosTheta_o * cosTheta_o);
+    float cosTheta_x = cosSubClamped(sinTheta_w, cosTheta_w, sinTheta_o, cosTheta_o);
+    float sinTheta_x = sinSubClamped(sinTheta_w, cosTheta_w, sinTheta_o, cosTheta_o);
+    float cosThetap = cosSubClamped(sinTheta_x, cosTheta_x, sinTheta_b, cosTheta_b);
+    if (cosThetap <= cosTheta_e)
+        return 0.f;
+
+    float result = phi * cosThetap / d2;
+
+    /* Bound the cosine at the receiving point */
+    if (n != Normal3f(0.f)) {
+        float cosTheta_i = std::abs(wi.dot(n));
+        float sinTheta_i = safeSqrt(1.f - cosTheta_i * cosTheta_i);
+        result *= cosSubClamped(sinTheta_i, cosTheta_i, sinTheta_b, cosTheta_b);
+    }
+
+    return std::max(result, 0.f);
+}
+
+/// Orientation-aware cost of a cluster (Conty Estevez and Kulla, Eq. 2)
+static float evaluateCost(const LightBounds &b, const BoundingBox3f &bounds, int dim) {
+    float theta_o = safeAcos(b.cosTheta_o), theta_e = safeAcos(b.cosTheta_e);
+    float theta_w = std::min(theta_o + theta_e, M_PI);
+    float sinTheta_o = safeSqrt(1.f - b.cosTheta_o * b.cosTheta_o);
+    float M_omega = 2.f * M_PI * (1.f - b.cosTheta_o) +
+        M_PI / 2.f * (2.f * theta_w * sinTheta_o - std::cos(theta_o - 2.f * theta_w) -
+                      2.f * theta_o * sinTheta_o + b.cosTheta_o);
+
+    /* Penalize thin slabs that would be split along their short side */
+    Vector3f extents = bounds.getExtents();
+    float Kr = extents[dim] > 0.f ? extents.maxCoeff() / extents[dim] : 0.f;
+    return b.phi * M_omega * Kr * b.bounds.getSurfaceArea();
+}
+
+LightBVH::LightBVH(const std::vector<Emitter *> &emitters, const std::vector<float> &power)
+    : m_emitters(emitters) {
+    std::vector<std::pair<uint32_t, LightBounds>> lights;
+    for (size_t i = 0; i < emitters.size(); ++i) {
+        m_firstLight[emitters[i]] = (uint32_t) m_lights.size();
+        uint32_t count = emitters[i]->getPrimitiveLightCount();
+        for (uint32_t j = 0; j < count; ++j) {
+            lights.emplace_back((uint32_t) m_lights.size(), count > 1 ?
+                emitters[i]->getPrimitiveLightBounds(j, power[i]) : emitters[i]->getLightBounds(power[i]));
+            m_lights.push_back(Light { (uint32_t) i, j, count > 1 });
+        }
+    }
+    m_bitTrails.resize(m_lights.size(), 0);
+    if (!lights.empty()) {
+        m_nodes.reserve(2 * lights.size() - 1);
+        build(lights, 0, lights.size(), 0, 0);
+    }
+}
+
+uint32_t LightBVH::build(std::vector<std::pair<uint32_t, LightBounds>> &lights,
+                         size_t begin, size_t end, uint64_t bitTrail, int depth) {
+    if (end - begin == 1) {
+        uint32_t nodeIndex = (uint32_t) m_nodes.size();
+        m_nodes.push_back(Node { lights[begin].second, lights[begin].first, true });
+        m_bitTrails[lights[begin].first] = bitTrail;
+        return nodeIndex;
+    }
+
+    BoundingBox3f bounds, centroidBounds;
+    for (size_t i = begin; i < end; ++i) {
+        bounds.expandBy(lights[i].second.bounds);
+        centroidBounds.expandBy(lights[i].second.bounds.getCenter());
+    }
+
+    /* Evaluate the cost of bucketed splits along every axis */
+    const int nBuckets = 12;
+    float minCost = std::numeric_limits<float>::infinity();
+    int minDim = -1, minBucket = -1;
+    auto bucketOf = [&](const LightBounds &lb, int dim) {
+        float extent = centroidBounds.max[dim] - centroidBounds.min[dim];
+        int b = (int) (nBuckets * (lb.bounds.getCenter()[dim] - centroidBounds.min[dim]) / extent);
+        return clamp(b, 0, nBuckets - 1);
+    };
+
+    /* Past this depth, split by count so that the bit trails fit into 64 bits */
+    if (depth < 48) {
+        for (int dim = 0; dim < 3; ++dim) {
+            if (centroidBounds.max[dim] == centroidBounds.min[dim])
+                continue;
+            LightBounds buckets[nBuckets];
+            for (size_t i = begin; i < end; ++i) {
+                int b = bucketOf(lights[i].second, dim);
+                buckets[b] = LightBounds::merge(buckets[b], lights[i].second);
+            }
+
+            for (int split = 0; split < nBuckets - 1; ++split) {
+                LightBounds below, above;
+                for (int b = 0; b <= split; ++b)
+                    below = LightBounds::merge(below, buckets[b]);
+                for (int b = split + 1; b < nBuckets; ++b)
+                    above = LightBounds::merge(above, buckets[b]);
+                float cost = evaluateCost(below, bounds, dim) + evaluateCost(above, bounds, dim);
+                if (cost > 0.f && cost < minCost) {
+                    minCost = cost;
+                    minDim = dim;
+                    minBucket = split;
+                }
+            }
+        }
+    }
+
+    size_t mid = (begin + end) / 2;
+    if (minDim >= 0) {
+        auto it = std::partition(lights.begin() + begin, lights.begin() + end,
+            [&](const std::pair<uint32_t, LightBounds> &l) {
+                return bucketOf(l.second, minDim) <= minBucket;
+            });
+        mid = (size_t) (it - lights.begin());
+    }
+    if (mid == begin || mid == end) {
+        mid = (begin + end) / 2;
+        int dim = centroidBounds.getMajorAxis();
+        std::nth_element(lights.begin() + begin, lights.begin() + mid, lights.begin() + end,
+            [&](const std::pair<uint32_t, LightBounds> &a, const std::pair<uint32_t, LightBounds> &b) {
+                return a.second.bounds.getCenter()[dim] < b.second.bounds.getCenter()[dim];
+            });
+    }
+
+    uint32_t nodeIndex = (uint32_t) m_nodes.size();
+    m_nodes.push_back(Node { LightBounds(), 0, false });
+    build(lights, begin, mid, bitTrail, depth + 1);
+    uint32_t secondChild = build(lights, mid, end, bitTrail | (uint64_t(1) << depth), depth + 1);
+
+    Node &node = m_nodes[nodeIndex];
+    node.bounds = LightBounds::merge(m_nodes[nodeIndex + 1].bounds, m_nodes[secondChild].bounds);
+    node.index = secondChild;
+    return nodeIndex;
+}
+
+float LightBVH::childProbability(const Point3f &p, const Normal3f &n, uint32_t node) const {
+    float i0 = m_nodes[node + 1].bounds.importance(p, n),
+          i1 = m_nodes[m_nodes[node].index].bounds.importance(p, n);
+    if (i0 + i1 == 0.f)
+        return -1.f;
+    return i0 / (i0 + i1);
+}
+
+const Emitter *LightBVH::sample(const Point3f &p, const Normal3f &n, float sample, float &pdf,
+                                EmitterQueryRecord &lRec) const {
+    pdf = 0.f;
+    if (m_nodes.empty())
+        return nullptr;
+
+    uint32_t nodeIndex = 0;
+    float pmf = 1.f;
+    while (!m_nodes[nodeIndex].leaf) {
+        float p0 = childProbability(p, n, nodeIndex);
+        if (p0 < 0.f)
+            return nullptr;
+        if (sample < p0) {
+            sample = std::min(sample / p0, OneMinusEpsilon);
+            pmf *= p0;
+            nodeIndex = nodeIndex + 1;
+        } else {
+            sample = std::min((sample - p0) / (1.f - p0), OneMinusEpsilon);
+            pmf *= 1.f - p0;
+            nodeIndex = m_nodes[nodeIndex].index;
+        }
+    }
+
+    /* A single light is only worth a shadow ray if it can contribute */
+    if (nodeIndex == 0 && m_nodes[0].bounds.importance(p, n) == 0.f)
+        return nullptr;
+
+    pdf = pmf;
+    const Light &light = m_lights[m_nodes[nodeIndex].index];
+    lRec.primIndex = light.primIndex;
+    lRec.fixedPrimitive = light.fixedPrimitive;
+    return m_emitters[light.emitter];
+}
+
+float LightBVH::pdf(const Point3f &p, const Normal3f &n, const Emitter *emitter,
+                    EmitterQueryRecord &lRec) const {
+    lRec.fixedPrimitive = false;
+    auto it = m_firstLight.find(emitter);
+    if (it == m_firstLight.end())
+        return 0.f;
+
+    uint32_t lightIndex = it->second;
+    if (m_lights[lightIndex].fixedPrimitive) {
+        lightIndex += lRec.primIndex;
+        if (lightIndex >= m_lights.size() || m_emitters[m_lights[lightIndex].emitter] != emitter)
+            return 0.f;
+        lRec.fixedPrimitive = true;
+    }
+
+    uint64_t bitTrail = m_bitTrails[lightIndex];
+    uint32_t nodeIndex = 0;
+    float pmf = 1.f;
+    while (!m_nodes[nodeIndex].leaf) {
+        float p0 = childProbability(p, n, nodeIndex);
+        if (p0 < 0.f)
+            return 0.f;
+        if (bitTrail & 1) {
+            pmf *= 1.f - p0;
+            nodeIndex = m_nodes[nodeIndex].index;
+        } else {
+            pmf *= p0;
+            nodeIndex = nodeIndex + 1;
+        }
+        bitTrail >>= 1;
+    }
+    if (nodeIndex == 0 && m_nodes[0].bounds.importance(p, n) == 0.f)
+        return 0.f;
+    return pmf;
+}
+
+NORI_NAMESPACE_END
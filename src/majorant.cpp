@@ -0,0 +1,78 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/majorant.h>
+#include <nori/volume.h>
+
+NORI_NAMESPACE_BEGIN
+
+void MajorantGrid::build(const Volume *volume, const BoundingBox3f &bbox, float scale, int res) {
+    if (res < 1)
+        throw NoriException("MajorantGrid: the resolution must be positive (got %i)", res);
+
+    m_bbox = bbox;
+    m_res = res;
+    m_majorant.resize((size_t) res * res * res);
+    m_minorant.resize((size_t) res * res * res);
+    m_maxMajorant = 0.f;
+    m_emptyCells = 0;
+
+    Vector3f cellSize = bbox.getExtents() / (float) res;
+    for (int z = 0; z < res; ++z) {
+        for (int y = 0; y < res; ++y) {
+            for (int x = 0; x < res; ++x) {
+                int cell[3] = { x, y, z };
+                Point3f min = bbox.min + cellSize.cwiseProduct(Vector3f(x, y, z));
+                BoundingBox3f box(min, min + cellSize);
+
+                float minValue, maxValue;
+                volume->lookupBounds(box, minValue, maxValue);
+                float majorant = std::max(maxValue * scale, 0.f);
+                float minorant = clamp(minValue * scale, 0.f, majorant);
+
+                m_majorant[index(cell)] = majorant;
+                m_minorant[index(cell)] = minorant;
+                m_maxMajorant = std::max(m_maxMajorant, majorant);
+                if (majorant == 0)
+                    m_emptyCells++;
+            }
+        }
+    }
+}
+
+std::string MajorantGrid::getStatistics() const {
+    if (!m_statistics)
+        return "";
+    uint64_t real = 0, null = 0, ratioLookups = 0;
+    for (const TrackingCounters &counters : m_counters) {
+        real += counters.real;
+        null += counters.null;
+        ratioLookups += counters.ratioLookups;
+    }
+    uint64_t total = real + null;
+    return tfm::format("%i real / %i null collisions (%.1f%% null), %i ratio tracking lookups",
+        real, null, total > 0 ? 100.0 * null / total : 0.0, ratioLookups);
+}
+
+std::string MajorantGrid::toString() const {
+    return tfm::format(
+        "MajorantGrid[resolution = %i, maxMajorant = %f, emptyCells = %i/%i]",
+        m_res, m_maxMajorant, m_emptyCells, m_majorant.size());
+}
+
+NORI_NAMESPACE_END
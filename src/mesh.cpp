@@ -22,66 +22,407 @@
 #include <nori/emitter.h>
 #include <nori/warp.h>
 #include <Eigen/Geometry>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
 
 NORI_NAMESPACE_BEGIN
 
 Mesh::Mesh() { }
 
+void Mesh::setMeshData(MatrixXf &&V, MatrixXf &&N, MatrixXf &&UV, MatrixXu &&F) {
+    auto data = std::make_shared<MeshData>();
+    data->V = std::move(V);
+    data->N = std::move(N);
+    data->UV = std::move(UV);
+    data->F = std::move(F);
+    setMeshData(data);
+}
+
+void Mesh::setMeshData(const std::shared_ptr<const MeshData> &data) {
+    uint32_t faceCount = (uint32_t) (data->F16.empty() ? data->F.cols() : data->F16.size() / 3);
+    setMeshData(data, (uint32_t) data->V.cols(), faceCount,
+        data->V.data(),
+        data->N.size() > 0 ? data->N.data() : nullptr,
+        data->UV.size() > 0 ? data->UV.data() : nullptr,
+        data->F.size() > 0 ? data->F.data() : nullptr);
+    m_meshData = data.get();
+
+    if (!data->Noct.empty())
+        m_Noct = data->Noct.data();
+    if (!data->UVq.empty()) {
+        m_UVq = data->UVq.data();
+        m_uvOffset = data->uvOffset;
+        m_uvScale = data->uvScale;
+    }
+    if (!data->F16.empty())
+        m_F16 = data->F16.data();
+}
+
+void Mesh::setMeshData(const std::shared_ptr<const void> &storage,
+                       uint32_t vertexCount, uint32_t faceCount,
+                       const float *V, const float *N, const float *UV,
+                       const uint32_t *F, const float *areas) {
+    /* Eigen::Map cannot be reassigned, so rebind the views in place */
+    new (&m_V) MatrixXfMap(V, 3, vertexCount);
+    new (&m_N) MatrixXfMap(N, 3, N ? vertexCount : 0);
+    new (&m_UV) MatrixXfMap(UV, 2, UV ? vertexCount : 0);
+    new (&m_F) MatrixXuMap(F, 3, F ? faceCount : 0);
+    m_faceCount = faceCount;
+    m_areas = areas;
+    m_storage = storage;
+    m_meshData = nullptr;
+
+    m_Noct = nullptr;
+    m_UVq = nullptr;
+    m_F16 = nullptr;
+}
+
 void Mesh::activate() {
     Shape::activate();
 
     m_pdf.reserve(getPrimitiveCount());
     for(uint32_t i = 0 ; i < getPrimitiveCount() ; ++i) {
-        m_pdf.append(surfaceArea(i));
+        m_pdf.append(m_areas ? m_areas[i] : surfaceArea(i));
     }
     m_pdf.normalize();
+
+    /* Meshes bounding a medium need fast inside/outside queries */
+    if (m_medium)
+        buildInsideGrid();
+}
+
+/* Spherical triangle sampling is numerically unreliable for very small
+   and very large solid angles; such triangles are sampled by area */
+static const float MinSphericalTriangleArea = 3e-4f;
+static const float MaxSphericalTriangleArea = 6.22f;
+
+float Mesh::getSolidAngle(uint32_t index, const Point3f &ref) const {
+    Vector3f a = (m_V.col(getVertexIndex(index, 0)) - ref).normalized(),
+             b = (m_V.col(getVertexIndex(index, 1)) - ref).normalized(),
+             c = (m_V.col(getVertexIndex(index, 2)) - ref).normalized();
+    float solidAngle = Warp::sphericalTriangleArea(a, b, c);
+    if (!(solidAngle >= MinSphericalTriangleArea && solidAngle <= MaxSphericalTriangleArea))
+        return 0.f;
+    return solidAngle;
 }
 
 void Mesh::sampleSurface(ShapeQueryRecord & sRec, const Point2f & sample) const {
     Point2f s = sample;
-    size_t idT = m_pdf.sampleReuse(s.x());
-
-    Vector3f bc = Warp::squareToUniformTriangle(s);
+    size_t idT = sRec.fixedPrimitive ? sRec.primIndex : m_pdf.sampleCDFReuse(s.x());
+
+    Point3f p0 = m_V.col(getVertexIndex(idT, 0));
+    Point3f p1 = m_V.col(getVertexIndex(idT, 1));
+    Point3f p2 = m_V.col(getVertexIndex(idT, 2));
+
+    Vector3f bc;
+    if (sRec.hasRef && getSolidAngle(idT, sRec.ref) > 0.f) {
+        /* Sample a direction in the solid angle subtended by the
+           triangle and find where it crosses the triangle */
+        Vector3f w = Warp::squareToSphericalTriangle(s,
+            (p0 - sRec.ref).normalized(), (p1 - sRec.ref).normalized(),
+            (p2 - sRec.ref).normalized());
+        Vector3f e1 = p1 - p0, e2 = p2 - p0, o = sRec.ref - p0;
+        Vector3f s1 = w.cross(e2);
+        float divisor = s1.dot(e1);
+        if (divisor == 0.f) {
+            bc = Vector3f(1.f, 0.f, 0.f);
+        } else {
+            float b1 = clamp(o.dot(s1) / divisor, 0.f, 1.f);
+            float b2 = clamp(w.dot(o.cross(e1)) / divisor, 0.f, 1.f);
+            if (b1 + b2 > 1.f) {
+                float sum = b1 + b2;
+                b1 /= sum;
+                b2 /= sum;
+            }
+            bc = Vector3f(1.f - b1 - b2, b1, b2);
+        }
+    } else {
+        bc = Warp::squareToUniformTriangle(s);
+    }
 
     sRec.p = getInterpolatedVertex(idT,bc);
-    if (m_N.size() > 0) {
+    if (hasVertexNormals()) {
         sRec.n = getInterpolatedNormal(idT, bc);
     }
     else {
-        Point3f p0 = m_V.col(m_F(0, idT));
-        Point3f p1 = m_V.col(m_F(1, idT));
-        Point3f p2 = m_V.col(m_F(2, idT));
         Normal3f n = (p1-p0).cross(p2-p0).normalized();
         sRec.n = n;
     }
-    sRec.pdf = m_pdf.getNormalization();
+    sRec.primIndex = (uint32_t) idT;
+    sRec.pdf = pdfSurface(sRec);
 }
 float Mesh::pdfSurface(const ShapeQueryRecord & sRec) const {
-    return m_pdf.getNormalization();
+    float solidAngle = sRec.hasRef ? getSolidAngle(sRec.primIndex, sRec.ref) : 0.f;
+    if (solidAngle == 0.f)
+        return sRec.fixedPrimitive ? 1.f / surfaceArea(sRec.primIndex) : m_pdf.getNormalization();
+
+    /* Uniform density over the solid angle, converted to area measure */
+    Vector3f d = sRec.ref - sRec.p;
+    float dist2 = d.squaredNorm();
+    float cosTheta = std::abs(sRec.n.dot(d)) / std::sqrt(dist2);
+    float primPdf = sRec.fixedPrimitive ? 1.f : m_pdf[sRec.primIndex];
+    return primPdf / solidAngle * cosTheta / dist2;
 }
 
 Point3f Mesh::getInterpolatedVertex(uint32_t index, const Vector3f &bc) const {
-    return (bc.x() * m_V.col(m_F(0, index)) +
-            bc.y() * m_V.col(m_F(1, index)) +
-            bc.z() * m_V.col(m_F(2, index)));
+    return (bc.x() * m_V.col(getVertexIndex(index, 0)) +
+            bc.y() * m_V.col(getVertexIndex(index, 1)) +
+            bc.z() * m_V.col(getVertexIndex(index, 2)));
 }
 
 Normal3f Mesh::getInterpolatedNormal(uint32_t index, const Vector3f &bc) const {
-    return (bc.x() * m_N.col(m_F(0, index)) +
-            bc.y() * m_N.col(m_F(1, index)) +
-            bc.z() * m_N.col(m_F(2, index))).normalized();
+    return (bc.x() * getVertexNormal(getVertexIndex(index, 0)) +
+            bc.y() * getVertexNormal(getVertexIndex(index, 1)) +
+            bc.z() * getVertexNormal(getVertexIndex(index, 2))).normalized();
+}
+
+/* Octahedral normal encoding with two 16-bit signed components */
+static inline float signNotZero(float value) {
+    return value >= 0.f ? 1.f : -1.f;
+}
+
+static uint32_t encodeOctahedral(const Normal3f &n) {
+    float l1 = std::abs(n.x()) + std::abs(n.y()) + std::abs(n.z());
+    float x = l1 > 0 ? n.x() / l1 : 0.f, y = l1 > 0 ? n.y() / l1 : 0.f;
+    if (n.z() < 0) {
+        float ox = (1.f - std::abs(y)) * signNotZero(x);
+        float oy = (1.f - std::abs(x)) * signNotZero(y);
+        x = ox; y = oy;
+    }
+    auto quantize = [](float value) {
+        return (uint32_t) (uint16_t) (int16_t) std::round(clamp(value, -1.f, 1.f) * 32767.f);
+    };
+    return quantize(x) | (quantize(y) << 16);
+}
+
+static Normal3f decodeOctahedral(uint32_t value) {
+    float x = (int16_t) (value & 0xFFFF) / 32767.f;
+    float y = (int16_t) (value >> 16) / 32767.f;
+    float z = 1.f - std::abs(x) - std::abs(y);
+    if (z < 0) {
+        float ox = (1.f - std::abs(y)) * signNotZero(x);
+        float oy = (1.f - std::abs(x)) * signNotZero(y);
+        x = ox; y = oy;
+    }
+    return Normal3f(x, y, z).normalized();
+}
+
+Normal3f Mesh::getVertexNormal(uint32_t vertex) const {
+    if (m_Noct)
+        return decodeOctahedral(m_Noct[vertex]);
+    return m_N.col(vertex);
+}
+
+Point2f Mesh::getVertexTexCoord(uint32_t vertex) const {
+    if (m_UVq)
+        return Point2f(
+            m_uvOffset.x() + m_uvScale.x() * m_UVq[2 * vertex],
+            m_uvOffset.y() + m_uvScale.y() * m_UVq[2 * vertex + 1]);
+    return m_UV.col(vertex);
+}
+
+void MeshData::compact() {
+    uint32_t nV = (uint32_t) V.cols(), nF = (uint32_t) F.cols();
+
+    if (N.size() > 0) {
+        Noct.resize(nV);
+        tbb::parallel_for(tbb::blocked_range<uint32_t>(0u, nV),
+            [&](const tbb::blocked_range<uint32_t> &range) {
+                for (uint32_t i = range.begin(); i != range.end(); ++i)
+                    Noct[i] = encodeOctahedral(N.col(i));
+            }
+        );
+        N.resize(0, 0);
+    }
+
+    if (UV.size() > 0) {
+        Point2f uvMin = UV.rowwise().minCoeff(), uvMax = UV.rowwise().maxCoeff();
+        Vector2f extents = uvMax - uvMin;
+        uvOffset = uvMin;
+        uvScale = extents / 65535.f;
+        UVq.resize(2 * (size_t) nV);
+        tbb::parallel_for(tbb::blocked_range<uint32_t>(0u, nV),
+            [&](const tbb::blocked_range<uint32_t> &range) {
+                for (uint32_t i = range.begin(); i != range.end(); ++i) {
+                    for (int k = 0; k < 2; ++k) {
+                        float rel = extents[k] > 0 ? (UV(k, i) - uvMin[k]) / extents[k] : 0.f;
+                        UVq[2 * i + k] = (uint16_t) std::round(clamp(rel, 0.f, 1.f) * 65535.f);
+                    }
+                }
+            }
+        );
+        UV.resize(0, 0);
+    }
+
+    if (nV <= 65536 && F.size() > 0) {
+        F16.resize(3 * (size_t) nF);
+        for (uint32_t i = 0; i < nF; ++i)
+            for (int k = 0; k < 3; ++k)
+                F16[3 * i + k] = (uint16_t) F(k, i);
+        F.resize(0, 0);
+    }
+}
+
+size_t MeshData::getSize() const {
+    return sizeof(float) * (V.size() + N.size() + UV.size()) + sizeof(uint32_t) * (F.size() + Noct.size()) +
+        sizeof(uint16_t) * (UVq.size() + F16.size());
+}
+
+size_t MeshData::getFullSize() const {
+    size_t nV = (size_t) V.cols(), nF = F16.empty() ? (size_t) F.cols() : F16.size() / 3;
+    size_t channels = 3 + (N.size() > 0 || !Noct.empty() ? 3 : 0) + (UV.size() > 0 || !UVq.empty() ? 2 : 0);
+    return sizeof(float) * channels * nV + sizeof(uint32_t) * 3 * nF;
+}
+
+void Mesh::buildInsideGrid() {
+    uint32_t nTris = getPrimitiveCount();
+
+    /* Aim for a handful of triangles per cell */
+    int res = clamp((int) std::sqrt(nTris / 4.f), 1, 256);
+    m_insideRes = Vector2i(res, res);
+    Vector3f extents = m_bbox.getExtents();
+    float scaleY = extents.y() > 0 ? res / extents.y() : 0.f;
+    float scaleZ = extents.z() > 0 ? res / extents.z() : 0.f;
+
+    auto cellY = [&](float y) { return clamp((int) ((y - m_bbox.min.y()) * scaleY), 0, res - 1); };
+    auto cellZ = [&](float z) { return clamp((int) ((z - m_bbox.min.z()) * scaleZ), 0, res - 1); };
+
+    /* Count the triangles overlapping each cell, then scatter them */
+    m_insideCells.assign(res * res + 1, 0u);
+    for (int pass = 0; pass < 2; ++pass) {
+        std::vector<uint32_t> fill;
+        if (pass == 1) {
+            for (int i = 0; i < res * res; ++i)
+                m_insideCells[i + 1] += m_insideCells[i];
+            m_insideTris.resize(m_insideCells.back());
+            fill.assign(m_insideCells.begin(), m_insideCells.end() - 1);
+        }
+        for (uint32_t f = 0; f < nTris; ++f) {
+            BoundingBox3f bbox = getBoundingBox(f);
+            for (int z = cellZ(bbox.min.z()); z <= cellZ(bbox.max.z()); ++z) {
+                for (int y = cellY(bbox.min.y()); y <= cellY(bbox.max.y()); ++y) {
+                    if (pass == 0)
+                        m_insideCells[z * res + y + 1]++;
+                    else
+                        m_insideTris[fill[z * res + y]++] = f;
+                }
+            }
+        }
+    }
+}
+
+bool Mesh::contains(const Point3f &p) const {
+    if (!m_bbox.contains(p))
+        return false;
+
+    /* Does the ray from 'p' along +X cross triangle 'f'? */
+    auto crosses = [&](uint32_t f) {
+        const Point3f p0 = m_V.col(getVertexIndex(f, 0)),
+                      p1 = m_V.col(getVertexIndex(f, 1)),
+                      p2 = m_V.col(getVertexIndex(f, 2));
+        auto edge = [&](const Point3f &a, const Point3f &b) {
+            return (b.y() - a.y()) * (p.z() - a.z()) - (b.z() - a.z()) * (p.y() - a.y());
+        };
+        float w0 = edge(p1, p2), w1 = edge(p2, p0), w2 = edge(p0, p1);
+        float sum = w0 + w1 + w2;
+        if (sum == 0)
+            return false;
+        /* Orient the projected triangle counter-clockwise in (y, z) */
+        float sign = sum > 0 ? 1.f : -1.f;
+        if (w0 * sign < 0 || w1 * sign < 0 || w2 * sign < 0)
+            return false;
+        /* A ray through an edge or vertex shared by several triangles must be
+           counted exactly once: points on an edge only belong to the triangle
+           for which it is a "top-left" edge */
+        auto owns = [&](float w, const Point3f &a, const Point3f &b) {
+            if (w != 0)
+                return true;
+            float dy = sign * (b.y() - a.y()), dz = sign * (b.z() - a.z());
+            return dy > 0 || (dy == 0 && dz < 0);
+        };
+        if (!owns(w0, p1, p2) || !owns(w1, p2, p0) || !owns(w2, p0, p1))
+            return false;
+        return (w0 * p0.x() + w1 * p1.x() + w2 * p2.x()) / sum > p.x();
+    };
+
+    uint32_t crossings = 0;
+    if (m_insideCells.empty()) {
+        /* No acceleration grid was built for this mesh */
+        for (uint32_t f = 0; f < getPrimitiveCount(); ++f)
+            crossings += crosses(f);
+    } else {
+        Vector3f extents = m_bbox.getExtents();
+        int y = extents.y() > 0 ? clamp((int) ((p.y() - m_bbox.min.y()) * m_insideRes.x() / extents.y()), 0, m_insideRes.x() - 1) : 0;
+        int z = extents.z() > 0 ? clamp((int) ((p.z() - m_bbox.min.z()) * m_insideRes.y() / extents.z()), 0, m_insideRes.y() - 1) : 0;
+        int cell = z * m_insideRes.x() + y;
+        for (uint32_t i = m_insideCells[cell]; i < m_insideCells[cell + 1]; ++i)
+            crossings += crosses(m_insideTris[i]);
+    }
+    return (crossings & 1) == 1;
 }
 
 float Mesh::surfaceArea(uint32_t index) const {
-    uint32_t i0 = m_F(0, index), i1 = m_F(1, index), i2 = m_F(2, index);
+    uint32_t i0 = getVertexIndex(index, 0), i1 = getVertexIndex(index, 1),
+             i2 = getVertexIndex(index, 2);
 
     const Point3f p0 = m_V.col(i0), p1 = m_V.col(i1), p2 = m_V.col(i2);
 
     return 0.5f * Vector3f((p1 - p0).cross(p2 - p0)).norm();
 }
 
+void Mesh::getPrimitiveNormalCone(uint32_t index, Vector3f &axis, float &cosTheta) const {
+    const Point3f p0 = m_V.col(getVertexIndex(index, 0)), p1 = m_V.col(getVertexIndex(index, 1)),
+                  p2 = m_V.col(getVertexIndex(index, 2));
+    Vector3f n = (p1 - p0).cross(p2 - p0);
+    axis = Vector3f(0.f, 0.f, 1.f);
+    cosTheta = -1.f;
+    if (n.squaredNorm() == 0.f)
+        return;
+    axis = n.normalized();
+
+    float minCos = 1.f;
+    if (hasVertexNormals()) {
+        for (int k = 0; k < 3; ++k)
+            minCos = std::min(minCos, axis.dot(Vector3f(getVertexNormal(getVertexIndex(index, k))).normalized()));
+    }
+    cosTheta = std::max(minCos - 1e-4f, -1.f);
+}
+
+void Mesh::getNormalCone(Vector3f &axis, float &cosTheta) const {
+    uint32_t nF = getPrimitiveCount(), nV = getVertexCount();
+    auto faceNormal = [&](uint32_t f) -> Vector3f {
+        const Point3f p0 = m_V.col(getVertexIndex(f, 0)), p1 = m_V.col(getVertexIndex(f, 1)),
+                      p2 = m_V.col(getVertexIndex(f, 2));
+        return (p1 - p0).cross(p2 - p0);
+    };
+
+    /* The area-weighted average normal serves as the axis */
+    Vector3f sum(0.f);
+    for (uint32_t f = 0; f < nF; ++f)
+        sum += faceNormal(f);
+    axis = Vector3f(0.f, 0.f, 1.f);
+    cosTheta = -1.f;
+    if (sum.squaredNorm() == 0.f)
+        return;
+    axis = sum.normalized();
+
+    float minCos = 1.f;
+    for (uint32_t f = 0; f < nF; ++f) {
+        Vector3f n = faceNormal(f);
+        float length = n.norm();
+        if (length > 0.f)
+            minCos = std::min(minCos, axis.dot(n) / length);
+    }
+    if (hasVertexNormals()) {
+        for (uint32_t i = 0; i < nV; ++i)
+            minCos = std::min(minCos, axis.dot(Vector3f(getVertexNormal(i)).normalized()));
+    }
+    cosTheta = std::max(minCos - 1e-4f, -1.f);
+}
+
 bool Mesh::rayIntersect(uint32_t index, const Ray3f &ray, float &u, float &v, float &t) const {
-    uint32_t i0 = m_F(0, index), i1 = m_F(1, index), i2 = m_F(2, index);
+    uint32_t i0 = getVertexIndex(index, 0), i1 = getVertexIndex(index, 1),
+             i2 = getVertexIndex(index, 2);
     const Point3f p0 = m_V.col(i0), p1 = m_V.col(i1), p2 = m_V.col(i2);
 
     /* Find vectors for two edges sharing v[0] */
@@ -125,7 +466,8 @@ void Mesh::setHitInformation(uint32_t index, const Ray3f &ray, Intersection & it
     bary << 1-its.uv.sum(), its.uv;
 
     /* Vertex indices of the triangle */
-    uint32_t idx0 = m_F(0, index), idx1 = m_F(1, index), idx2 = m_F(2, index);
+    uint32_t idx0 = getVertexIndex(index, 0), idx1 = getVertexIndex(index, 1),
+             idx2 = getVertexIndex(index, 2);
 
     Point3f p0 = m_V.col(idx0), p1 = m_V.col(idx1), p2 = m_V.col(idx2);
 
@@ -134,15 +476,15 @@ void Mesh::setHitInformation(uint32_t index, const Ray3f &ray, Intersection & it
     its.p = bary.x() * p0 + bary.y() * p1 + bary.z() * p2;
 
     /* Compute proper texture coordinates if provided by the mesh */
-    if (m_UV.size() > 0)
-        its.uv = bary.x() * m_UV.col(idx0) +
-                 bary.y() * m_UV.col(idx1) +
-                 bary.z() * m_UV.col(idx2);
+    if (hasTexCoords())
+        its.uv = bary.x() * getVertexTexCoord(idx0) +
+                 bary.y() * getVertexTexCoord(idx1) +
+                 bary.z() * getVertexTexCoord(idx2);
 
     /* Compute the geometry frame */
     its.geoFrame = Frame((p1-p0).cross(p2-p0).normalized());
 
-    if (m_N.size() > 0) {
+    if (hasVertexNormals()) {
         /* Compute the shading frame. Note that for simplicity,
            the current implementation doesn't attempt to provide
            tangents that are continuous across the surface. That
@@ -150,26 +492,106 @@ void Mesh::setHitInformation(uint32_t index, const Ray3f &ray, Intersection & it
            use anisotropic BRDFs, which need tangent continuity */
 
         its.shFrame = Frame(
-                (bary.x() * m_N.col(idx0) +
-                 bary.y() * m_N.col(idx1) +
-                 bary.z() * m_N.col(idx2)).normalized());
+                (bary.x() * getVertexNormal(idx0) +
+                 bary.y() * getVertexNormal(idx1) +
+                 bary.z() * getVertexNormal(idx2)).normalized());
     } else {
         its.shFrame = its.geoFrame;
     }
+
+    its.primIndex = index;
+}
+
+bool Mesh::reorderPrimitives(const std::vector<uint32_t> &order) {
+    uint32_t nF = getPrimitiveCount(), nV = getVertexCount();
+    /* Mapped files are left alone, and so is data shared with other meshes */
+    if (!m_meshData || m_storage.use_count() != 1 || order.size() != nF)
+        return false;
+
+    /* Renumber the vertices by their first use; unused ones go last */
+    const uint32_t invalid = (uint32_t) -1;
+    std::vector<uint32_t> remap(nV, invalid), vertexOrder;
+    vertexOrder.reserve(nV);
+    MatrixXu F(3, nF);
+    for (uint32_t i = 0; i < nF; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            uint32_t v = getVertexIndex(order[i], k);
+            if (remap[v] == invalid) {
+                remap[v] = (uint32_t) vertexOrder.size();
+                vertexOrder.push_back(v);
+            }
+            F(k, i) = remap[v];
+        }
+    }
+    for (uint32_t v = 0; v < nV; ++v)
+        if (remap[v] == invalid)
+            vertexOrder.push_back(v);
+
+    /* Compact attributes are permuted as they are */
+    const MeshData &old = *m_meshData;
+    auto data = std::make_shared<MeshData>();
+    data->V.resize(3, nV);
+    data->N.resize(old.N.rows(), old.N.size() > 0 ? nV : 0);
+    data->UV.resize(old.UV.rows(), old.UV.size() > 0 ? nV : 0);
+    data->Noct.resize(old.Noct.size());
+    data->UVq.resize(old.UVq.size());
+    data->uvOffset = old.uvOffset;
+    data->uvScale = old.uvScale;
+    data->bbox = old.bbox;
+    tbb::parallel_for(tbb::blocked_range<uint32_t>(0u, nV),
+        [&](const tbb::blocked_range<uint32_t> &range) {
+            for (uint32_t i = range.begin(); i != range.end(); ++i) {
+                uint32_t v = vertexOrder[i];
+                data->V.col(i) = old.V.col(v);
+                if (data->N.size() > 0)
+                    data->N.col(i) = old.N.col(v);
+                if (data->UV.size() > 0)
+                    data->UV.col(i) = old.UV.col(v);
+                if (!data->Noct.empty())
+                    data->Noct[i] = old.Noct[v];
+                if (!data->UVq.empty()) {
+                    data->UVq[2 * i] = old.UVq[2 * v];
+                    data->UVq[2 * i + 1] = old.UVq[2 * v + 1];
+                }
+            }
+        }
+    );
+
+    if (old.F16.empty()) {
+        data->F = std::move(F);
+    } else {
+        data->F16.resize(3 * (size_t) nF);
+        for (uint32_t i = 0; i < nF; ++i)
+            for (int k = 0; k < 3; ++k)
+                data->F16[3 * i + k] = (uint16_t) F(k, i);
+    }
+    setMeshData(data);
+
+    /* The area distribution and inside/outside grid refer to triangle indices */
+    m_pdf.clear();
+    m_pdf.reserve(nF);
+    for (uint32_t i = 0; i < nF; ++i)
+        m_pdf.append(surfaceArea(i));
+    m_pdf.normalize();
+
+    if (!m_insideCells.empty())
+        buildInsideGrid();
+
+    return true;
 }
 
 BoundingBox3f Mesh::getBoundingBox(uint32_t index) const {
-    BoundingBox3f result(m_V.col(m_F(0, index)));
-    result.expandBy(m_V.col(m_F(1, index)));
-    result.expandBy(m_V.col(m_F(2, index)));
+    BoundingBox3f result(m_V.col(getVertexIndex(index, 0)));
+    result.expandBy(m_V.col(getVertexIndex(index, 1)));
+    result.expandBy(m_V.col(getVertexIndex(index, 2)));
     return result;
 }
 
 Point3f Mesh::getCentroid(uint32_t index) const {
     return (1.0f / 3.0f) *
-        (m_V.col(m_F(0, index)) +
-         m_V.col(m_F(1, index)) +
-         m_V.col(m_F(2, index)));
+        (m_V.col(getVertexIndex(index, 0)) +
+         m_V.col(getVertexIndex(index, 1)) +
+         m_V.col(getVertexIndex(index, 2)));
 }
 
 
@@ -184,7 +606,7 @@ std::string Mesh::toString() const {
         "]",
         m_name,
         m_V.cols(),
-        m_F.cols(),
+        getPrimitiveCount(),
         m_bsdf ? indent(m_bsdf->toString()) : std::string("null"),
         m_emitter ? indent(m_emitter->toString()) : std::string("null")
     );
@@ -0,0 +1,107 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/mmap.h>
+
+#if defined(PLATFORM_WINDOWS)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+NORI_NAMESPACE_BEGIN
+
+#if defined(PLATFORM_WINDOWS)
+
+MemoryMappedFile::MemoryMappedFile(const std::string &filename)
+    : m_filename(filename) {
+    m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (m_file == INVALID_HANDLE_VALUE) {
+        m_file = nullptr;
+        throw NoriException("Unable to open file \"%s\"!", filename);
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_file, &size)) {
+        CloseHandle(m_file);
+        throw NoriException("Unable to query the size of \"%s\"!", filename);
+    }
+    m_size = (size_t) size.QuadPart;
+    if (m_size == 0)
+        return;
+
+    m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mapping)
+        m_data = (const char *) MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!m_data) {
+        if (m_mapping)
+            CloseHandle(m_mapping);
+        CloseHandle(m_file);
+        throw NoriException("Unable to map \"%s\" into memory!", filename);
+    }
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+    if (m_data)
+        UnmapViewOfFile(m_data);
+    if (m_mapping)
+        CloseHandle(m_mapping);
+    if (m_file)
+        CloseHandle(m_file);
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const std::string &filename)
+    : m_filename(filename) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1)
+        throw NoriException("Unable to open file \"%s\"!", filename);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw NoriException("Unable to query the size of \"%s\"!", filename);
+    }
+    m_size = (size_t) st.st_size;
+
+    if (m_size > 0) {
+        void *ptr = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (ptr == MAP_FAILED) {
+            close(fd);
+            throw NoriException("Unable to map \"%s\" into memory!", filename);
+        }
+        m_data = (const char *) ptr;
+    }
+
+    /* The mapping stays valid after the descriptor is closed */
+    close(fd);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+    if (m_data)
+        munmap((void *) m_data, m_size);
+}
+
+#endif
+
+NORI_NAMESPACE_END
@@ -0,0 +1,228 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/nmesh.h>
+#include <nori/mmap.h>
+#include <nori/assetcache.h>
+#include <nori/timer.h>
+#include <filesystem/resolver.h>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <atomic>
+#include <fstream>
+#include <cstring>
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * \brief Loader for meshes in the native binary format (see \ref NMeshHeader)
+ *
+ * The file is memory mapped and the mesh references the mapped arrays
+ * directly, so loading costs little more than the page faults caused
+ * by the first accesses, and processes rendering the same asset share
+ * the page cache. A non-identity \c toWorld transformation requires a
+ * transformed copy of the vertex data.
+ */
+class NMesh : public Mesh {
+public:
+    NMesh(const PropertyList &propList) {
+        filesystem::path filename =
+            getFileResolver()->resolve(propList.getString("filename"));
+        Transform trafo = propList.getTransform("toWorld", Transform());
+        bool compact = propList.getBoolean("compact", false);
+
+        Timer timer;
+
+        uint16_t probe = 1;
+        if (*((uint8_t *) &probe) != 1)
+            throw NoriException("nmesh files can only be loaded on little endian machines!");
+
+        /* Meshes referencing the same file share one mapping */
+        static AssetCache<MemoryMappedFile> cache;
+        std::shared_ptr<const MemoryMappedFile> file = cache.get(makeAssetKey("nmesh", filename.str()),
+            [&] { return std::make_shared<MemoryMappedFile>(filename.str()); });
+        const char *data = file->getData();
+        size_t size = file->getSize();
+
+        NMeshHeader header;
+        if (size < sizeof(NMeshHeader))
+            throw NoriException("\"%s\" is not an nmesh file!", filename);
+        memcpy(&header, data, sizeof(NMeshHeader));
+        if (memcmp(header.magic, "NMSH", 4) != 0)
+            throw NoriException("\"%s\" is not an nmesh file!", filename);
+        if (header.version != 1)
+            throw NoriException("nmesh file \"%s\": unsupported version %i!", filename, header.version);
+        if (header.vertexCount == 0 || header.faceCount == 0 ||
+            header.offsetV == 0 || header.offsetF == 0)
+            throw NoriException("nmesh file \"%s\" contains no data!", filename);
+
+        uint64_t nV = header.vertexCount, nF = header.faceCount;
+        const float *V = getArray<float>(file.get(), header.offsetV, 3 * nV);
+        const float *N = getArray<float>(file.get(), header.offsetN, 3 * nV);
+        const float *UV = getArray<float>(file.get(), header.offsetUV, 2 * nV);
+        const uint32_t *F = getArray<uint32_t>(file.get(), header.offsetF, 3 * nF);
+        const float *areas = getArray<float>(file.get(), header.offsetArea, nF);
+
+        /* Reject out-of-range indices up front rather than crashing later */
+        std::atomic<bool> valid(true);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, 3 * nF),
+            [&](const tbb::blocked_range<uint64_t> &range) {
+                for (uint64_t i = range.begin(); i != range.end(); ++i) {
+                    if (F[i] >= nV) {
+                        valid = false;
+                        break;
+                    }
+                }
+            }
+        );
+        if (!valid)
+            throw NoriException("nmesh file \"%s\" contains out-of-range vertex indices!", filename);
+
+        if (trafo.getMatrix().isIdentity()) {
+            m_bbox = BoundingBox3f(
+                Point3f(header.bboxMin[0], header.bboxMin[1], header.bboxMin[2]),
+                Point3f(header.bboxMax[0], header.bboxMax[1], header.bboxMax[2]));
+            setMeshData(file, header.vertexCount, header.faceCount, V, N, UV, F, areas);
+        } else {
+            MatrixXf tV(3, nV), tN, tUV;
+            if (N)
+                tN.resize(3, nV);
+            if (UV)
+                tUV = MatrixXfMap(UV, 2, nV);
+
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, nV),
+                [&](const tbb::blocked_range<uint64_t> &range) {
+                    for (uint64_t i = range.begin(); i != range.end(); ++i) {
+                        tV.col(i) = trafo * Point3f(V[3 * i], V[3 * i + 1], V[3 * i + 2]);
+                        if (N)
+                            tN.col(i) = (trafo * Normal3f(N[3 * i], N[3 * i + 1], N[3 * i + 2])).normalized();
+                    }
+                }
+            );
+            for (uint64_t i = 0; i < nV; ++i)
+                m_bbox.expandBy(Point3f(tV.col(i)));
+
+            auto data = std::make_shared<MeshData>();
+            data->V = std::move(tV);
+            data->N = std::move(tN);
+            data->UV = std::move(tUV);
+            data->F = MatrixXuMap(F, 3, nF);
+            data->bbox = m_bbox;
+            if (compact)
+                data->compact();
+            setMeshData(data);
+        }
+
+        m_name = filename.str();
+
+        /* Print in one go, since several objects may be loading in parallel */
+        std::string mem;
+        if (m_meshData) {
+            mem = memString(m_meshData->getFullSize());
+            if (compact)
+                mem += ", compacted to " + memString(m_meshData->getSize());
+        } else {
+            mem = memString(m_F.size() * sizeof(uint32_t) +
+                sizeof(float) * (m_V.size() + m_N.size() + m_UV.size())) + " mapped";
+            if (compact)
+                mem += ", not compacted";
+        }
+        cout << tfm::format("Loading \"%s\" .. done. (V=%i, F=%i, took %s and %s)\n",
+            filename, m_V.cols(), getPrimitiveCount(), timer.elapsedString(), mem);
+    }
+
+protected:
+    /// Return a pointer to an optional array after checking its bounds
+    template <typename T> static const T *getArray(const MemoryMappedFile *file,
+            uint64_t offset, uint64_t count) {
+        if (offset == 0)
+            return nullptr;
+        // compared without forming offset + count * sizeof(T), which may wrap around
+        uint64_t size = file->getSize();
+        if (offset % sizeof(T) != 0 || offset > size || count > (size - offset) / sizeof(T))
+            throw NoriException("nmesh file \"%s\" is truncated or corrupt!", file->getFilename());
+        return (const T *) (file->getData() + offset);
+    }
+};
+
+void writeNMesh(const std::string &filename, const Mesh *mesh, bool storeAreas) {
+    const MatrixXfMap &V = mesh->getVertexPositions(), &N = mesh->getVertexNormals(),
+                      &UV = mesh->getVertexTexCoords();
+    const MatrixXuMap &F = mesh->getIndices();
+
+    std::vector<float> areas;
+    if (storeAreas) {
+        areas.resize(F.cols());
+        for (uint32_t i = 0; i < (uint32_t) F.cols(); ++i)
+            areas[i] = mesh->surfaceArea(i);
+    }
+
+    NMeshHeader header;
+    memset(&header, 0, sizeof(NMeshHeader));
+    memcpy(header.magic, "NMSH", 4);
+    header.version = 1;
+    header.vertexCount = (uint32_t) V.cols();
+    header.faceCount = (uint32_t) F.cols();
+    const BoundingBox3f &bbox = mesh->Shape::getBoundingBox();
+    for (int i = 0; i < 3; ++i) {
+        header.bboxMin[i] = bbox.min[i];
+        header.bboxMax[i] = bbox.max[i];
+    }
+
+    struct Array {
+        const void *data;
+        uint64_t size;
+        uint64_t *offset;
+    } arrays[] = {
+        { V.data(),     sizeof(float) * (uint64_t) V.size(),    &header.offsetV },
+        { N.data(),     sizeof(float) * (uint64_t) N.size(),    &header.offsetN },
+        { UV.data(),    sizeof(float) * (uint64_t) UV.size(),   &header.offsetUV },
+        { F.data(),     sizeof(uint32_t) * (uint64_t) F.size(), &header.offsetF },
+        { areas.data(), sizeof(float) * (uint64_t) areas.size(), &header.offsetArea }
+    };
+
+    uint64_t offset = sizeof(NMeshHeader);
+    for (Array &array : arrays) {
+        if (array.size == 0)
+            continue;
+        offset = (offset + NMESH_ALIGNMENT - 1) / NMESH_ALIGNMENT * NMESH_ALIGNMENT;
+        *array.offset = offset;
+        offset += array.size;
+    }
+
+    std::ofstream os(filename, std::ios::binary);
+    if (os.fail())
+        throw NoriException("Unable to open \"%s\" for writing!", filename);
+
+    os.write((const char *) &header, sizeof(NMeshHeader));
+    uint64_t position = sizeof(NMeshHeader);
+    const char padding[NMESH_ALIGNMENT] = { 0 };
+    for (const Array &array : arrays) {
+        if (array.size == 0)
+            continue;
+        os.write(padding, (std::streamsize) (*array.offset - position));
+        os.write((const char *) array.data, (std::streamsize) array.size);
+        position = *array.offset + array.size;
+    }
+
+    if (os.fail())
+        throw NoriException("Error while writing \"%s\"!", filename);
+}
+
+NORI_REGISTER_CLASS(NMesh, "nmesh");
+NORI_NAMESPACE_END
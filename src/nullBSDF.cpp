@@ -30,6 +30,8 @@ public:
         return Color3f(1.0f);
     }
 
+    virtual bool isNull() const override { return true; }
+
     virtual std::string toString() const override {
         return "NULLBSDF[]";
     }
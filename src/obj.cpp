@@ -18,164 +18,417 @@
 
 #include <nori/mesh.h>
 #include <nori/timer.h>
+#include <nori/mmap.h>
+#include <nori/assetcache.h>
 #include <filesystem/resolver.h>
-#include <unordered_map>
-#include <fstream>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/concurrent_hash_map.h>
+#include <cstring>
 
 NORI_NAMESPACE_BEGIN
 
 /**
  * \brief Loader for Wavefront OBJ triangle meshes
+ *
+ * The file is memory mapped and split into newline-aligned chunks that
+ * are parsed in parallel. Vertices are then deduplicated through a
+ * concurrent hash map and numbered in order of first appearance, so the
+ * result is identical to a sequential parse.
  */
 class WavefrontOBJ : public Mesh {
 public:
     WavefrontOBJ(const PropertyList &propList) {
-        typedef std::unordered_map<OBJVertex, uint32_t, OBJVertexHash> VertexMap;
-
         filesystem::path filename =
             getFileResolver()->resolve(propList.getString("filename"));
 
-        std::ifstream is(filename.str());
-        if (is.fail())
-            throw NoriException("Unable to open OBJ file \"%s\"!", filename);
         Transform trafo = propList.getTransform("toWorld", Transform());
 
-        cout << "Loading \"" << filename << "\" .. ";
-        cout.flush();
         Timer timer;
 
-        std::vector<Vector3f>   positions;
-        std::vector<Vector2f>   texcoords;
-        std::vector<Vector3f>   normals;
-        std::vector<uint32_t>   indices;
-        std::vector<OBJVertex>  vertices;
-        VertexMap vertexMap;
-
-        std::string line_str;
-        while (std::getline(is, line_str)) {
-            std::istringstream line(line_str);
-
-            std::string prefix;
-            line >> prefix;
-
-            if (prefix == "v") {
-                Point3f p;
-                line >> p.x() >> p.y() >> p.z();
-                p = trafo * p;
-                m_bbox.expandBy(p);
-                positions.push_back(p);
-            } else if (prefix == "vt") {
-                Point2f tc;
-                line >> tc.x() >> tc.y();
-                texcoords.push_back(tc);
-            } else if (prefix == "vn") {
-                Normal3f n;
-                line >> n.x() >> n.y() >> n.z();
-                normals.push_back((trafo * n).normalized());
-            } else if (prefix == "f") {
-                std::string v1, v2, v3, v4;
-                line >> v1 >> v2 >> v3 >> v4;
-                OBJVertex verts[6];
-                int nVertices = 3;
-
-                verts[0] = OBJVertex(v1);
-                verts[1] = OBJVertex(v2);
-                verts[2] = OBJVertex(v3);
-
-                if (!v4.empty()) {
-                    /* This is a quad, split into two triangles */
-                    verts[3] = OBJVertex(v4);
-                    verts[4] = verts[0];
-                    verts[5] = verts[2];
-                    nVertices = 6;
-                }
-                /* Convert to an indexed vertex list */
-                for (int i=0; i<nVertices; ++i) {
-                    const OBJVertex &v = verts[i];
-                    VertexMap::const_iterator it = vertexMap.find(v);
-                    if (it == vertexMap.end()) {
-                        vertexMap[v] = (uint32_t) vertices.size();
-                        indices.push_back((uint32_t) vertices.size());
-                        vertices.push_back(v);
-                    } else {
-                        indices.push_back(it->second);
-                    }
-                }
+        bool compact = propList.getBoolean("compact", false);
+
+        /* The compact representation is part of the shared data, so it is part of the key */
+        bool loaded = false;
+        std::shared_ptr<const MeshData> data = getCache().get(
+            makeAssetKey("obj", filename.str(), trafo.getMatrix().data(), sizeof(Eigen::Matrix4f)) +
+                (compact ? "|compact" : ""),
+            [&] { return load(filename, trafo, compact); }, &loaded);
+        setMeshData(data);
+        m_bbox = data->bbox;
+        m_name = filename.str();
+
+        /* Print in one go, since several objects may be loading in parallel */
+        std::string mem = memString(data->getFullSize()) + (loaded ? "" : " shared");
+        if (compact)
+            mem += ", compacted to " + memString(data->getSize());
+        cout << tfm::format("Loading \"%s\" .. done. (V=%i, F=%i, took %s and %s)\n",
+            filename, m_V.cols(), getPrimitiveCount(), timer.elapsedString(), mem);
+    }
+
+protected:
+    /// Parse an OBJ file; shared by all meshes with the same transformation and \c compact flag
+    static std::shared_ptr<MeshData> load(const filesystem::path &filename, const Transform &trafo, bool compact) {
+        std::unique_ptr<MemoryMappedFile> file;
+        try {
+            file.reset(new MemoryMappedFile(filename.str()));
+        } catch (const NoriException &) {
+            throw NoriException("Unable to open OBJ file \"%s\"!", filename);
+        }
+        const char *data = file->getData();
+        size_t size = file->getSize();
+
+        /* Split the file into chunks that end on a line boundary */
+        std::vector<size_t> bounds(1, 0);
+        while (bounds.back() < size) {
+            size_t next = bounds.back() + OBJ_CHUNK_SIZE;
+            if (next >= size) {
+                next = size;
+            } else {
+                const char *nl = (const char *) memchr(data + next, '\n', size - next);
+                next = nl ? (size_t) (nl - data) + 1 : size;
             }
+            bounds.push_back(next);
         }
 
-        m_F.resize(3, indices.size()/3);
-        memcpy(m_F.data(), indices.data(), sizeof(uint32_t)*indices.size());
-
-        m_V.resize(3, vertices.size());
-        for (uint32_t i=0; i<vertices.size(); ++i)
-            m_V.col(i) = positions.at(vertices[i].p-1);
+        size_t nChunks = bounds.size() - 1;
+        std::vector<OBJChunk> chunks(nChunks);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, nChunks, 1),
+            [&](const tbb::blocked_range<size_t> &range) {
+                for (size_t i = range.begin(); i != range.end(); ++i)
+                    parseChunk(data + bounds[i], data + bounds[i + 1], trafo, chunks[i]);
+            }
+        );
+
+        /* Concatenate the per-chunk results in file order */
+        BoundingBox3f bbox;
+        std::vector<size_t> posOffset(nChunks + 1, 0), tcOffset(nChunks + 1, 0),
+                            nOffset(nChunks + 1, 0), cornerOffset(nChunks + 1, 0);
+        for (size_t i = 0; i < nChunks; ++i) {
+            posOffset[i + 1] = posOffset[i] + chunks[i].positions.size();
+            tcOffset[i + 1] = tcOffset[i] + chunks[i].texcoords.size();
+            nOffset[i + 1] = nOffset[i] + chunks[i].normals.size();
+            cornerOffset[i + 1] = cornerOffset[i] + chunks[i].corners.size();
+            bbox.expandBy(chunks[i].bbox);
+        }
 
-        if (!normals.empty()) {
-            m_N.resize(3, vertices.size());
-            for (uint32_t i=0; i<vertices.size(); ++i)
-                m_N.col(i) = normals.at(vertices[i].n-1);
+        std::vector<Vector3f>   positions(posOffset[nChunks]);
+        std::vector<Vector2f>   texcoords(tcOffset[nChunks]);
+        std::vector<Vector3f>   normals(nOffset[nChunks]);
+        std::vector<OBJVertex>  corners(cornerOffset[nChunks]);
+
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, nChunks, 1),
+            [&](const tbb::blocked_range<size_t> &range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    OBJChunk &chunk = chunks[i];
+                    std::copy(chunk.positions.begin(), chunk.positions.end(), positions.begin() + posOffset[i]);
+                    std::copy(chunk.texcoords.begin(), chunk.texcoords.end(), texcoords.begin() + tcOffset[i]);
+                    std::copy(chunk.normals.begin(), chunk.normals.end(), normals.begin() + nOffset[i]);
+                    std::copy(chunk.corners.begin(), chunk.corners.end(), corners.begin() + cornerOffset[i]);
+                    chunk = OBJChunk();
+                }
+            }
+        );
+        chunks.clear();
+
+        /* Find the first occurrence of every distinct face vertex */
+        size_t nCorners = corners.size();
+        std::vector<uint32_t> first(nCorners);
+        {
+            VertexMap vertexMap;
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, nCorners),
+                [&](const tbb::blocked_range<size_t> &range) {
+                    for (size_t i = range.begin(); i != range.end(); ++i) {
+                        VertexMap::accessor acc;
+                        if (vertexMap.insert(acc, corners[i]))
+                            acc->second = (uint32_t) i;
+                        else
+                            acc->second = std::min(acc->second, (uint32_t) i);
+                    }
+                }
+            );
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, nCorners),
+                [&](const tbb::blocked_range<size_t> &range) {
+                    for (size_t i = range.begin(); i != range.end(); ++i) {
+                        VertexMap::const_accessor acc;
+                        vertexMap.find(acc, corners[i]);
+                        first[i] = acc->second;
+                    }
+                }
+            );
         }
 
-        if (!texcoords.empty()) {
-            m_UV.resize(2, vertices.size());
-            for (uint32_t i=0; i<vertices.size(); ++i)
-                m_UV.col(i) = texcoords.at(vertices[i].uv-1);
+        /* Number the distinct vertices in order of first appearance */
+        std::vector<uint32_t> indices(nCorners);
+        std::vector<OBJVertex> vertices;
+        for (size_t i = 0; i < nCorners; ++i) {
+            if (first[i] == i) {
+                indices[i] = (uint32_t) vertices.size();
+                vertices.push_back(corners[i]);
+            } else {
+                indices[i] = indices[first[i]];
+            }
         }
 
-        size_t meshSize = m_F.size() * sizeof(uint32_t) +
-            sizeof(float) * (m_V.size() + m_N.size() + m_UV.size());
+        MatrixXu F(3, indices.size()/3);
+        memcpy(F.data(), indices.data(), sizeof(uint32_t)*indices.size());
+
+        uint32_t nVertices = (uint32_t) vertices.size();
+        MatrixXf V(3, nVertices), N, UV;
+        if (!normals.empty())
+            N.resize(3, nVertices);
+        if (!texcoords.empty())
+            UV.resize(2, nVertices);
+
+        tbb::parallel_for(tbb::blocked_range<uint32_t>(0u, nVertices),
+            [&](const tbb::blocked_range<uint32_t> &range) {
+                for (uint32_t i = range.begin(); i != range.end(); ++i) {
+                    const OBJVertex &v = vertices[i];
+                    V.col(i) = lookup(positions, v.p, filename);
+                    if (!normals.empty())
+                        N.col(i) = lookup(normals, v.n, filename);
+                    if (!texcoords.empty())
+                        UV.col(i) = lookup(texcoords, v.uv, filename);
+                }
+            }
+        );
+
+        size_t meshSize = F.size() * sizeof(uint32_t) +
+            sizeof(float) * (V.size() + N.size() + UV.size());
 
         if (meshSize == 0) {
-            cout << endl;
             throw NoriException("OBJ file \"%s\" contains no data! Make sure you have Git LFS installed", filename);
         }
 
-        m_name = filename.str();
-        cout << "done. (V=" << m_V.cols() << ", F=" << m_F.cols() << ", took "
-            << timer.elapsedString() << " and "
-            << memString(meshSize)
-            << ")" << endl;
+        auto mesh = std::make_shared<MeshData>();
+        mesh->V = std::move(V);
+        mesh->N = std::move(N);
+        mesh->UV = std::move(UV);
+        mesh->F = std::move(F);
+        mesh->bbox = bbox;
+        if (compact)
+            mesh->compact();
+        return mesh;
     }
 
-protected:
+    /// Meshes loaded by this plugin, keyed by file name and transformation
+    static AssetCache<MeshData> &getCache() {
+        static AssetCache<MeshData> cache;
+        return cache;
+    }
+
+    /// Approximate number of bytes parsed by one task
+    static const size_t OBJ_CHUNK_SIZE = 1 << 20;
+
     /// Vertex indices used by the OBJ format
     struct OBJVertex {
         uint32_t p = (uint32_t) -1;
         uint32_t n = (uint32_t) -1;
         uint32_t uv = (uint32_t) -1;
 
-        inline OBJVertex() { }
-
-        inline OBJVertex(const std::string &string) {
-            std::vector<std::string> tokens = tokenize(string, "/", true);
-
-            if (tokens.size() < 1 || tokens.size() > 3)
-                throw NoriException("Invalid vertex data: \"%s\"", string);
-
-            p = toUInt(tokens[0]);
-
-            if (tokens.size() >= 2 && !tokens[1].empty())
-                uv = toUInt(tokens[1]);
-
-            if (tokens.size() >= 3 && !tokens[2].empty())
-                n = toUInt(tokens[2]);
-        }
-
         inline bool operator==(const OBJVertex &v) const {
             return v.p == p && v.n == n && v.uv == uv;
         }
     };
 
-    /// Hash function for OBJVertex
-    struct OBJVertexHash {
-        std::size_t operator()(const OBJVertex& v) const {
+    /// Hash and comparison functions for OBJVertex
+    struct OBJVertexHashCompare {
+        static size_t hash(const OBJVertex &v) {
             size_t hash = std::hash<uint32_t>()(v.p);
             hash = hash * 37 + std::hash<uint32_t>()(v.uv);
             hash = hash * 37 + std::hash<uint32_t>()(v.n);
             return hash;
         }
+
+        static bool equal(const OBJVertex &a, const OBJVertex &b) {
+            return a == b;
+        }
+    };
+
+    typedef tbb::concurrent_hash_map<OBJVertex, uint32_t, OBJVertexHashCompare> VertexMap;
+
+    /// Data parsed from one chunk of the file
+    struct OBJChunk {
+        std::vector<Vector3f>   positions;
+        std::vector<Vector2f>   texcoords;
+        std::vector<Vector3f>   normals;
+        std::vector<OBJVertex>  corners;
+        BoundingBox3f           bbox;
     };
+
+    /// Look up a 1-based OBJ index
+    template <typename T> static const T &lookup(const std::vector<T> &values,
+            uint32_t index, const filesystem::path &filename) {
+        if (index == 0 || index > values.size())
+            throw NoriException("OBJ file \"%s\" references a nonexistent vertex attribute (index %i)!",
+                filename, index == (uint32_t) -1 ? -1 : (int) index);
+        return values[index - 1];
+    }
+
+    static inline bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    /// Return the next whitespace-delimited token of a line
+    static inline bool nextToken(const char *&ptr, const char *end,
+            const char *&tokenBegin, const char *&tokenEnd) {
+        while (ptr < end && isSpace(*ptr))
+            ++ptr;
+        tokenBegin = ptr;
+        while (ptr < end && !isSpace(*ptr))
+            ++ptr;
+        tokenEnd = ptr;
+        return tokenBegin != tokenEnd;
+    }
+
+    /**
+     * \brief Parse a floating point token
+     *
+     * Decimal numbers whose significand fits into 24 bits and whose
+     * exponent lies within [-10, 10] are converted exactly by a single
+     * rounded multiplication or division, which yields the same value
+     * as \c strtof(). Everything else falls back to \c strtof().
+     */
+    static float parseFloat(const char *begin, const char *end) {
+        static const float powersOf10[] = {
+            1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+        };
+
+        const char *ptr = begin;
+        bool negative = false;
+        if (ptr < end && (*ptr == '+' || *ptr == '-'))
+            negative = *ptr++ == '-';
+
+        uint64_t mantissa = 0;
+        int digits = 0, exponent = 0;
+        bool anyDigits = false;
+        for (; ptr < end && *ptr >= '0' && *ptr <= '9'; ++ptr) {
+            mantissa = mantissa * 10 + (uint64_t) (*ptr - '0');
+            digits += mantissa != 0;
+            anyDigits = true;
+        }
+        if (ptr < end && *ptr == '.') {
+            for (++ptr; ptr < end && *ptr >= '0' && *ptr <= '9'; ++ptr) {
+                mantissa = mantissa * 10 + (uint64_t) (*ptr - '0');
+                digits += mantissa != 0;
+                exponent--;
+                anyDigits = true;
+            }
+        }
+        if (anyDigits && ptr < end && (*ptr == 'e' || *ptr == 'E')) {
+            const char *expPtr = ptr + 1;
+            bool expNegative = false;
+            if (expPtr < end && (*expPtr == '+' || *expPtr == '-'))
+                expNegative = *expPtr++ == '-';
+            int value = 0;
+            bool expDigits = false;
+            for (; expPtr < end && *expPtr >= '0' && *expPtr <= '9'; ++expPtr) {
+                value = std::min(value * 10 + (*expPtr - '0'), 1000);
+                expDigits = true;
+            }
+            if (expDigits) {
+                exponent += expNegative ? -value : value;
+                ptr = expPtr;
+            }
+        }
+
+        if (anyDigits && ptr == end && digits <= 18 &&
+            mantissa <= (1u << 24) && exponent >= -10 && exponent <= 10) {
+            float value = (float) mantissa;
+            if (exponent < 0)
+                value /= powersOf10[-exponent];
+            else
+                value *= powersOf10[exponent];
+            return negative ? -value : value;
+        }
+
+        std::string token(begin, end);
+        return strtof(token.c_str(), nullptr);
+    }
+
+    /// Parse the next float of a line (missing values are zero)
+    static inline float nextFloat(const char *&ptr, const char *end) {
+        const char *tokenBegin, *tokenEnd;
+        if (!nextToken(ptr, end, tokenBegin, tokenEnd))
+            return 0.f;
+        return parseFloat(tokenBegin, tokenEnd);
+    }
+
+    /// Parse a face vertex of the form p, p/uv, p//n or p/uv/n
+    static OBJVertex parseVertex(const char *begin, const char *end) {
+        OBJVertex v;
+        uint32_t *fields[3] = { &v.p, &v.uv, &v.n };
+        const char *ptr = begin;
+        for (int field = 0; field < 3; ++field) {
+            const char *start = ptr;
+            uint32_t value = 0;
+            for (; ptr < end && *ptr >= '0' && *ptr <= '9'; ++ptr)
+                value = value * 10 + (uint32_t) (*ptr - '0');
+            if (ptr != start)
+                *fields[field] = value;
+            else if (field == 0)
+                break;
+            if (ptr == end)
+                return v;
+            if (*ptr != '/')
+                break;
+            ++ptr;
+        }
+        throw NoriException("Invalid vertex data: \"%s\"", std::string(begin, end));
+    }
+
+    static void parseChunk(const char *ptr, const char *end,
+            const Transform &trafo, OBJChunk &chunk) {
+        while (ptr < end) {
+            const char *eol = (const char *) memchr(ptr, '\n', (size_t) (end - ptr));
+            if (!eol)
+                eol = end;
+
+            const char *prefix, *prefixEnd;
+            if (nextToken(ptr, eol, prefix, prefixEnd)) {
+                size_t len = (size_t) (prefixEnd - prefix);
+                if (len == 1 && prefix[0] == 'v') {
+                    Point3f p;
+                    p.x() = nextFloat(ptr, eol);
+                    p.y() = nextFloat(ptr, eol);
+                    p.z() = nextFloat(ptr, eol);
+                    p = trafo * p;
+                    chunk.bbox.expandBy(p);
+                    chunk.positions.push_back(p);
+                } else if (len == 2 && prefix[0] == 'v' && prefix[1] == 't') {
+                    Point2f tc;
+                    tc.x() = nextFloat(ptr, eol);
+                    tc.y() = nextFloat(ptr, eol);
+                    chunk.texcoords.push_back(tc);
+                } else if (len == 2 && prefix[0] == 'v' && prefix[1] == 'n') {
+                    Normal3f n;
+                    n.x() = nextFloat(ptr, eol);
+                    n.y() = nextFloat(ptr, eol);
+                    n.z() = nextFloat(ptr, eol);
+                    chunk.normals.push_back((trafo * n).normalized());
+                } else if (len == 1 && prefix[0] == 'f') {
+                    OBJVertex verts[4];
+                    int nVertices = 0;
+                    const char *tokenBegin, *tokenEnd;
+                    while (nVertices < 4 && nextToken(ptr, eol, tokenBegin, tokenEnd))
+                        verts[nVertices++] = parseVertex(tokenBegin, tokenEnd);
+                    if (nVertices < 3)
+                        throw NoriException("Invalid face: \"%s\"", std::string(prefix, eol));
+
+                    chunk.corners.push_back(verts[0]);
+                    chunk.corners.push_back(verts[1]);
+                    chunk.corners.push_back(verts[2]);
+                    if (nVertices == 4) {
+                        /* This is a quad, split into two triangles */
+                        chunk.corners.push_back(verts[3]);
+                        chunk.corners.push_back(verts[0]);
+                        chunk.corners.push_back(verts[2]);
+                    }
+                }
+            }
+            ptr = eol + 1;
+        }
+    }
 };
 
 NORI_REGISTER_CLASS(WavefrontOBJ, "obj");
@@ -0,0 +1,63 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/nmesh.h>
+#include <nori/proplist.h>
+#include <filesystem/path.h>
+#include <memory>
+
+using namespace nori;
+
+/* Converts Wavefront OBJ meshes into the native binary mesh format */
+int main(int argc, char **argv) {
+    std::vector<std::string> args;
+    bool storeAreas = true;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string token(argv[i]);
+        if (token == "--no-areas")
+            storeAreas = false;
+        else
+            args.push_back(token);
+    }
+
+    if (args.size() != 2) {
+        cerr << "Syntax: " << argv[0] << " [--no-areas] <input.obj> <output.nmesh>" << endl;
+        return -1;
+    }
+
+    try {
+        if (filesystem::path(args[0]).extension() != "obj")
+            throw NoriException("Expected an input file with the extension .obj!");
+
+        PropertyList propList;
+        propList.setString("filename", args[0]);
+        std::unique_ptr<Mesh> mesh(static_cast<Mesh *>(
+            NoriObjectFactory::createInstance("obj", propList)));
+
+        cout << "Writing \"" << args[1] << "\" .. ";
+        cout.flush();
+        writeNMesh(args[1], mesh.get(), storeAreas);
+        cout << "done." << endl;
+    } catch (const std::exception &e) {
+        cerr << "Error: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
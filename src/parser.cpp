@@ -18,8 +18,10 @@
 
 #include <nori/parser.h>
 #include <nori/proplist.h>
+#include <nori/timer.h>
 #include <Eigen/Geometry>
 #include <pugixml.hpp>
+#include <tbb/task_group.h>
 #include <fstream>
 #include <set>
 
@@ -131,11 +133,19 @@ NoriObject *loadFromXML(const std::string &filename) {
                                 filename, *attrs.begin(), node.name(), offset(node.offset_debug()));
     };
 
-    Eigen::Affine3f transform;
+    /* Helper function: does this node describe a Nori object (as opposed to a property)? */
+    auto isObject = [&](const pugi::xml_node &node) {
+        if (node.type() != pugi::node_element)
+            return false;
+        auto it = tags.find(node.name());
+        return it != tags.end() && (int) it->second < (int) NoriObject::EClassTypeCount;
+    };
 
-    /* Helper function to parse a Nori XML node (recursive) */
-    std::function<NoriObject *(pugi::xml_node &, PropertyList &, int)> parseTag = [&](
-        pugi::xml_node &node, PropertyList &list, int parentTag) -> NoriObject * {
+    /* Helper function to parse a Nori XML node (recursive). Transform
+       operations are accumulated into 'transform', which belongs to the
+       enclosing <transform> node. */
+    std::function<NoriObject *(pugi::xml_node &, PropertyList &, int, Eigen::Affine3f &)> parseTag = [&](
+        pugi::xml_node &node, PropertyList &list, int parentTag, Eigen::Affine3f &transform) -> NoriObject * {
         /* Skip over comments */
         if (node.type() == pugi::node_comment || node.type() == pugi::node_declaration)
             return nullptr;
@@ -174,13 +184,26 @@ NoriObject *loadFromXML(const std::string &filename) {
 
         if (tag == EScene)
             node.append_attribute("type") = "scene";
-        else if (tag == ETransform)
-            transform.setIdentity();
 
+        /* Properties (including transforms) are parsed in order, while
+           nested objects are independent of each other and of the
+           properties, so they are created and activated in parallel.
+           Their results are collected in document order. */
         PropertyList propList;
+        Eigen::Affine3f childTransform(Eigen::Affine3f::Identity());
+        std::vector<pugi::xml_node> childNodes(node.children().begin(), node.children().end());
+        std::vector<NoriObject *> slots(childNodes.size(), nullptr);
+        tbb::task_group group;
+        for (size_t i = 0; i < childNodes.size(); ++i) {
+            if (isObject(childNodes[i]))
+                group.run([&, i] { slots[i] = parseTag(childNodes[i], propList, tag, childTransform); });
+            else
+                slots[i] = parseTag(childNodes[i], propList, tag, childTransform);
+        }
+        group.wait();
+
         std::vector<NoriObject *> children;
-        for (pugi::xml_node &ch: node.children()) {
-            NoriObject *child = parseTag(ch, propList, tag);
+        for (NoriObject *child : slots) {
             if (child)
                 children.push_back(child);
         }
@@ -272,7 +295,7 @@ NoriObject *loadFromXML(const std::string &filename) {
                         break;
                     case ETransform: {
                             check_attributes(node, { "name" });
-                            list.setTransform(node.attribute("name").value(), transform.matrix());
+                            list.setTransform(node.attribute("name").value(), childTransform.matrix());
                         }
                         break;
                     case ETranslate: {
@@ -336,7 +359,11 @@ NoriObject *loadFromXML(const std::string &filename) {
     };
 
     PropertyList list;
-    return parseTag(*doc.begin(), list, EInvalid);
+    Eigen::Affine3f transform(Eigen::Affine3f::Identity());
+    Timer timer;
+    NoriObject *root = parseTag(*doc.begin(), list, EInvalid, transform);
+    cout << "Loaded \"" << filename << "\" in " << timer.elapsedString() << endl;
+    return root;
 }
 
 NORI_NAMESPACE_END
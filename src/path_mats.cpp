@@ -26,7 +26,7 @@ public:
 
             /* compute Le when intersection is an emitter */
             if (its.mesh->isEmitter()) {
-                EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n);
+                EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n, its.primIndex);
                 color += t * its.mesh->getEmitter()->eval(lRec);
             }
 
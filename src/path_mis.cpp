@@ -3,13 +3,15 @@
 #include <nori/scene.h>
 #include <nori/bsdf.h>
 #include <nori/warp.h>
+#include <nori/ris.h>
 
 NORI_NAMESPACE_BEGIN
 
 class PathMis : public Integrator {
 public:
     PathMis(const PropertyList &props) {
-
+        /* Candidate count for resampled emitter sampling (0: plain MIS) */
+        m_risCandidates = props.getInteger("risCandidates", 0);
     }
 
     Color3f Li(const Scene *scene, Sampler *sampler, const Ray3f &ray) const{
@@ -26,27 +28,36 @@ public:
 
             /* compute Le when intersection is an emitter */
             if (its.mesh->isEmitter()) {
-                EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n);
+                EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n, its.primIndex);
                 Color3f Li = its.mesh->getEmitter()->eval(lRec);
                 color += w_mat * t * its.mesh->getEmitter()->eval(lRec);
             }
 
-            /* sample emitter */
-            auto light = scene->getRandomEmitter(sampler->next1D());
-            int n_lights = scene->getLights().size();
-            EmitterQueryRecord lRec(its.p);
-            Color3f Li = light->sample(lRec, sampler->next2D());
-
-            /* compute w_em */
-            if (!scene->rayIntersect(lRec.shadowRay)) {  // if shadow ray is NOT occluded
-                float cosTheta = its.shFrame.n.dot(lRec.wi);
-                BSDFQueryRecord bRec(its.toLocal(-currRay.d), its.toLocal(lRec.wi), ESolidAngle);
-                bRec.uv = its.uv;
-                float pdf_em = light->pdf(lRec);
-                float pdf_mat = its.mesh->getBSDF()->pdf(bRec);
-                if (pdf_em + pdf_mat > 1e-8) {
-                    float w_em = pdf_em / (pdf_mat + pdf_em);
-                    color += w_em * t * its.mesh->getBSDF()->eval(bRec) * Li * cosTheta * n_lights;
+            if (m_risCandidates > 0) {
+                /* resampled emitter sample, counted in full (no MIS) */
+                EmitterQueryRecord lRec(its.p);
+                Color3f Lr = sampleDirectRIS(scene, sampler, its, -currRay.d, m_risCandidates, lRec);
+                if (Lr.maxCoeff() > 0.f && !scene->rayIntersect(lRec.shadowRay))
+                    color += t * Lr;
+            } else {
+                /* sample emitter */
+                float lightPdf;
+                EmitterQueryRecord lRec(its.p);
+                auto light = scene->getRandomEmitter(its.p, its.shFrame.n, sampler->next1D(), lightPdf, lRec);
+                Point2f lightSample = sampler->next2D();
+                Color3f Li = light ? light->sample(lRec, lightSample) : Color3f(0.f);
+
+                /* compute w_em */
+                if (light && !scene->rayIntersect(lRec.shadowRay)) {  // if shadow ray is NOT occluded
+                    float cosTheta = its.shFrame.n.dot(lRec.wi);
+                    BSDFQueryRecord bRec(its.toLocal(-currRay.d), its.toLocal(lRec.wi), ESolidAngle);
+                    bRec.uv = its.uv;
+                    float pdf_em = light->pdf(lRec) * lightPdf;
+                    float pdf_mat = its.mesh->getBSDF()->pdf(bRec);
+                    if (pdf_em + pdf_mat > 1e-8) {
+                        float w_em = pdf_em / (pdf_mat + pdf_em);
+                        color += w_em * t * its.mesh->getBSDF()->eval(bRec) * Li * cosTheta / lightPdf;
+                    }
                 }
             }
 
@@ -69,14 +80,17 @@ public:
 
             /* current pdf mat */
             float pdf_mat = its.mesh->getBSDF()->pdf(bRec);
+            Point3f prevP = its.p;
+            Normal3f prevN = its.shFrame.n;
 
             if (!scene->rayIntersect(currRay, its))
                 break;
 
             /* compute w_mat */
             if (its.mesh->isEmitter()) {
-                EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n);
-                float pdf_em = its.mesh->getEmitter()->pdf(lRec);
+                EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n, its.primIndex);
+                float lightPdf = scene->getEmitterPdf(prevP, prevN, its.mesh->getEmitter(), lRec);
+                float pdf_em = its.mesh->getEmitter()->pdf(lRec) * lightPdf;
                 if (pdf_em + pdf_mat > 1e-8) {
                     w_mat = pdf_mat / (pdf_mat + pdf_em);
                 } else {
@@ -84,6 +98,10 @@ public:
                 }
             }
 
+            /* with resampling, emitters are only reached through delta BSDFs */
+            if (m_risCandidates > 0)
+                w_mat = 0.f;
+
             if (bRec.measure == EDiscrete)
                 w_mat = 1.f;
         }
@@ -92,8 +110,11 @@ public:
     }
 
     std::string toString() const {
-        return "PathMis[]";
+        return tfm::format("PathMis[risCandidates = %i]", m_risCandidates);
     }
+
+private:
+    int m_risCandidates;
 };
 
 NORI_REGISTER_CLASS(PathMis, "path_mis")
@@ -1,90 +1,228 @@
 #include<nori/volume.h>
 #include <iostream>
-#include<cstdlib>
+#include <vector>
 #include <cmath>
 #include<nori/shape.h>
+#include <nori/brickgrid.h>
+#include <nori/trilinear.h>
+#include <nori/lowdiscrepancy.h>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#  include <emmintrin.h>
+#  define NORI_PERLIN_SSE 1
+#endif
+
 NORI_NAMESPACE_BEGIN
 using namespace std;
 
+/* Value noise on an integer lattice, blended with the quintic fade curve of Perlin.
+The lattice values are a hash of their index and a seed, so the noise is deterministic
+and every lattice point can be generated independently (and in parallel).
+Evaluation is non-virtual: the fade polynomials of the three axes are evaluated at once
+in Horner form and the blend reduces to a trilinear interpolation with faded weights */
 class PerlinNoise3D {
 public:
-    PerlinNoise3D(int row, int col, int height, float max) {
-        srand((unsigned)time(NULL));
+    PerlinNoise3D(int row, int col, int height, float max, uint32_t seed) {
         m_row = row;
         m_col = col;
         m_height = height;
-        m_grid = new float[row * col * height];
-        for (int k = 0; k < height; k++) {
-            for (int j = 0; j < col; j++) {
-                for (int i = 0; i < row; i++) {
-                    m_grid[i + j * row + k * col * row] = static_cast<float>(rand()) / RAND_MAX * max;
-                    //cout << m_grid[i + j * row + k * col * row] << endl;
+        m_grid.resize((size_t) row * col * height);
+        tbb::parallel_for(tbb::blocked_range<int>(0, height),
+            [&](const tbb::blocked_range<int>& range) {
+                for (int k = range.begin(); k != range.end(); k++) {
+                    for (int j = 0; j < col; j++) {
+                        for (int i = 0; i < row; i++) {
+                            size_t index = i + (size_t) j * row + (size_t) k * col * row;
+                            // top 24 bits of the hash, uniform on [0, 1)
+                            float u = (hashCombine(seed, index) >> 40) * (1.f / 16777216.f);
+                            m_grid[index] = u * max;
+                        }
+                    }
                 }
             }
-        }
+        );
     }
 
-    virtual float getP(float gridX, float gridY, float gridZ) {
+    /* the noise at a position in lattice coordinates, clamped to the lattice */
+    float getP(float gridX, float gridY, float gridZ) const {
+        gridX = clamp(gridX, 0.f, (float) (m_row - 1));
+        gridY = clamp(gridY, 0.f, (float) (m_col - 1));
+        gridZ = clamp(gridZ, 0.f, (float) (m_height - 1));
+        int beginX = std::min(int(gridX), m_row - 2);
+        int beginY = std::min(int(gridY), m_col - 2);
+        int beginZ = std::min(int(gridZ), m_height - 2);
 
-        int beginX = int(floor(gridX));
-        int beginY = int(floor(gridY));
-        int beginZ = int(floor(gridZ));
-        //if (beginX < 0 || beginY < 0 || beginZ < 0 || beginX >= m_row - 1 || beginY >= m_col - 1 || beginZ >= m_height - 1) {
-        //    std::cerr << "Invalid lookup position or channel" << std::endl;
-        //    return 0.0f; // Or any default value as needed
-        //}
-        float p1 = interpolate(getValue(beginX, beginY, beginZ), getValue(beginX + 1, beginY, beginZ), lerp(gridX - beginX));
-        float p2 = interpolate(getValue(beginX, beginY, beginZ + 1), getValue(beginX + 1, beginY, beginZ + 1), lerp(gridX - beginX));
-        float p3 = interpolate(getValue(beginX, beginY + 1, beginZ), getValue(beginX + 1, beginY + 1, beginZ), lerp(gridX - beginX));
-        float p4 = interpolate(getValue(beginX, beginY + 1, beginZ + 1), getValue(beginX + 1, beginY + 1, beginZ + 1), lerp(gridX - beginX));
-        float p5 = interpolate(p1, p2, lerp(gridZ - beginZ));
-        float p6 = interpolate(p3, p4, lerp(gridZ - beginZ));
-        return interpolate(p5, p6, lerp(gridY - beginY));
-    }
-    virtual float getValue(int intGridX, int intGridY, int intGridZ) {
-        return m_grid[intGridX + intGridY * m_row + intGridZ * m_row * m_col];
+        float weights[3];
+        fade(gridX - beginX, gridY - beginY, gridZ - beginZ, weights);
+
+        size_t dy = m_row, dz = (size_t) m_row * m_col;
+        const float* v = &m_grid[beginX + beginY * dy + beginZ * dz];
+        float c[8] = { v[0], v[1], v[dy], v[dy + 1], v[dz], v[dz + 1], v[dz + dy], v[dz + dy + 1] };
+        return trilinear(c, weights[0], weights[1], weights[2]);
     }
-    virtual float interpolate(float a, float b, float t) {
-        return t * a + (1 - t) * b;
+
+    float getValue(int intGridX, int intGridY, int intGridZ) const {
+        return m_grid[intGridX + (size_t) intGridY * m_row + (size_t) intGridZ * m_row * m_col];
     }
 
-    //perlin interpolation
-    virtual float lerp(float num)
-    {
-        return 6 * pow(num, 5) - 15 * pow(num, 4) + 10 * pow(num, 3);
+    /* The interpolation weights are convex, so the values between the
+       given grid points are bounded by the grid points themselves */
+    void getRange(const int lo[3], const int hi[3], float& minValue, float& maxValue) const {
+        int res[3] = { m_row, m_col, m_height };
+        int from[3], to[3];
+        for (int i = 0; i < 3; i++) {
+            from[i] = std::max(0, std::min(lo[i], res[i] - 1));
+            to[i] = std::max(0, std::min(hi[i], res[i] - 1));
+        }
+        minValue = std::numeric_limits<float>::infinity();
+        maxValue = -std::numeric_limits<float>::infinity();
+        for (int k = from[2]; k <= to[2]; k++) {
+            for (int j = from[1]; j <= to[1]; j++) {
+                for (int i = from[0]; i <= to[0]; i++) {
+                    minValue = std::min(minValue, getValue(i, j, k));
+                    maxValue = std::max(maxValue, getValue(i, j, k));
+                }
+            }
+        }
     }
 
-    virtual float* getgrid() {
-        return m_grid;
+private:
+    //perlin fade 6t^5 - 15t^4 + 10t^3 of the three axes
+    static void fade(float x, float y, float z, float out[3]) {
+#if defined(NORI_PERLIN_SSE)
+        __m128 t = _mm_setr_ps(x, y, z, 0.f);
+        __m128 r = _mm_add_ps(_mm_mul_ps(t, _mm_set1_ps(6.f)), _mm_set1_ps(-15.f));
+        r = _mm_add_ps(_mm_mul_ps(r, t), _mm_set1_ps(10.f));
+        r = _mm_mul_ps(r, _mm_mul_ps(t, _mm_mul_ps(t, t)));
+        float tmp[4];
+        _mm_storeu_ps(tmp, r);
+        out[0] = tmp[0];
+        out[1] = tmp[1];
+        out[2] = tmp[2];
+#else
+        float t[3] = { x, y, z };
+        for (int i = 0; i < 3; i++)
+            out[i] = t[i] * t[i] * t[i] * (t[i] * (t[i] * 6.f - 15.f) + 10.f);
+#endif
     }
-protected:
+
     int m_row = 0;
     int m_col = 0;
     int m_height = 0;
-    float* m_grid = nullptr;
+    std::vector<float> m_grid;
 };
 
+/* Procedural Perlin volume over the bounding box of the medium's shape.
+By default the noise is baked at gridGeneration() into a voxel grid ("resolution"
+voxels along the longest axis, optionally stored in sparse bricks) that is looked up
+with plain trilinear interpolation; "exact" evaluates the noise at every lookup instead */
 class PerlinVolume : public Volume {
 public:
     PerlinVolume(const PropertyList& props) {
         m_value = props.getFloat("value");
+        m_seed = (uint32_t) props.getInteger("seed", 0);
+        m_exact = props.getBoolean("exact", false);
+        m_resolution = props.getInteger("resolution", 128);
+        m_sparse = props.getBoolean("sparse", false);
+        // values of at most this magnitude count as empty space when building bricks
+        m_threshold = props.getFloat("threshold", 0.f);
+        if (!m_exact && m_resolution < 2)
+            throw NoriException("PerlinVolume: the resolution must be at least 2!");
     }
     virtual void gridGeneration() override {
-        
         BoundingBox3f bbox = this->m_medium->getShape()->getBoundingBox();
-        this->m_medium->getShape();
-
         m_min = bbox.min;
         m_max = bbox.max;
-        int row = (int)ceil((m_max.x() - m_min.x()) / m_scale_x);
-        float col = (int)ceil((m_max.y() - m_min.y()) / m_scale_y);
-        float height = (int)ceil((m_max.z() - m_min.z()) / m_scale_z);
-        m_pn = new PerlinNoise3D(row, col, height, m_value);
+        Vector3f diag = bbox.getExtents();
+        // one more lattice point than cells, so that the far faces are covered
+        int row = std::max(2, (int)ceil(diag.x() / m_scale_x) + 1);
+        int col = std::max(2, (int)ceil(diag.y() / m_scale_y) + 1);
+        int height = std::max(2, (int)ceil(diag.z() / m_scale_z) + 1);
+        m_pn.reset(new PerlinNoise3D(row, col, height, m_value, m_seed));
+        if (m_exact)
+            return;
+
+        float maxExtent = diag.maxCoeff();
+        for (int i = 0; i < 3; i++) {
+            m_res[i] = std::max(2, (int)ceil(m_resolution * diag[i] / maxExtent));
+            m_toVoxel[i] = (m_res[i] - 1) / diag[i];
+        }
+        std::vector<float> voxels((size_t) m_res[0] * m_res[1] * m_res[2]);
+        tbb::parallel_for(tbb::blocked_range<int>(0, m_res[2]),
+            [&](const tbb::blocked_range<int>& range) {
+                for (int z = range.begin(); z != range.end(); z++) {
+                    for (int y = 0; y < m_res[1]; y++) {
+                        for (int x = 0; x < m_res[0]; x++) {
+                            Point3f p = m_min + Vector3f(x / m_toVoxel[0], y / m_toVoxel[1], z / m_toVoxel[2]);
+                            voxels[((size_t) z * m_res[1] + y) * m_res[0] + x] = evalExact(p);
+                        }
+                    }
+                }
+            }
+        );
+        if (m_sparse)
+            m_bricks.build(voxels.data(), m_res[0], m_res[1], m_res[2], 1, m_threshold);
+        else
+            m_voxels = std::move(voxels);
+        // the baked grid replaces the lattice
+        m_pn.reset();
     }
     virtual float lookupFloat(const Point3f& p) const override {
-        float result = m_pn->getP((p.x()-m_min.x())/m_scale_x, (p.y() - m_min.y()) / m_scale_y, (p.z() - m_min.z()) / m_scale_z);
-        return result;
+        if (m_exact)
+            return evalExact(p);
+        int cell[3];
+        float d[3];
+        for (int i = 0; i < 3; i++) {
+            float g = clamp((p[i] - m_min[i]) * m_toVoxel[i], 0.f, (float) (m_res[i] - 1));
+            cell[i] = std::min((int) g, m_res[i] - 2);
+            d[i] = g - cell[i];
+        }
+        float c[8];
+        if (m_sparse) {
+            m_bricks.fetchCell(cell[0], cell[1], cell[2], 0, c);
+        }
+        else {
+            size_t dy = m_res[0], dz = (size_t) m_res[0] * m_res[1];
+            const float* v = &m_voxels[cell[0] + cell[1] * dy + cell[2] * dz];
+            c[0] = v[0]; c[1] = v[1]; c[2] = v[dy]; c[3] = v[dy + 1];
+            c[4] = v[dz]; c[5] = v[dz + 1]; c[6] = v[dz + dy]; c[7] = v[dz + dy + 1];
+        }
+        return trilinear(c, d[0], d[1], d[2]);
     };
+    /* Both the noise and its trilinear bake are bounded by the surrounding lattice points or voxels */
+    virtual void lookupBounds(const BoundingBox3f& box, float& minValue, float& maxValue) const override {
+        int lo[3], hi[3];
+        if (m_exact) {
+            Vector3f scale(m_scale_x, m_scale_y, m_scale_z);
+            for (int i = 0; i < 3; i++) {
+                lo[i] = int(floor((box.min[i] - m_min[i]) / scale[i]));
+                hi[i] = int(floor((box.max[i] - m_min[i]) / scale[i])) + 1;
+            }
+            m_pn->getRange(lo, hi, minValue, maxValue);
+            return;
+        }
+        for (int i = 0; i < 3; i++) {
+            lo[i] = clamp(int(floor((box.min[i] - m_min[i]) * m_toVoxel[i])), 0, m_res[i] - 1);
+            hi[i] = clamp(int(floor((box.max[i] - m_min[i]) * m_toVoxel[i])) + 1, 0, m_res[i] - 1);
+        }
+        if (m_sparse) {
+            m_bricks.getRange(lo, hi, 0, minValue, maxValue);
+            return;
+        }
+        minValue = std::numeric_limits<float>::infinity();
+        maxValue = -std::numeric_limits<float>::infinity();
+        for (int z = lo[2]; z <= hi[2]; z++) {
+            for (int y = lo[1]; y <= hi[1]; y++) {
+                for (int x = lo[0]; x <= hi[0]; x++) {
+                    float value = m_voxels[((size_t) z * m_res[1] + y) * m_res[0] + x];
+                    minValue = std::min(minValue, value);
+                    maxValue = std::max(maxValue, value);
+                }
+            }
+        }
+    }
     virtual Color3f lookupRGB(const Point3f& p) const override {
         //not used
         return Color3f(0.0f);
@@ -93,17 +231,33 @@ public:
         return true;
     }
     std::string toString() const override {
-        return tfm::format("PerlinFloatVolume[]");
+        if (m_exact)
+            return tfm::format("PerlinFloatVolume[value = %f, seed = %i, exact = true]", m_value, m_seed);
+        return tfm::format("PerlinFloatVolume[value = %f, seed = %i, resolution = %i, sparse = %s]",
+            m_value, m_seed, m_resolution, m_sparse ? "true" : "false");
     }
 protected:
+    float evalExact(const Point3f& p) const {
+        return m_pn->getP((p.x() - m_min.x()) / m_scale_x, (p.y() - m_min.y()) / m_scale_y, (p.z() - m_min.z()) / m_scale_z);
+    }
+
     float m_value;
+    uint32_t m_seed;
+    bool m_exact;
+    int m_resolution;
+    bool m_sparse;
+    float m_threshold;
     float m_scale_x = 0.1;
     float m_scale_y = 0.1;
     float m_scale_z = 0.1;
     Point3f m_min = Point3f(0);
     Point3f m_max = Point3f(0);
-    PerlinNoise3D *m_pn = nullptr;
+    std::unique_ptr<PerlinNoise3D> m_pn;
+    int m_res[3] = { 0, 0, 0 };
+    Vector3f m_toVoxel = Vector3f(0.f);
+    std::vector<float> m_voxels;
+    BrickGrid m_bricks;
 };
 
 NORI_REGISTER_CLASS(PerlinVolume, "plVol");
-NORI_NAMESPACE_END
\ No newline at end of file
+NORI_NAMESPACE_END
@@ -69,11 +69,11 @@ public:
         int currPhotonCount = 0;
         while (currPhotonCount < m_photonCount) {
             /* sample photon */
-            const Emitter* light = scene->getRandomEmitter(sampler->next1D());
-            const int n_lights = scene->getLights().size();
+            float lightPdf;
+            const Emitter* light = scene->getRandomEmitter(sampler->next1D(), lightPdf);
             Ray3f currRay;
             Color3f t = 1.f;
-            Color3f w = light->samplePhoton(currRay, sampler->next2D(), sampler->next2D()) * n_lights;
+            Color3f w = light->samplePhoton(currRay, sampler->next2D(), sampler->next2D()) / lightPdf;
             Intersection its;
             m_emittedPhotonCount ++;
             
@@ -150,7 +150,7 @@ public:
 
             /* compute Le when intersection is an emitter */
             if (its.mesh->isEmitter()) {
-                EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n);
+                EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n, its.primIndex);
                 color += t * its.mesh->getEmitter()->eval(lRec);
             }
 
@@ -0,0 +1,283 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/mesh.h>
+#include <nori/timer.h>
+#include <nori/plyfile.h>
+#include <nori/assetcache.h>
+#include <filesystem/resolver.h>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <limits>
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * \brief Loader for PLY triangle and polygon meshes
+ *
+ * Reads ASCII as well as binary PLY files. The vertex element (x/y/z,
+ * optional nx/ny/nz and u/v) is decoded in batches of whole records,
+ * and polygons of the face element are fan-triangulated while they are
+ * streamed in, so apart from the mesh itself only a fixed-size buffer
+ * is needed. The \c toWorld transformation is applied in a parallel
+ * pass once all data has been read.
+ */
+class PLYMesh : public Mesh {
+public:
+    PLYMesh(const PropertyList &propList) {
+        filesystem::path filename =
+            getFileResolver()->resolve(propList.getString("filename"));
+        Transform trafo = propList.getTransform("toWorld", Transform());
+
+        Timer timer;
+
+        bool compact = propList.getBoolean("compact", false);
+
+        /* The compact representation is part of the shared data, so it is part of the key */
+        bool loaded = false;
+        std::shared_ptr<const MeshData> data = getCache().get(
+            makeAssetKey("ply", filename.str(), trafo.getMatrix().data(), sizeof(Eigen::Matrix4f)) +
+                (compact ? "|compact" : ""),
+            [&] { return load(filename, trafo, compact); }, &loaded);
+        setMeshData(data);
+        m_bbox = data->bbox;
+        m_name = filename.str();
+
+        /* Print in one go, since several objects may be loading in parallel */
+        std::string mem = memString(data->getFullSize()) + (loaded ? "" : " shared");
+        if (compact)
+            mem += ", compacted to " + memString(data->getSize());
+        cout << tfm::format("Loading \"%s\" .. done. (V=%i, F=%i, took %s and %s)\n",
+            filename, m_V.cols(), getPrimitiveCount(), timer.elapsedString(), mem);
+    }
+
+protected:
+    /// Read a PLY file; shared by all meshes with the same transformation and \c compact flag
+    static std::shared_ptr<MeshData> load(const filesystem::path &filename, const Transform &trafo, bool compact) {
+        PLYReader ply(filename.str());
+
+        /* The header gives the vertex count, so faces can be validated
+           while they are read even if they precede the vertices */
+        size_t vertexCount = 0;
+        for (const PLYElement &element : ply.getElements()) {
+            if (element.name == "vertex")
+                vertexCount = element.count;
+        }
+        if (vertexCount > std::numeric_limits<uint32_t>::max())
+            throw NoriException("PLY file \"%s\" has too many vertices!", filename);
+
+        MatrixXf V, N, UV;
+        MatrixXu F;
+        size_t nTriangles = 0;
+        for (const PLYElement &element : ply.getElements()) {
+            if (element.name == "vertex")
+                readVertices(ply, element, V, N, UV);
+            else if (element.name == "face")
+                readFaces(ply, element, (uint32_t) vertexCount, F, nTriangles);
+            else
+                skipElement(ply, element);
+        }
+
+        if (V.cols() == 0 || nTriangles == 0) {
+            throw NoriException("PLY file \"%s\" contains no triangles!", filename);
+        }
+        /* Drop the slack left by polygons that triangulated into fewer triangles than reserved */
+        if ((size_t) F.cols() != nTriangles)
+            F.conservativeResize(3, nTriangles);
+
+        uint32_t nVertices = (uint32_t) V.cols();
+
+        if (!trafo.getMatrix().isIdentity()) {
+            tbb::parallel_for(tbb::blocked_range<uint32_t>(0u, nVertices),
+                [&](const tbb::blocked_range<uint32_t> &range) {
+                    for (uint32_t i = range.begin(); i != range.end(); ++i) {
+                        V.col(i) = trafo * Point3f(V.col(i));
+                        if (N.size() > 0)
+                            N.col(i) = (trafo * Normal3f(N.col(i))).normalized();
+                    }
+                }
+            );
+        }
+        BoundingBox3f bbox;
+        for (uint32_t i = 0; i < nVertices; ++i)
+            bbox.expandBy(Point3f(V.col(i)));
+
+        auto data = std::make_shared<MeshData>();
+        data->V = std::move(V);
+        data->N = std::move(N);
+        data->UV = std::move(UV);
+        data->F = std::move(F);
+        data->bbox = bbox;
+        if (compact)
+            data->compact();
+        return data;
+    }
+
+    /// Meshes loaded by this plugin, keyed by file name and transformation
+    static AssetCache<MeshData> &getCache() {
+        static AssetCache<MeshData> cache;
+        return cache;
+    }
+
+    /// Approximate size of the buffer used to decode binary vertex records
+    static const size_t PLY_BATCH_SIZE = 1 << 20;
+
+    static int findProperty(const PLYElement &element, std::initializer_list<const char *> names) {
+        for (const char *name : names) {
+            int index = element.find(name);
+            if (index >= 0 && !element.properties[index].isList())
+                return index;
+        }
+        return -1;
+    }
+
+    static void readVertices(PLYReader &ply, const PLYElement &element,
+            MatrixXf &V, MatrixXf &N, MatrixXf &UV) {
+        /* Slots 0-2: position, 3-5: normal, 6-7: texture coordinates */
+        int slots[8] = {
+            findProperty(element, { "x" }),
+            findProperty(element, { "y" }),
+            findProperty(element, { "z" }),
+            findProperty(element, { "nx" }),
+            findProperty(element, { "ny" }),
+            findProperty(element, { "nz" }),
+            findProperty(element, { "u", "s", "texture_u", "texture_s" }),
+            findProperty(element, { "v", "t", "texture_v", "texture_t" })
+        };
+        if (slots[0] < 0 || slots[1] < 0 || slots[2] < 0)
+            throw NoriException("PLY file \"%s\": vertices lack x/y/z coordinates!", ply.getFilename());
+        bool hasNormals = slots[3] >= 0 && slots[4] >= 0 && slots[5] >= 0;
+        bool hasTexCoords = slots[6] >= 0 && slots[7] >= 0;
+
+        /* Map each property to the slot it fills (or -1) */
+        std::vector<int> target(element.properties.size(), -1);
+        for (int slot = 0; slot < 8; ++slot) {
+            if (slots[slot] < 0 || (slot >= 3 && slot < 6 && !hasNormals) ||
+                (slot >= 6 && !hasTexCoords))
+                continue;
+            target[slots[slot]] = slot;
+        }
+
+        size_t count = element.count;
+        V.resize(3, count);
+        if (hasNormals)
+            N.resize(3, count);
+        if (hasTexCoords)
+            UV.resize(2, count);
+
+        auto store = [&](size_t j, int slot, float value) {
+            if (slot < 3)
+                V(slot, j) = value;
+            else if (slot < 6)
+                N(slot - 3, j) = value;
+            else
+                UV(slot - 6, j) = value;
+        };
+
+        size_t recordSize = element.recordSize();
+        if (ply.isBinary() && recordSize > 0) {
+            std::vector<size_t> offsets(element.properties.size());
+            for (size_t k = 1; k < offsets.size(); ++k)
+                offsets[k] = offsets[k - 1] + plyTypeSize(element.properties[k - 1].type);
+
+            size_t batch = std::max((size_t) 1, PLY_BATCH_SIZE / recordSize);
+            std::vector<char> buffer(batch * recordSize);
+            for (size_t start = 0; start < count; start += batch) {
+                size_t n = std::min(batch, count - start);
+                ply.readRaw(buffer.data(), n * recordSize);
+                for (size_t r = 0; r < n; ++r) {
+                    const char *record = buffer.data() + r * recordSize;
+                    for (size_t k = 0; k < target.size(); ++k) {
+                        if (target[k] >= 0)
+                            store(start + r, target[k],
+                                (float) ply.decode(record + offsets[k], element.properties[k].type));
+                    }
+                }
+            }
+        } else {
+            for (size_t j = 0; j < count; ++j) {
+                for (size_t k = 0; k < target.size(); ++k) {
+                    const PLYProperty &prop = element.properties[k];
+                    if (target[k] >= 0)
+                        store(j, target[k], (float) ply.read(prop.type));
+                    else
+                        ply.skip(prop);
+                }
+            }
+        }
+    }
+
+    /**
+     * Triangulate the faces straight into \c F, which starts out with one
+     * column per face and only grows (geometrically) when polygons produce
+     * more triangles. Vertex indices are checked against \c nVertices as
+     * they are read.
+     */
+    static void readFaces(PLYReader &ply, const PLYElement &element,
+            uint32_t nVertices, MatrixXu &F, size_t &nTriangles) {
+        int listIndex = element.find("vertex_indices");
+        if (listIndex < 0)
+            listIndex = element.find("vertex_index");
+        if (listIndex < 0 || !element.properties[listIndex].isList())
+            throw NoriException("PLY file \"%s\": faces lack a vertex index list!", ply.getFilename());
+
+        if ((size_t) F.cols() < nTriangles + element.count)
+            F.conservativeResize(3, nTriangles + element.count);
+        std::vector<uint32_t> polygon;
+        for (size_t j = 0; j < element.count; ++j) {
+            for (int k = 0; k < (int) element.properties.size(); ++k) {
+                const PLYProperty &prop = element.properties[k];
+                if (k != listIndex) {
+                    ply.skip(prop);
+                    continue;
+                }
+
+                size_t n = (size_t) ply.read(prop.countType);
+                polygon.resize(n);
+                for (size_t i = 0; i < n; ++i) {
+                    double value = ply.read(prop.type);
+                    if (value < 0)
+                        throw NoriException("PLY file \"%s\" contains a negative vertex index!", ply.getFilename());
+                    if (value >= nVertices)
+                        throw NoriException("PLY file \"%s\" references a nonexistent vertex (index %i)!",
+                            ply.getFilename(), (size_t) value);
+                    polygon[i] = (uint32_t) value;
+                }
+
+                /* Fan triangulation of convex polygons */
+                if (n > 3 && (size_t) F.cols() < nTriangles + n - 2)
+                    F.conservativeResize(3, std::max(nTriangles + n - 2, (size_t) F.cols() * 2));
+                for (size_t i = 1; i + 1 < n; ++i) {
+                    F(0, nTriangles) = polygon[0];
+                    F(1, nTriangles) = polygon[i];
+                    F(2, nTriangles) = polygon[i + 1];
+                    ++nTriangles;
+                }
+            }
+        }
+    }
+
+    static void skipElement(PLYReader &ply, const PLYElement &element) {
+        for (size_t j = 0; j < element.count; ++j)
+            for (const PLYProperty &prop : element.properties)
+                ply.skip(prop);
+    }
+};
+
+NORI_REGISTER_CLASS(PLYMesh, "ply");
+NORI_NAMESPACE_END
@@ -0,0 +1,217 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/plyfile.h>
+#include <cstring>
+
+NORI_NAMESPACE_BEGIN
+
+/// Size of the buffer through which binary payloads are streamed
+static const size_t PLY_BUFFER_SIZE = 1 << 20;
+
+static EPLYType parsePLYType(const std::string &str, const std::string &filename) {
+    if (str == "char" || str == "int8")
+        return EPLYInt8;
+    else if (str == "uchar" || str == "uint8")
+        return EPLYUInt8;
+    else if (str == "short" || str == "int16")
+        return EPLYInt16;
+    else if (str == "ushort" || str == "uint16")
+        return EPLYUInt16;
+    else if (str == "int" || str == "int32")
+        return EPLYInt32;
+    else if (str == "uint" || str == "uint32")
+        return EPLYUInt32;
+    else if (str == "float" || str == "float32")
+        return EPLYFloat32;
+    else if (str == "double" || str == "float64")
+        return EPLYFloat64;
+    throw NoriException("PLY file \"%s\": unknown property type \"%s\"!", filename, str);
+}
+
+size_t plyTypeSize(EPLYType type) {
+    switch (type) {
+        case EPLYInt8:
+        case EPLYUInt8: return 1;
+        case EPLYInt16:
+        case EPLYUInt16: return 2;
+        case EPLYInt32:
+        case EPLYUInt32:
+        case EPLYFloat32: return 4;
+        case EPLYFloat64: return 8;
+        default: return 0;
+    }
+}
+
+int PLYElement::find(const std::string &name) const {
+    for (size_t i = 0; i < properties.size(); ++i)
+        if (properties[i].name == name)
+            return (int) i;
+    return -1;
+}
+
+size_t PLYElement::recordSize() const {
+    size_t size = 0;
+    for (const PLYProperty &prop : properties) {
+        if (prop.isList())
+            return 0;
+        size += plyTypeSize(prop.type);
+    }
+    return size;
+}
+
+PLYReader::PLYReader(const std::string &filename)
+    : m_filename(filename), m_is(filename, std::ios::binary) {
+    if (m_is.fail())
+        throw NoriException("Unable to open PLY file \"%s\"!", filename);
+
+    std::string line;
+    std::getline(m_is, line);
+    if (!line.empty() && line.back() == '\r')
+        line.pop_back();
+    if (line != "ply")
+        throw NoriException("\"%s\" is not a PLY file!", filename);
+
+    bool littleEndian = false;
+    while (true) {
+        if (!std::getline(m_is, line))
+            throw NoriException("PLY file \"%s\": unexpected end of header!", filename);
+        std::vector<std::string> tokens = tokenize(line, " \t\r");
+        if (tokens.empty())
+            continue;
+        const std::string &keyword = tokens[0];
+
+        if (keyword == "end_header") {
+            break;
+        } else if (keyword == "format") {
+            if (tokens.size() < 2)
+                throw NoriException("PLY file \"%s\": malformed format line!", filename);
+            if (tokens[1] == "ascii") {
+                m_binary = false;
+            } else if (tokens[1] == "binary_little_endian") {
+                m_binary = true;
+                littleEndian = true;
+            } else if (tokens[1] == "binary_big_endian") {
+                m_binary = true;
+                littleEndian = false;
+            } else {
+                throw NoriException("PLY file \"%s\": unsupported format \"%s\"!", filename, tokens[1]);
+            }
+        } else if (keyword == "element") {
+            if (tokens.size() != 3)
+                throw NoriException("PLY file \"%s\": malformed element line \"%s\"!", filename, line);
+            PLYElement element;
+            element.name = tokens[1];
+            element.count = (size_t) std::stoull(tokens[2]);
+            m_elements.push_back(element);
+        } else if (keyword == "property") {
+            if (m_elements.empty())
+                throw NoriException("PLY file \"%s\": property outside of an element!", filename);
+            PLYProperty prop;
+            if (tokens.size() == 5 && tokens[1] == "list") {
+                prop.countType = parsePLYType(tokens[2], filename);
+                prop.type = parsePLYType(tokens[3], filename);
+                prop.name = tokens[4];
+            } else if (tokens.size() == 3) {
+                prop.type = parsePLYType(tokens[1], filename);
+                prop.name = tokens[2];
+            } else {
+                throw NoriException("PLY file \"%s\": malformed property line \"%s\"!", filename, line);
+            }
+            m_elements.back().properties.push_back(prop);
+        } else if (keyword != "comment" && keyword != "obj_info") {
+            throw NoriException("PLY file \"%s\": unexpected header line \"%s\"!", filename, line);
+        }
+    }
+
+    if (m_binary) {
+        uint16_t probe = 1;
+        bool hostLittleEndian = *((uint8_t *) &probe) == 1;
+        m_swap = littleEndian != hostLittleEndian;
+        m_buffer.reset(new char[PLY_BUFFER_SIZE]);
+    }
+}
+
+int PLYReader::findElement(const std::string &name) const {
+    for (size_t i = 0; i < m_elements.size(); ++i)
+        if (m_elements[i].name == name)
+            return (int) i;
+    return -1;
+}
+
+void PLYReader::refill() {
+    size_t remaining = m_end - m_pos;
+    memmove(m_buffer.get(), m_buffer.get() + m_pos, remaining);
+    m_is.read(m_buffer.get() + remaining, (std::streamsize) (PLY_BUFFER_SIZE - remaining));
+    m_pos = 0;
+    m_end = remaining + (size_t) m_is.gcount();
+}
+
+void PLYReader::readRaw(char *dst, size_t size) {
+    while (size > 0) {
+        if (m_pos == m_end) {
+            refill();
+            if (m_pos == m_end)
+                throw NoriException("PLY file \"%s\": unexpected end of file!", m_filename);
+        }
+        size_t n = std::min(size, m_end - m_pos);
+        memcpy(dst, m_buffer.get() + m_pos, n);
+        m_pos += n;
+        dst += n;
+        size -= n;
+    }
+}
+
+double PLYReader::readASCII() {
+    double value;
+    if (!(m_is >> value))
+        throw NoriException("PLY file \"%s\": unexpected end of file!", m_filename);
+    return value;
+}
+
+void PLYReader::skip(const PLYProperty &prop) {
+    size_t count = prop.isList() ? (size_t) read(prop.countType) : 1;
+    for (size_t i = 0; i < count; ++i)
+        read(prop.type);
+}
+
+double PLYReader::decode(const char *ptr, EPLYType type) const {
+    char buf[8];
+    size_t size = plyTypeSize(type);
+    if (m_swap) {
+        for (size_t i = 0; i < size; ++i)
+            buf[i] = ptr[size - 1 - i];
+    } else {
+        memcpy(buf, ptr, size);
+    }
+
+    switch (type) {
+        case EPLYInt8: { int8_t v; memcpy(&v, buf, 1); return v; }
+        case EPLYUInt8: { uint8_t v; memcpy(&v, buf, 1); return v; }
+        case EPLYInt16: { int16_t v; memcpy(&v, buf, 2); return v; }
+        case EPLYUInt16: { uint16_t v; memcpy(&v, buf, 2); return v; }
+        case EPLYInt32: { int32_t v; memcpy(&v, buf, 4); return v; }
+        case EPLYUInt32: { uint32_t v; memcpy(&v, buf, 4); return v; }
+        case EPLYFloat32: { float v; memcpy(&v, buf, 4); return v; }
+        case EPLYFloat64: { double v; memcpy(&v, buf, 8); return v; }
+        default:
+            throw NoriException("PLY file \"%s\": invalid property type!", m_filename);
+    }
+}
+
+NORI_NAMESPACE_END
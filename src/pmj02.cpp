@@ -0,0 +1,156 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/sampler.h>
+#include <nori/block.h>
+#include <nori/lowdiscrepancy.h>
+#include <nori/pmj02.h>
+#include <filesystem/resolver.h>
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * Progressive multi-jittered (0,2) sampling - returns components of
+ * precomputed PMJ02 sequences.
+ *
+ * The sequences are generated offline by the \c pmj02gen tool. By
+ * default, the table compiled into Nori is used; the \c filename
+ * property loads a ".pmj" table instead, e.g. one with more sets or
+ * points per set.
+ *
+ * Every 1D or 2D request reads its own randomization of one of the
+ * sequences, chosen by a hash of the pixel, the index of the request
+ * within the sample and the \c seed property. The points are Owen
+ * scrambled, and the sample index is shuffled within each range
+ * <tt>[2^k, 2^(k+1))</tt> to decorrelate requests that share a
+ * sequence. Every power-of-two prefix of a pixel's samples therefore
+ * still forms a (0,m,2)-net, so renders can stop after any number of
+ * samples: the first 2^k of them are always fully stratified. Sample
+ * counts beyond the table size continue with further sets.
+ */
+class PMJ02 : public Sampler {
+public:
+    PMJ02(const PropertyList &propList) {
+        m_sampleCount = (size_t) propList.getInteger("sampleCount", 1);
+        m_seed = (uint32_t) propList.getInteger("seed", 0);
+
+        std::string filename = propList.getString("filename", "");
+        if (filename.empty()) {
+            m_table = PMJ02Table::getDefault();
+        } else {
+            m_filename = getFileResolver()->resolve(filename).str();
+            m_table = PMJ02Table::load(m_filename);
+        }
+    }
+
+    virtual ~PMJ02() { }
+
+    std::unique_ptr<Sampler> clone() const {
+        std::unique_ptr<PMJ02> cloned(new PMJ02());
+        cloned->m_sampleCount = m_sampleCount;
+        cloned->m_seed = m_seed;
+        cloned->m_filename = m_filename;
+        cloned->m_table = m_table;
+        cloned->m_pixel = m_pixel;
+        cloned->m_index = m_index;
+        cloned->m_dimension = m_dimension;
+        return std::move(cloned);
+    }
+
+    void prepare(const ImageBlock &block) {
+        m_pixel = block.getOffset();
+        m_index = m_dimension = 0;
+    }
+
+    void generate() {
+        m_index = m_dimension = 0;
+    }
+
+    void advance() {
+        ++m_index;
+        m_dimension = 0;
+    }
+
+    void startPixelSample(const Point2i &pixel, uint32_t index) {
+        m_pixel = pixel;
+        m_index = index;
+        m_dimension = 0;
+    }
+
+    float next1D() {
+        uint64_t hash;
+        const uint32_t *p = nextPoint(hash);
+        return fixedToFloat(owenScramble(p[0], (uint32_t) (hash >> 32)));
+    }
+
+    Point2f next2D() {
+        uint64_t hash;
+        const uint32_t *p = nextPoint(hash);
+        return Point2f(
+            fixedToFloat(owenScramble(p[0], (uint32_t) (hash >> 32))),
+            fixedToFloat(owenScramble(p[1], (uint32_t) mixBits(hash)))
+        );
+    }
+
+    virtual std::string toString() const override {
+        return tfm::format(
+            "PMJ02[sampleCount=%i, seed=%i, table=%s (%i x %i)]",
+            m_sampleCount, m_seed, m_filename.empty() ? "default" : m_filename,
+            m_table->setCount, m_table->sampleCount);
+    }
+protected:
+    PMJ02() { }
+
+    /// Shuffle an index within [2^k, 2^(k+1)), which keeps all power-of-two prefixes
+    static uint32_t shuffleIndex(uint32_t index, uint32_t seed) {
+        if (index < 2)
+            return index;
+        int k = 0;
+        while ((index >> (k + 1)) != 0)
+            ++k;
+        uint32_t low = index ^ (1u << k);
+        low = owenScramble(low << (32 - k), seed) >> (32 - k);
+        return (1u << k) | low;
+    }
+
+    /// Look up the point for the next request and return the hash that randomizes it
+    const uint32_t *nextPoint(uint64_t &hash) {
+        hash = hashCombine(mixBits(((uint64_t) (uint32_t) m_pixel.x() << 32) |
+                                   (uint32_t) m_pixel.y()), m_dimension++);
+        hash = hashCombine(hash, m_seed);
+
+        uint32_t index = m_index, size = m_table->sampleCount;
+        if (index >= size) {
+            hash = hashCombine(hash, index / size);
+            index %= size;
+        }
+        uint32_t set = (uint32_t) (hash % m_table->setCount);
+        return m_table->get(set, shuffleIndex(index, (uint32_t) (mixBits(hash) >> 32)));
+    }
+
+private:
+    uint32_t m_seed = 0;
+    std::string m_filename;
+    std::shared_ptr<const PMJ02Table> m_table;
+    Point2i m_pixel = Point2i(0, 0);
+    uint32_t m_index = 0;
+    uint32_t m_dimension = 0;
+};
+
+NORI_REGISTER_CLASS(PMJ02, "pmj02");
+NORI_NAMESPACE_END
@@ -0,0 +1,1379 @@
+/* Generated by pmj02gen, do not edit */
+
+#include <nori/common.h>
+
+NORI_NAMESPACE_BEGIN
+
+extern const uint32_t PMJ02DefaultSetCount = 4;
+extern const uint32_t PMJ02DefaultSampleCount = 1024;
+
+extern const uint32_t PMJ02DefaultPoints[] = {
+    0x97a1773e, 0x0a65ce7d, 0x05a07892, 0xda7eb74f, 0xfbb21cff, 0x81ed0b40,
+    0x7f4959dd, 0x7999ce01, 0xc356e40d, 0x5d328825, 0x421f5772, 0xa87b05e1,
+    0xad4177f9, 0xfba7d25d, 0x24abbd2b, 0x33c1f8fb, 0xb3898633, 0x65f85be9,
+    0x3e084e45, 0x9c141aae, 0xdce490f2, 0xc71601ee, 0x565c002a, 0x17d50391,
+    0xea204561, 0x2b0a2463, 0x6bfc1388, 0xe264a49d, 0x8076aeed, 0xb9efd7b3,
+    0x195a9b2b, 0x478b3b19, 0xa32ab7e1, 0x3d2d1950, 0x29f2c982, 0xf157ff72,
+    0xc881f1f4, 0xa5a5e106, 0x4d2de11a, 0x52823e9e, 0xf15850a5, 0x77bf8195,
+    0x76db6c91, 0x89361907, 0x9e1e7136, 0xd79386c8, 0x0e282691, 0x061debd1,
+    0x8ae2e01b, 0x4e4cb674, 0x17f8c011, 0xb29a6c8d, 0xe09db6e5, 0xe85bd133,
+    0x662ce2ab, 0x23dacb16, 0xd3499f70, 0x1dde34e0, 0x5b10004a, 0xce90e165,
+    0xbc155526, 0x90e80315, 0x36186f5a, 0x6f30c547, 0x858808a9, 0x24810adc,
+    0x1c9fefda, 0xed6b2835, 0xecea212c, 0xb41d794e, 0x6fb0b853, 0x4b1ccfdf,
+    0xdbcfc1e6, 0x6a042936, 0x51a7b937, 0x96ca7025, 0xb73bedad, 0xca48502f,
+    0x3ac2f64a, 0x1a033a7c, 0xa9c95992, 0x57e6f6b8, 0x2081bdef, 0xa1ccee65,
+    0xc62ce72a, 0xf56277ab, 0x4557bb94, 0x3957a1f1, 0xfff6d536, 0x036c22fd,
+    0x7876a544, 0xd39c416d, 0x93294345, 0x8c3bc79b, 0x01b82340, 0x725ef0fb,
+    0xbb153e2b, 0x1139e728, 0x33de9a6d, 0xc12746b9, 0xd45d61f7, 0x9b912087,
+    0x5dd3613c, 0x638ada1a, 0xe4b0a85a, 0x4379fa09, 0x637643ca, 0xbd32f21b,
+    0x8ead6fee, 0xe45bd4df, 0x12ac0926, 0x2d7ad171, 0x9a36c82a, 0x7f58a7c6,
+    0x08398bb8, 0x857ade82, 0xf54a58d5, 0xdefaf88a, 0x7213861c, 0x0ec55f0e,
+    0xce2d03d3, 0x36dd2b0f, 0x4bcebc79, 0xfd2bea5b, 0xa5018a74, 0xae791094,
+    0x2c04382f, 0x59e3aaf0, 0x8df20afd, 0x19199c75, 0x115ff6f6, 0xc9269ac5,
+    0xe6955045, 0x9561b8a8, 0x612ec116, 0x69549158, 0xd6c61b4d, 0x4818468a,
+    0x5e0f3f88, 0xb793bc85, 0xb8a6cab2, 0xee668d87, 0x315534fa, 0x27e45747,
+    0xa6e03945, 0x719877b2, 0x2e7d3e62, 0x8e107c1f, 0xcc69a8de, 0xd1648ed5,
+    0x49fabe59, 0x00ca5b55, 0xf7ede4ce, 0x3bb25a48, 0x719a0d97, 0xf7edfe24,
+    0x9940441e, 0xa30f995a, 0x0a3d974e, 0x5527beac, 0xb54a40b7, 0x2e818994,
+    0x39775fc9, 0xe7a4dee2, 0xd957ad9a, 0xbecf0f35, 0x5271f3b5, 0x40ef2578,
+    0xef970528, 0x604212d1, 0x6ca89f6a, 0x982776d2, 0x8674c01a, 0xc2b61d75,
+    0x1ff90e14, 0x124cf206, 0x918dc51f, 0x5ae5f3b8, 0x02e86224, 0xad31f9d2,
+    0xfcfcdac7, 0xfed725ac, 0x7b6f8a08, 0x34cf1fdb, 0xc5eb5852, 0x0c75f1b0,
+    0x4741b6f0, 0xddc01150, 0xaae6eaf3, 0x863761c3, 0x23986857, 0x7d6181f7,
+    0x9c8f363e, 0x303c45db, 0x0cf1a38e, 0xf91e3f8a, 0xf3c8cb1e, 0xaa28fc2e,
+    0x74473c72, 0x5fde3600, 0xcb9393b6, 0x7a706198, 0x4e7bd4c4, 0x8388b995,
+    0xa1468e47, 0xd981271b, 0x2bab5dc0, 0x09e3e875, 0xbe4157db, 0x4561a6ca,
+    0x359c9036, 0xba428bec, 0xd100a096, 0xe1c9a733, 0x5972600b, 0x290abdd7,
+    0xe3a138da, 0x142c54e7, 0x6535c0d6, 0xc530dc37, 0x88899ad9, 0x9f4912e6,
+    0x14ff8260, 0x66750eb2, 0xafd17aef, 0x05dbcc6a, 0x27198b3b, 0xd4f35b42,
+    0xc069b3c9, 0x8a1c78a1, 0x41ec228c, 0x74d9028b, 0xf98421f4, 0x5079a721,
+    0x7c4e805a, 0xa6a5dacf, 0x9543bff4, 0xf2bf0ec9, 0x076353ec, 0x3e644212,
+    0x83053d91, 0x6c203b2d, 0x1a2917cd, 0x92d9b8cf, 0xe8fe8a72, 0xcc94d54e,
+    0x68191a53, 0x1f9729ef, 0xdf6ab450, 0x21fd6057, 0x55baa702, 0xebedf176,
+    0xb061b7ce, 0xb0291247, 0x3d58bf9e, 0x4cd9ec5a, 0x98940713, 0x16f737fa,
+    0x0b25fd53, 0xc6730c05, 0xf6745aaa, 0x9d88e58b, 0x70001c7c, 0x6464ab99,
+    0xcd79463c, 0x46bfb46e, 0x48cdd3b4, 0xb8c7440b, 0xa74772d8, 0xe33101d0,
+    0x2f24bea8, 0x2aa9ba5d, 0xb951e7a8, 0x780b5b5d, 0x30d4f376, 0x80497899,
+    0xd72e4bbf, 0xdbcdd0dc, 0x5fa5d410, 0x0b94d1f3, 0xe7760292, 0x3290e51a,
+    0x609256e8, 0xfada8e54, 0x8c956993, 0xa9463a17, 0x10440cfe, 0x5c43d4a5,
+    0xab3b732e, 0x2202930b, 0x22a327ba, 0xe9b613d8, 0xc44d5fbe, 0xb30f6f56,
+    0x46a8757f, 0x4ff2285b, 0xfd4b99cb, 0x6ee2b98f, 0x7aa1f47c, 0x911c2741,
+    0x90b91964, 0xcf082ea8, 0x0347f9b0, 0x1c409190, 0x8735f646, 0x53c40b14,
+    0x1eda96c3, 0xa41fc025, 0xee485d91, 0xf02446c7, 0x6d8dfedb, 0x3c4599dd,
+    0xd845f0d9, 0x073b072d, 0x530f8024, 0xd68197a9, 0xb46737ca, 0x882c76c1,
+    0x38818c99, 0x76ff6f84, 0x8952ecfb, 0x38ec171b, 0x15ffd4ee, 0xf4295bb2,
+    0xe25e0b18, 0xa03fe19f, 0x642d7f4f, 0x56a3f275, 0xd0422d0d, 0x7367db36,
+    0x58a6964f, 0x8da1f38d, 0xbf1d68f5, 0xd2837247, 0x344673bc, 0x02bdb3ca,
+    0xa0de3a29, 0x4a86c294, 0x2a54f709, 0xb58abee5, 0xcaededba, 0xecd42fae,
+    0x4f4a66a4, 0x255c474f, 0xf2e85406, 0x1bd681d3, 0x7556783d, 0xcb304799,
+    0x9dbbfbf7, 0x9742f7d7, 0x0ddeec6a, 0x6b5516bf, 0xb18f1faa, 0x0ffa0066,
+    0x3c120c2d, 0xdf530b52, 0xde5e6e96, 0x8413c704, 0x54cefc2a, 0x7e41ab27,
+    0xe9992700, 0x586d0c36, 0x696cbd8c, 0xaf441792, 0x8226e8c8, 0xfc12d32f,
+    0x1b2d94b9, 0x3703e37f, 0x942b1889, 0x62ab0761, 0x0609d192, 0x9acb0797,
+    0xf89d91e9, 0xc0817a3c, 0x7dccb814, 0x105e6a98, 0xc111fd70, 0x2cb44788,
+    0x403c4bb7, 0xe5cba8cb, 0xaef834cf, 0xbc5455c6, 0x26db61e7, 0x426a3a44,
+    0x8144d9c8, 0x01868a16, 0x18e7091c, 0xd0664dd2, 0xeb7e80b5, 0x8f137473,
+    0x6a1ecccd, 0x70158d35, 0xdd52e3f5, 0x54efdaed, 0x5740851b, 0xa278b85c,
+    0xb2244617, 0xf690e94f, 0x3fce2a89, 0x3a22f2a3, 0xacf02d67, 0x682c1c9e,
+    0x2514cb07, 0x9483e586, 0xc262e04a, 0xc8d27f05, 0x433266e4, 0x18ba7cc2,
+    0xfaa570ff, 0x26e5e8f9, 0x7e9811a9, 0xef42d906, 0x965cd3e6, 0xb671529d,
+    0x04c73b3d, 0x49b5a2aa, 0xbdc3a318, 0x3559a101, 0x3733303b, 0xff192e34,
+    0xd2347aa2, 0xac14789d, 0x5a074e9b, 0x5b922d3a, 0xe1fd31fc, 0x7cfea157,
+    0x67ca4d6e, 0x87bf1b84, 0x8bfa32e2, 0xdc7644c9, 0x16bd4730, 0x0da5d374,
+    0x9f3ff2c2, 0x411d52a5, 0x0f3679d5, 0xbf1ebf1e, 0xf0aecfc8, 0xe62b5a1c,
+    0x776dbf5a, 0x2facdc95, 0xc9068369, 0x13e0a37b, 0x4c0fcc16, 0xc3a6565e,
+    0xa2c9bab7, 0x99897078, 0x284f6099, 0x617ea9a6, 0x92faee08, 0x2848276c,
+    0x0015bf23, 0xe02bc79b, 0xfeaaa8d9, 0xbbff804b, 0x799ef80b, 0x441a321f,
+    0xc70321df, 0x678d9fb6, 0x443ba5c2, 0x9e62c925, 0xa85267d8, 0xc4939aed,
+    0x21c7d1fe, 0x152f4cbc, 0xb6da86ce, 0x5e9463a3, 0x3b7323c5, 0xab17e1cd,
+    0xdadb80a0, 0xf879b652, 0x50c7098d, 0x31745b70, 0xedf268fb, 0x08b34fda,
+    0x6e907890, 0xd89ab0bd, 0x8437d728, 0x82c64ef8, 0x1d076055, 0x7bb89cde,
+    0xa467af25, 0x1ecbfd9d, 0x2dedb729, 0xcd0be7de, 0xcf44fb36, 0x937cf899,
+    0x4adc848a, 0x6dd348f0, 0xf422cb34, 0x4d22bad1, 0x73809627, 0xb1d46d2e,
+    0x9b4ebe51, 0xea25b14f, 0x0966772d, 0x20bb1abc, 0x8f8df880, 0x750cb617,
+    0x1339c44c, 0x8b178671, 0xe50551a2, 0xd5b4d9b4, 0x621bda9c, 0x04127c2d,
+    0xd58d31a7, 0x3f0845f7, 0x5c9dd185, 0xf3f8f27a, 0xba9da59b, 0xa7a2abd2,
+    0x323a3f6a, 0x510d5d48, 0x9ea477e0, 0x06d5ed3c, 0x0ec1f0ea, 0xd73eaa46,
+    0xf1a32400, 0x89be60e2, 0x764e5deb, 0x77345e4f, 0xc8591b06, 0x520f3a4a,
+    0x4d8f8124, 0xa54fb5fb, 0xa3889edb, 0xf1b5d1a3, 0x291af5ba, 0x3dcfb84a,
+    0xbcbcbefb, 0x6ff9f3d1, 0x36e786a7, 0x9007a8ed, 0xd3eb2951, 0xce512e7e,
+    0x5b9e7037, 0x1d562859, 0xe05de753, 0x2322b1c2, 0x66c073bb, 0xe8c0a7a9,
+    0x8a232ce0, 0xb2451270, 0x17125573, 0x4e8cd381, 0xad81f988, 0x337c3fae,
+    0x247c8300, 0xfb20c071, 0xc3815283, 0xa884ec83, 0x42cf9515, 0x5d81a4ff,
+    0xfb434d49, 0x794ba5de, 0x7f8e9220, 0x813da539, 0x972f9fb4, 0xdafcf819,
+    0x052212d9, 0x0adf49f8, 0x80d5ea3e, 0x4744b44d, 0x19a424ec, 0xb92187b1,
+    0xeaa92ac0, 0xe2f99fe9, 0x6b277562, 0x2be0ed28, 0xdc396190, 0x172aae4e,
+    0x56a40092, 0xc7f61271, 0xb371a358, 0x9cc213b0, 0x3e931d79, 0x65436960,
+    0x8e003d71, 0x2d859e71, 0x1248a9f0, 0xe4f98f9c, 0xe420853f, 0xbdf52a2a,
+    0x63933c6f, 0x43bd2ab0, 0xd4890f9d, 0x63556e8c, 0x5d06f7ed, 0x9b591acb,
+    0xbbd14343, 0xc1ab71fb, 0x3342dccc, 0x11fea169, 0xa5acd19a, 0x59213d30,
+    0x2cdbcc9e, 0xaeed28d3, 0xceed32ea, 0xfd9534fa, 0x4b6fc634, 0x36507839,
+    0xf59320e1, 0x0e17401d, 0x72dc466f, 0xde628598, 0x9a942dc8, 0x85f68aba,
+    0x08d3775e, 0x7fdb7a1d, 0xb7a7bbad, 0x1aa7daa3, 0x3a0cff0e, 0xcaf954c3,
+    0xdb34bece, 0x966bd1c3, 0x51344eae, 0x6aadbe5d, 0xec2cffc5, 0x4b8a231d,
+    0x6f1188c6, 0xb4be4e31, 0x856e4dcf, 0xedacddfd, 0x1c6e442e, 0x246d0df9,
+    0x93b6f6ce, 0x729f6195, 0x012760de, 0x8c926ead, 0xff1a6f1e, 0xd30107ac,
+    0x78a2c87c, 0x039f00d9, 0xc69150dc, 0x399e6672, 0x45d9aef7, 0xf5d8909e,
+    0xa9705a1e, 0xa14b2e03, 0x2011dc46, 0x57643a67, 0x86f6a1a9, 0x12bae176,
+    0x1f4879c5, 0xc22cd085, 0xef360198, 0x98e2293b, 0x6c5d6acd, 0x60bc151c,
+    0xd9c9f50c, 0x406fb5bc, 0x52db06c1, 0xbe778e50, 0xb5fc12f2, 0xe76b240f,
+    0x39ffedb2, 0x2e3eb8aa, 0xaa23658d, 0x7d868060, 0x23501a6f, 0x869b10ad,
+    0xc559aad3, 0xdd0427b0, 0x479fc7b8, 0x0cd5a101, 0xfc6068dc, 0x34498d0f,
+    0x7babd299, 0xfe59685d, 0x9112856c, 0xadc3a4be, 0x024c16c0, 0x5a4dcd2d,
+    0xb8088a16, 0x273fd688, 0x31f6967c, 0xeeeec4b2, 0xd61738c1, 0xb707a765,
+    0x5eca5338, 0x48d40254, 0xe63dcf27, 0x69b10b4f, 0x61acfec9, 0x95eefad9,
+    0x8d26ec3d, 0xc9ef6cf0, 0x11cb18d7, 0x19acf514, 0x99eb6120, 0x55c3643b,
+    0x0add0143, 0xa396d105, 0xf73ad1a9, 0xf72074c5, 0x713f2b40, 0x3b7f5f95,
+    0xccd3471f, 0x0002bc72, 0x491f3712, 0xd1915990, 0xa60d10f7, 0x8ef5ba2d,
+    0x2edde115, 0x716e5555, 0x95adc0f0, 0x3ec294db, 0x07852b2d, 0xf275df94,
+    0xf93899d6, 0xa6724117, 0x7cffd026, 0x50b944d5, 0xc0f687cd, 0x741b0f88,
+    0x4107379d, 0x8ae8a1bc, 0xaf6f0f76, 0xd446e953, 0x27f3bc3d, 0x0515c941,
+    0xb0ab0e72, 0x4c132b9f, 0x3df2aa18, 0xb095fa24, 0xdf8c84a1, 0xeb32f718,
+    0x5541e600, 0x21034a46, 0xe855851d, 0x1f310de3, 0x68d85564, 0xcc0fb939,
+    0x83f12fc4, 0x923c7d54, 0x1a8066be, 0x6cb99696, 0xa1d80c9f, 0x097a1143,
+    0x2b63d3a8, 0xd9346b97, 0xcb295265, 0x835527f8, 0x4ed9e699, 0x7acf38da,
+    0xf315bf8c, 0x5f7c784b, 0x749e9612, 0xaace9e9a, 0x9c1bb59d, 0xf9c0da02,
+    0x0c7b12fc, 0x30a6deb1, 0x887076e7, 0x66f38a73, 0x1409142d, 0x9fe3403f,
+    0xe3366cec, 0xc5ec3fc1, 0x658d2edf, 0x14bab10e, 0xd1c4c916, 0x29eaaeb1,
+    0x59df9033, 0xe173fbf4, 0xbef2b599, 0xba8bca46, 0x357d7db5, 0x4595e764,
+    0x900570b2, 0x1ce193b8, 0x03d3f58e, 0xcf9383d8, 0xfdd6e934, 0x91b16287,
+    0x7a387990, 0x6e065338, 0xc4a39cd4, 0x4f0bea7d, 0x46773677, 0xb3e32879,
+    0xabeabdcf, 0xe966a98d, 0x22357b5d, 0x22a0457e, 0xb484dbf0, 0x766e8798,
+    0x382f526d, 0x88aac2f6, 0xd8c0d997, 0xd60f5090, 0x5397a04c, 0x07a1fb16,
+    0xeea569f3, 0x3cf04881, 0x6d561a73, 0xf09e7cbe, 0x87e94dbe, 0xa4d2fe1c,
+    0x1e0b90cb, 0x5320248a, 0xa79a2c70, 0x2a3532c7, 0x2fb78fb8, 0xe3a0ca14,
+    0xcde7e248, 0xb81ec55e, 0x48103263, 0x467d7289, 0xf688e8a0, 0x64f6ee9e,
+    0x70e932ee, 0x9d76297f, 0x984bdf58, 0xc6fc429a, 0x0ba69896, 0x16193c44,
+    0x8c3aeb11, 0x5c99f533, 0x10f4d317, 0xa9f8b898, 0xe7e97785, 0xfa1ac556,
+    0x6031b152, 0x3224c3a2, 0xd799a51c, 0x0b2e93ee, 0x5f777437, 0xdb104e8d,
+    0xb9eec094, 0x80c2b3a2, 0x307c2f97, 0x78d0899d, 0x82a75bdd, 0x3790185c,
+    0x1bdb0355, 0xfcd1b60c, 0xe926b669, 0xaf99debe, 0x69f39dd0, 0x5882f367,
+    0xdeb49cf2, 0x7ec8723f, 0x54702df9, 0x84a7e6a7, 0xb164ad23, 0xdfb9e20d,
+    0x3cb8267c, 0x0f40222b, 0xae6daf0c, 0x42fd36f7, 0x26620986, 0xbcb210cb,
+    0xc1c04cef, 0xe5466882, 0x40bfc32c, 0x2c133015, 0xf834b420, 0x10d5109a,
+    0x7d6c04de, 0xc02c46bb, 0x949cbe64, 0x9a0ca4c5, 0x069b0984, 0x620edaa0,
+    0xbff6ad2e, 0x027210dc, 0x349f44f9, 0xd2010c64, 0xd099c89c, 0x8d6200e8,
+    0x580b1ca4, 0x739f807a, 0xe2a23977, 0x560f7ea5, 0x64c315fd, 0xa08fd45c,
+    0x89a2e7fc, 0xf4946061, 0x15164fef, 0x3840b386, 0x9d5fffc6, 0x6bc98acc,
+    0x0d19c1fe, 0x9796ee39, 0xf235e4f2, 0xcbbec26b, 0x759b40b6, 0x1b2bfdea,
+    0xca7e9f2c, 0x25a11ee7, 0x4fd5951e, 0xec4f5b21, 0xa02a53d7, 0xb53e6e55,
+    0x2af2f6fd, 0x4a1f321e, 0x8b5f3563, 0x0d66755f, 0x16063aaa, 0xdca25922,
+    0xe157386e, 0x87462a9e, 0x67449746, 0x7c76b3b1, 0xd2dab7fb, 0x5b68979c,
+    0x5abb8588, 0xaca57a5e, 0xbd33184b, 0xffe4cc9a, 0x37f57a7e, 0x35cd0846,
+    0xa269434c, 0x61e0526e, 0x28d8c476, 0x994e988a, 0xc9a382df, 0xc36c76ea,
+    0x4ca243ef, 0x130fce9d, 0xf0781e30, 0x2f036ab8, 0x77c83407, 0xe6a0585e,
+    0x9f85f6e6, 0xbfb3127a, 0x0fa4f251, 0x41ca7926, 0xb2e245c1, 0x3aabe9ef,
+    0x3f573feb, 0xf61d5f26, 0xddf05a26, 0xa2f7ddd6, 0x57e72fe8, 0x540e23e3,
+    0xebae2ad5, 0x70d7e68e, 0x6a9b2669, 0x8f8624da, 0x81ccc7b9, 0xd0d2e648,
+    0x18294735, 0x01179a93, 0x96a79f21, 0x49458977, 0x0457013d, 0xb6a07771,
+    0xfa51562b, 0xefd7a651, 0x7e5aafb8, 0x2624ce2c, 0xc2a25cef, 0x1832f3c3,
+    0x43aa07d0, 0xc85ea93f, 0xac18bc07, 0x9465ce9f, 0x25eac5d4, 0x68b1d1bb,
+    0x9be54cd0, 0x20560040, 0x09e187c3, 0xeae56428, 0xf482230d, 0xb143448f,
+    0x735ec3dc, 0x4de50bcb, 0xcf854457, 0x6d511273, 0x4a0205c0, 0x93b9edcf,
+    0xa4e3bc94, 0xcdee8cd6, 0x2d00ff97, 0x1e44fcc7, 0xba1bdcf3, 0x51d9e7ef,
+    0x328791d0, 0xa71fe006, 0xd520baaf, 0xf336fe5a, 0x5c02ffc3, 0x3fc9070f,
+    0xe5ed7df2, 0x04b02425, 0x62803049, 0xd528f3f1, 0x8f731971, 0x8bf2f8ab,
+    0x138dfdbf, 0x758f9cd2, 0xa8c9824a, 0x15cd5c56, 0x21056f44, 0xc42e3ccf,
+    0xc78e3af4, 0x9eb2145b, 0x44f10519, 0x6703069c, 0xfe2c6d7f, 0x44a1006b,
+    0x79519026, 0xbb7eb583, 0x92398be9, 0xe0eac711, 0x00cf6609, 0x28ce8327,
+    0x84fba47f, 0x7b45a892, 0x1da0c968, 0x826a7402, 0xed50b7c3, 0xd86bc0f6,
+    0x6e239bb5, 0x08433e41, 0xda6f70d5, 0x31915b61, 0x5035ffb2, 0xf8da17ef,
+    0xb64b9167, 0xabf746f4, 0x3ba2fa9a, 0x5e5f80e1, 0x935e13cf, 0x03f70c12,
+    0x01eddfb6, 0xd35fd35a, 0xffb4359f, 0x8ccad15f, 0x783b31e4, 0x72e1aebb,
+    0xc645f255, 0x5719b742, 0x4519fa44, 0xa1177992, 0xa9872a0c, 0xf59c8ac6,
+    0x20f24f7d, 0x39e967cd, 0xb76641a4, 0x6aec62ae, 0x3ab60e65, 0x9620bab4,
+    0xdbb26f79, 0xcaac26d1, 0x51e48f4c, 0x1afe0c0f, 0xec8eb24a, 0x242a2690,
+    0x6fed2a44, 0xede8ff51, 0x85df7bf7, 0xb4d861bf, 0x1cec7400, 0x4bf20db0,
+    0xa55c984e, 0x361f61fc, 0x2c7460f5, 0xfde19355, 0xce41ea5d, 0xaebd914c,
+    0x4bb0f0be, 0x597a8b1f, 0xf5140839, 0x7f9230d0, 0x7240bdac, 0x85a04180,
+    0x9a65e92b, 0xde2f06ee, 0x08421232, 0x0e44589f, 0x8ec8324d, 0x43f25a94,
+    0x12dbc6c3, 0xbdb0dc2d, 0xe4e37e1f, 0xe48680aa, 0x63061694, 0x2dc0edda,
+    0xd41be755, 0x11b1ed44, 0x5d98cfc4, 0xc1ca3ccd, 0xbb646b33, 0x9b3bac3c,
+    0x33913e26, 0x6335d4cc, 0x803de2f0, 0x2b921239, 0x1925ed5a, 0xe28f1cf9,
+    0xea77f65d, 0xb94860ac, 0x6b90de84, 0x470d3119, 0xdc913677, 0x65243ea6,
+    0x563b2e60, 0x9c9b339d, 0xb3d478b1, 0xc783dbd5, 0x3e4872e0, 0x1772f54c,
+    0xad1d8ffd, 0x5de6a933, 0x24f2f8d8, 0xa8fbd4cb, 0xc30a9d1c, 0xfb790fec,
+    0x426ddf53, 0x3311bece, 0xfbe0a727, 0x0ab87435, 0x7f0ffe4b, 0xda8b9123,
+    0x97ce3325, 0x81557740, 0x05f3e77d, 0x793a2b6b, 0xbc5033e2, 0x1d16e86f,
+    0x364740e4, 0xce28cb04, 0xd3297676, 0x90457362, 0x5b798f3a, 0x6fac932e,
+    0xe0d183a8, 0x4ec6d258, 0x66624d80, 0xb23c2f51, 0x8a90e6d1, 0xe8ae5cb6,
+    0x17b6dfdf, 0x2379ed8c, 0x9e6d2947, 0x776fbc74, 0x0e57e232, 0x89f0d096,
+    0xf11072e5, 0xd778ae9e, 0x76bd2e5c, 0x06be0e82, 0xc8f5f942, 0x3d97a1ba,
+    0x4d5ec292, 0xf1d63a49, 0xa36edc0e, 0xa53cd7af, 0x29945675, 0x525729a8,
+    0x88d5cb76, 0x14e5d016, 0x148b0a9e, 0xc58d3621, 0xe3eebae6, 0x9f88fb42,
+    0x657f0f5a, 0x6688134c, 0xd16d865f, 0x45f28b49, 0x5932b7c6, 0xbae6389d,
+    0xbe06dbee, 0xe126e3ca, 0x35ce1679, 0x29bec02c, 0xa1137f10, 0x7ab06d50,
+    0x2be73e71, 0x83047207, 0xcbee6533, 0xd9727cf0, 0x4e234309, 0x0907f69d,
+    0xf3b917c9, 0x30da5e4f, 0x741b82d0, 0xf9942646, 0x9cc9a5b6, 0xaa981f21,
+    0x0c85f114, 0x5f2ac0cf, 0xb00a914e, 0x217f6ee5, 0x3d0db7e8, 0xeb5032b2,
+    0xdf14cde6, 0xb0ddfde0, 0x55d98de3, 0x4c496938, 0xe8a18bb7, 0x6cc975b3,
+    0x6867083e, 0x92719b3d, 0x8353c043, 0xcc4a892b, 0x1a66d5d6, 0x1f6c649c,
+    0x9515eab8, 0x50dbf277, 0x0711af21, 0xa60bf2c9, 0xf9e4e31b, 0xf227fdc8,
+    0x7c39bb60, 0x3ead98f7, 0xc027d748, 0x057a532d, 0x41bcb6d8, 0xd42448af,
+    0xafab6d5b, 0x8a9d3a98, 0x2761fd8a, 0x745c1074, 0x990bb36c, 0x3b3c7b47,
+    0x0a40b7ae, 0xf74e0be1, 0xf7b2d265, 0xa3e6cfe4, 0x71d09d48, 0x55b52afd,
+    0xcc3fccc4, 0x712e118d, 0x4988d2df, 0x8ea48aeb, 0xa6b8e339, 0xd1eaa7b7,
+    0x2e114cf9, 0x0047ee59, 0xb8c74fa9, 0x489a9930, 0x313042a8, 0xb7617d8f,
+    0xd6944106, 0xeea5e2a0, 0x5e722e09, 0x27453efb, 0xe6c42b99, 0x19f60852,
+    0x615dc0b9, 0xc9880533, 0x8d877591, 0x9597c821, 0x113e9c52, 0x69c53d0f,
+    0xaa93a30d, 0x0ca0b975, 0x23e23598, 0xdd6d773e, 0xc59f761f, 0x86eeefb6,
+    0x4702a404, 0x7de5462a, 0xfca3913a, 0x5a085e9a, 0x7b1f8999, 0xadb5ffc5,
+    0x91e687a7, 0xfe25dd60, 0x02a1e285, 0x3410c1e9, 0x862448a8, 0x60ea55f6,
+    0x1f8d49d8, 0x98a20aaf, 0xefd3c222, 0xc27a3497, 0x6cef17b6, 0x12cdc561,
+    0xd9204ba2, 0x2e5cf194, 0x52076c47, 0xe72dd5fb, 0xb532fc7d, 0xbe3042a8,
+    0x390a90fd, 0x4010cb15, 0x9dcf93b7, 0x1b51b7c0, 0x0da54c26, 0xcbd034f2,
+    0xf2a2ad92, 0x97c2620e, 0x7529c660, 0x6b8e5529, 0xca80a2eb, 0x4a7fdb6e,
+    0x4f39946c, 0xb5487d85, 0xa0847f27, 0xec1456d4, 0x2a2ebd13, 0x25d60bdb,
+    0xbf7117d5, 0x73ee3f63, 0x342802b9, 0x8d1f54e7, 0xd0343563, 0xd250957e,
+    0x58d6351c, 0x02129701, 0xe225577c, 0x380b11cf, 0x64502ee3, 0xf4c82034,
+    0x8915602e, 0xa0dec4f5, 0x15b026d4, 0x567e44b8, 0xae98af76, 0x2c4803af,
+    0x2695601f, 0xe52dd655, 0xc16c7589, 0xbcef95fa, 0x40462672, 0x42aa45f8,
+    0xf8feb199, 0x624757d7, 0x7da5d339, 0x9a55c30e, 0x9457162a, 0xc06b206b,
+    0x065f85e7, 0x10b3748f, 0x82768d9f, 0x58ca1f51, 0x1b6256f5, 0xafee83b7,
+    0xe9d61554, 0xfc911bbb, 0x69128bec, 0x37db2d02, 0xde3e2d21, 0x0f259179,
+    0x548a94bb, 0xdfd50141, 0xb1e0e16c, 0x84e15398, 0x3c7f1a7a, 0x7ea07a68,
+    0x8cfba96e, 0x32718f21, 0x10271641, 0xfa40e168, 0xe71b50d0, 0xa99657dd,
+    0x60ca7c69, 0x5cfd645a, 0xd74ae06c, 0x78983a48, 0x5fd67f0d, 0x80b68874,
+    0xb92a8d68, 0xdb7e1346, 0x308b8cd8, 0x0b7ea8be, 0xa73f8162, 0x460e47f2,
+    0x2f4e3482, 0xb8639d2b, 0xcd05622e, 0xe3d12e44, 0x48ac5ded, 0x2a7773ec,
+    0xf63a2930, 0x164919c8, 0x707151c0, 0xc6a665ce, 0x98d62aa3, 0x9d22a899,
+    0x0b79bc65, 0x64b338ca, 0xb42a4d71, 0x07d18f3e, 0x38cbd10a, 0xd65b6a87,
+    0xd81676fd, 0x88f7f305, 0x53557f6e, 0x7619ff98, 0xee2c0397, 0x5371d30c,
+    0x6df0239a, 0xa4a5be3e, 0x877169cd, 0xf0cf3e64, 0x1ebbefb2, 0x3ca2a579,
+    0x90eeba2a, 0x6e63ff73, 0x0316609d, 0x91e9c539, 0xfd3e4a3d, 0xcfe5803e,
+    0x7ad06407, 0x1cb12fa9, 0xc4351f60, 0x22f63a35, 0x46f1c09f, 0xe92c3b03,
+    0xab6c377b, 0xb382d81f, 0x22deadea, 0x4f7b361c, 0x847f0ee9, 0x08029c94,
+    0x1d7477a8, 0xd83ac590, 0xeda2b3b0, 0x823e4576, 0x6eece4ae, 0x7b3b441f,
+    0xdaabbffa, 0x5e002136, 0x5095a7bd, 0xabbaeaed, 0xb69e21bf, 0xf89f1950,
+    0x3b1ada0f, 0x31c806d6, 0xa8327cbd, 0x675be801, 0x21b34afc, 0x9ec94640,
+    0xc74fc6b4, 0xc46b39cb, 0x447df7bd, 0x15a97476, 0xfef3a36a, 0x28aca7e8,
+    0x79dd5c96, 0xe09182bd, 0x92bd44d1, 0xbb2c2e9f, 0x0043ff7a, 0x44c0f226,
+    0xbad112e7, 0x3faf1298, 0x324915bb, 0xf3796979, 0xd5f092ea, 0xa7400212,
+    0x5cdf4570, 0x519b16c2, 0xe56d1275, 0x75ef6fbb, 0x62613f39, 0x8ba2e6ef,
+    0x8fe07857, 0xd57bed29, 0x1361bba1, 0x04dddcd8, 0x9b2f010e, 0x4d9a3f27,
+    0x093b7a29, 0xb1355096, 0xf47af2fb, 0xea8b66b0, 0x73e28f55, 0x202d80f7,
+    0xcf084c3a, 0x1e1b9cf0, 0x4aa1190e, 0xcd8016c2, 0xa42369ff, 0x93c0412e,
+    0x2da29560, 0x6d3c8574, 0x9639f23e, 0x267b4e72, 0x04adf5e0, 0xefb448e8,
+    0xfaed4833, 0xb6ecc69c, 0x7effeb73, 0x490e1451, 0xc226dacb, 0x68cf4843,
+    0x437dad1d, 0x941d275f, 0xaca94fb2, 0xc808cce6, 0x254d8bcc, 0x1866dbdc,
+    0xb251bd2c, 0x5452d837, 0x3f8685ad, 0xa28530b7, 0xdd315957, 0xf6721f01,
+    0x57108a0e, 0x3af37e28, 0xeb2ca1be, 0x0164ca98, 0x6a6d40ea, 0xd098ce1e,
+    0x8111ccf4, 0x8ff2d37e, 0x18892de9, 0x70912489, 0xa2879608, 0x134cb689,
+    0x28384cb0, 0xc312e139, 0xc95d1500, 0x990021f8, 0x4c6ea8ba, 0x618282a2,
+    0xf0e77b12, 0x41a41042, 0x770dd7d8, 0xbfe54c30, 0x9f618957, 0xe6c5d3f7,
+    0x0f423390, 0x2f4e3607, 0x8b8151ca, 0x7c0b2942, 0x16c1ebd6, 0x871ff81b,
+    0xe18ac91f, 0xdcd500c9, 0x67a6f2e8, 0x0d34fd40, 0xd24d6758, 0x35978504,
+    0x5a4f84ca, 0xffa1c860, 0xbd911bed, 0xacf94db3, 0x376c46b0, 0x5b2f913a,
+    0x9ac02e06, 0x0e9c3c7e, 0x0892451a, 0xdeb5293f, 0xf5fa1953, 0x8529682d,
+    0x728a0c24, 0x7f1c59ab, 0xcea658c9, 0x59b4fb33, 0x4b21cd28, 0xae0ec57a,
+    0xa5fda853, 0xfd692489, 0x2c97eb5e, 0x368e0f5d, 0xbb996b74, 0x63c907ba,
+    0x33264f71, 0x9bdb8d7e, 0xd4ec233c, 0xc17cf423, 0x5d61e8d6, 0x117cd7d8,
+    0xe4419814, 0x2d10293f, 0x63f75b7f, 0xe4359511, 0x8e46ec1c, 0xbd5a7ff8,
+    0x122b5730, 0x4304862b, 0xa9319fcf, 0x392fd65f, 0x2050507a, 0xf50e1b78,
+    0xc6dc22bb, 0xa18a2346, 0x45946f19, 0x578d5fed, 0xff4ebf6d, 0x7236d137,
+    0x78f27ed7, 0x8c5de93d, 0x93f46d12, 0xd3e6445d, 0x017cca45, 0x032339b2,
+    0x85210ff0, 0x4b4da332, 0x1c35f6ed, 0xb446788f, 0xec73b35a, 0xed25b7e0,
+    0x6f55f1f0, 0x24d354c8, 0xdb483dce, 0x1a57e15c, 0x5175c8bb, 0xca24f685,
+    0xb7e1b52b, 0x96b26d8b, 0x3a764202, 0x6a675da8, 0x8a66a1a7, 0x239ae068,
+    0x1778fe05, 0xe822c4bc, 0xe031294c, 0xb2d8de1a, 0x6682e527, 0x4e2aa0ef,
+    0xd398b92b, 0x6f7d70f6, 0x5bd830e2, 0x909e8849, 0xbcd304be, 0xceef5c5f,
+    0x369344cd, 0x1d9efd26, 0xa3d5af4c, 0x52e7d38c, 0x295235c7, 0xa5cb2f1a,
+    0xc83eca23, 0xf10b9095, 0x4de7be86, 0x3d40cf2a, 0xf1f3bb27, 0x06593145,
+    0x760dd6ac, 0xd7c17eeb, 0x9ef6be0b, 0x896150fa, 0x0ebff281, 0x77c121f5,
+    0xb32f83a6, 0x17a43ea9, 0x3eff4ff4, 0xc750556b, 0xdc712ed4, 0x9c6944fa,
+    0x56f1cbe1, 0x65a2b8a4, 0xeafbf63f, 0x47f28c59, 0x6b766e42, 0xb98f7cec,
+    0x80ada358, 0xe22f5564, 0x19ed10f2, 0x2b66bf20, 0x97485838, 0x79e3f153,
+    0x056530ad, 0x81a445df, 0xfb11ffd3, 0xda090773, 0x7fe41b18, 0x0a0ea31b,
+    0xc3d4cd43, 0x3395c056, 0x42bb8e67, 0xfbf5707a, 0xadc4e3b1, 0xa8269b8b,
+    0x2432005a, 0x5d56cddd, 0x83823097, 0x1ff7f9be, 0x1affa707, 0xccc2945c,
+    0xe82f8ccf, 0x9288bd31, 0x68b257f4, 0x6c5bcf8d, 0xdfef3a10, 0x4caac654,
+    0x550f0773, 0xb07f3954, 0xb0ff167e, 0xebba55b9, 0x3d9f6458, 0x21a990df,
+    0xaf37bd13, 0x74afe165, 0x27ad0852, 0x8a404ce5, 0xc0b5d439, 0xd48f98a5,
+    0x415b4cd1, 0x05882ab1, 0xf9680273, 0x3e3b89da, 0x7c8df4f8, 0xf2d74204,
+    0x95ebfe6c, 0xa6d48d87, 0x07f791c6, 0x5003c248, 0xbea7994e, 0x2979c25c,
+    0x3513dfbd, 0xe187f7c6, 0xd18ea189, 0xba35ca9f, 0x59a0a325, 0x4539d499,
+    0xe36ef5a1, 0x6624820a, 0x65ff8e51, 0x9f2afaed, 0x8811a7d5, 0xc541dfce,
+    0x14498e35, 0x146ba3a8, 0x9c448236, 0x5fad6151, 0x0c216dda, 0xaa6aafd5,
+    0xf35bdc91, 0xf970bc20, 0x74edcb22, 0x306e120c, 0xcb50b913, 0x0990ad08,
+    0x4eacc563, 0xd9c98ee1, 0xa1bc8306, 0x83d56f08, 0x2b002023, 0x7a07aeba,
+    0x9149b5ad, 0x34bd477b, 0x020b4fc9, 0xfebfe757, 0xfc1a3616, 0xad5a0d29,
+    0x7bfeb0bb, 0x5a93c117, 0xc53b3578, 0x7d34ca42, 0x47cea816, 0x864d15c8,
+    0xaa763b2f, 0xdda16fb6, 0x2336a050, 0x0c2f832b, 0xb59247cf, 0x40bb44f3,
+    0x39a336fe, 0xbea08ae3, 0xd98bc4be, 0xe7ed1763, 0x52a92823, 0x2ee863b6,
+    0xef5ff22f, 0x12112d66, 0x6c125661, 0xc2d74a90, 0x86879ceb, 0x98562340,
+    0x1f004da8, 0x6006b1bb, 0xa6656b60, 0x00a9c9e0, 0x2eb99b20, 0xd12d3754,
+    0xccb44f04, 0x8e7c5d6b, 0x49511040, 0x71cbc66f, 0xf7580104, 0x5578324a,
+    0x714e053f, 0xa353f2d9, 0x99bf1d82, 0xf7a5168a, 0x0aaf6407, 0x3bf84be5,
+    0x8d409a66, 0x6928d0ac, 0x118b566f, 0x951f7902, 0xe67ab06f, 0xc94877be,
+    0x61c2cb53, 0x194cbe1a, 0xd67c133e, 0x27a71715, 0x5e9f0788, 0xee3d169a,
+    0xb847b47f, 0xb7c2e8d4, 0x319986b7, 0x4865085e, 0x94e424fa, 0x10091504,
+    0x06fd760f, 0xc0d81cbf, 0xf86ba026, 0x9abae44d, 0x7d088a76, 0x62ca54ef,
+    0xc1b184ff, 0x421ffde1, 0x40ebaab6, 0xbc14a847, 0xae1203e6, 0xe59b25e7,
+    0x260b11e4, 0x2cc8d837, 0xb1290ea5, 0x7e207414, 0x3ccba2e0, 0x846204fd,
+    0xded28cbf, 0xdf34387c, 0x5416bdba, 0x0f8b9ee3, 0xe9633ce8, 0x37652674,
+    0x69a1ed4f, 0xfc4fd928, 0x82fec13a, 0xaf38a925, 0x1bb4f824, 0x58015546,
+    0xa06d6ab2, 0x250f02fd, 0x2aa7443e, 0xec9c45f4, 0xca31ce63, 0xb5e667b2,
+    0x4f9bc6c9, 0x4af93c2a, 0xf25d1ca9, 0x6b3bfbc7, 0x75e9caf6, 0x971e3fd9,
+    0x9d2392d4, 0xcb5ab46d, 0x0d42d6fa, 0x1ba88a66, 0x89cf0ea2, 0x56fac489,
+    0x15644ae4, 0xa06506fc, 0xe2fa41c2, 0xf47961fd, 0x649f8283, 0x3890a801,
+    0xd0e6596e, 0x02d00093, 0x585e463d, 0xd2e3d988, 0xbfbba55f, 0x8de9eece,
+    0x34ea43d4, 0x733a2952, 0x878b65dc, 0x3c19db79, 0x1e6cde3b, 0xf0547ec4,
+    0xeee8689f, 0xa47cbda4, 0x6d1e4c57, 0x5392bb2f, 0xd89c0b1d, 0x76a79234,
+    0x53cf1d3e, 0x88789ba8, 0xb4fccacc, 0xd6ed90dd, 0x385e7c07, 0x0760266b,
+    0xaba98ebd, 0x4fa21431, 0x226833ed, 0xb37d03b9, 0xc4e666cb, 0xe9e4ab89,
+    0x462d6f26, 0x22709d41, 0xfd9ce2f2, 0x1c22824b, 0x7a72c1f1, 0xcf573e3a,
+    0x90462e4e, 0x915db27b, 0x03a68ca4, 0x6e8e0162, 0xb9a67e54, 0x0bc9c678,
+    0x303f180f, 0xdb8d5b7f, 0xd7dd57b0, 0x80041346, 0x5f3879ff, 0x785e24e9,
+    0xe7915ee6, 0x5c3e8b87, 0x604fb89c, 0xa92162b0, 0x8c4deb9b, 0xfa9495ca,
+    0x10be9e73, 0x32ef7050, 0x9816fea4, 0x642d15fb, 0x0bfe596b, 0x9ddc12e8,
+    0xf6f1217c, 0xc6050a1f, 0x70b6d60d, 0x16b6c308, 0xcda4c914, 0x2ae035f0,
+    0x484b0b8a, 0xe37d5ee4, 0xa7d5ce36, 0xb8b72517, 0x2ff388e4, 0x46fe067a,
+    0x8f324862, 0x04641581, 0x13cabf01, 0xd5cd8124, 0xe5a532be, 0x8b70ef0a,
+    0x62c37316, 0x755e7a9b, 0xd544de8a, 0x515a2040, 0x5c6ce2b4, 0xa7dd7c1b,
+    0xba6e5d35, 0xf3803614, 0x32c09e1f, 0x3f708a7e, 0xa4b3ded8, 0x6d800b89,
+    0x2d7aca26, 0x93325c2a, 0xcfe539e4, 0xcd66fd0e, 0x4a50b562, 0x1e9e77f8,
+    0xf4d332de, 0x20d986b8, 0x733ca734, 0xea71093a, 0x9b89d9b2, 0xb1a5f24d,
+    0x09a616e7, 0x4d5351a8, 0xb63b990e, 0x31034118, 0x3bd2d32e, 0xf826e70c,
+    0xda2815d1, 0xab4f4195, 0x506115c3, 0x5ee76cde, 0xed01c320, 0x7bf3d4b7,
+    0x6e5c48a8, 0x82a6054c, 0x8484afa8, 0xd8f2d263, 0x1df9b594, 0x08c70291,
+    0x926c2de7, 0x44425066, 0x0083dc43, 0xbb8217d2, 0xfe504934, 0xe06081fe,
+    0x79339a94, 0x283c5390, 0xc7cdba04, 0x154ec1d7, 0x44871d26, 0xc4f50e13,
+    0xa8b15a1d, 0x9e16d4d6, 0x2146c21d, 0x67d02574, 0x9fd89085, 0x2ff8069e,
+    0x0febaa33, 0xe642a622, 0xf03ca1a1, 0xbf6fdfa3, 0x779caac3, 0x415d5a56,
+    0xc9c5136c, 0x61293143, 0x4ce1f461, 0x99ff38de, 0xa2235fb4, 0xc3e7298b,
+    0x2881116b, 0x13bbc887, 0xbd523fda, 0x5be8b141, 0x3780d382, 0xac4eb35f,
+    0xd2926404, 0xff7ab3d6, 0x5ac9a0b6, 0x351d96bb, 0xe13aed02, 0x0df1ae84,
+    0x6731631f, 0xdc21b462, 0x8b2da6e1, 0x87efaf4b, 0x164bcca1, 0x7c99fbaa,
+    0xac468f4c, 0x18ca724d, 0x2591d359, 0xc8a52a3e, 0xc2ebff3f, 0x94d31980,
+    0x43f131b0, 0x685f97d7, 0xfa21d7db, 0x49d7fe6f, 0x7e20aef1, 0xb61b3fca,
+    0x96e47495, 0xef1720fd, 0x0417dd26, 0x26942219, 0x81b6957f, 0x70463a2e,
+    0x186ac6ed, 0x8f4961a7, 0xebc2526d, 0xd01eaaf2, 0x6aca45d7, 0x01eed38c,
+    0xdd83fd94, 0x3a5f440f, 0x579574c6, 0xf6d21991, 0xb281e3a5, 0xa211293d,
+    0x3f38f672, 0x548ae75e, 0xb1241f91, 0xf063dc4b, 0x4e014d81, 0x431bf73f,
+    0xdc1d4eb5, 0x3243d5df, 0x3d1975ab, 0x83ea92d2, 0xe6ed291c, 0xa8bc0838,
+    0x012e9868, 0x1922cb9c, 0x8b456658, 0x6eb5f6e6, 0x7b967ce1, 0xdee927d8,
+    0x997cdf8b, 0x94344fcf, 0x648c5411, 0x28984a8d, 0xf2e7121a, 0x58bf19f1,
+    0x14a1f6f1, 0xea6cfe81, 0xc93407cf, 0xcb56ddea, 0x2d9cfb7f, 0x77e84ba0,
+    0xa0731807, 0x07d3d76a, 0x5a550587, 0xbb623be8, 0x83162a54, 0xd08ca0cc,
+    0x7482b66e, 0x665dc53c, 0xeda89a72, 0x13e62851, 0x0c34a23b, 0xa5b5ef90,
+    0xd2e699d9, 0x8c765514, 0x35c87877, 0x3cd35bc5, 0xb9189335, 0x4f230b4f,
+    0x4779a9d4, 0xfcb14d56, 0xaf5f5531, 0xb5e30b8f, 0x524d0a17, 0x0e318089,
+    0xc6259f91, 0x79a8531b, 0x21eb0521, 0xc3dc02a7, 0xfddb4078, 0xe2d531f5,
+    0x1a3b5a81, 0x5297a837, 0x902f670b, 0x22113139, 0x6a6a18b3, 0x9d58a6c9,
+    0xa5823037, 0xc4f6800d, 0x5de5acfe, 0x7e7f0353, 0xce95f1b1, 0x0807e3af,
+    0x296e81b4, 0xb164ee1f, 0xf792c343, 0x9a3aaa4b, 0x113b7928, 0x26564737,
+    0x9c1122fb, 0x54134cd1, 0x6101ee30, 0xe5619777, 0x8ed8174a, 0xa043a03a,
+    0x7e4b0296, 0x17dbae76, 0xe11ac607, 0x631b0c4a, 0x077ba32f, 0xd4b19f97,
+    0xd8d96f90, 0xf962215b, 0x3bcd58dd, 0x4aaa2334, 0xb6b703ee, 0x39f89ff8,
+    0x4b87be4f, 0x897de83d, 0x9755e6eb, 0xec7534e9, 0x6db0edc1, 0x5d560abe,
+    0xfb012322, 0x2d741138, 0x1ed14099, 0x93c18c6e, 0xc26d1069, 0xbec41a89,
+    0x26044ee1, 0x021a7be3, 0xab4f94bd, 0x732b7008, 0x57eacf57, 0xce887ec6,
+    0xbcc17e85, 0x87cfc314, 0x4360157a, 0x34ead804, 0xd5ffb040, 0x475f4886,
+    0x312356a1, 0xf5ff14bd, 0xe94b1b18, 0xdab51d35, 0x081648fb, 0x6b4ead0c,
+    0x8504e5f2, 0x1cfb0a24, 0x72e7746f, 0xad0069d0, 0xa885810d, 0xe6dbc88d,
+    0x5537606d, 0x57d5a124, 0xc1e0b83e, 0x24517b71, 0x256e8064, 0x98b81a04,
+    0xf8341c8f, 0xb3eb5a61, 0x1cc02612, 0x0a9d43ac, 0x94220b44, 0x7ce8abaf,
+    0x6e29c277, 0xc6304b3e, 0x8656cd5d, 0x8acfb1c8, 0x706bdf30, 0x3b7c969b,
+    0xeb7c991b, 0x495c74a6, 0x0b315d33, 0xfbc55116, 0xd643afd6, 0xd6cf3f10,
+    0x33f18e86, 0x60dd1e8a, 0xbf217940, 0x149befbc, 0x41f6f826, 0xa20f5704,
+    0x9f9b5b52, 0xcdf565a7, 0x62cd725d, 0x716601c8, 0xf522195c, 0x019b7022,
+    0x127e0025, 0xbdc534a1, 0xcc5b4dc0, 0x90d2da54, 0x2baeccbd, 0x2fa3b04b,
+    0xa7b595d3, 0x5e05eac7, 0x5eb858be, 0xef8a7e6d, 0xb5ea97e8, 0xafbea121,
+    0x481315a7, 0x1e4d30c8, 0xdb049eae, 0x68fd4718, 0x39559204, 0xd9ef6520,
+    0xe209c9a5, 0xf6b46249, 0x04670e62, 0x446f4f96, 0x8c8687b0, 0x371e73f1,
+    0x7c08698d, 0x84afaa68, 0xba727463, 0xdda58676, 0x4578f9e9, 0x6db9af39,
+    0xd14b07c3, 0x1a4b383a, 0x37b68c2a, 0xabba73db, 0xef35e251, 0x812ac5cf,
+    0x0e2611a6, 0x30a3cfde, 0x80bc1e92, 0x4139bef5, 0x77eb3009, 0xf2acebb8,
+    0x93a704dc, 0xb90cf20f, 0x680ce4ed, 0x04fadaa2, 0xfe15ed7c, 0x75acb5d0,
+    0x18146d8b, 0xc9102c00, 0xc4ed0b38, 0xe92a4ef2, 0x22610057, 0x5a2419f2,
+    0xad35ce28, 0x2bcaa274, 0x50c2b177, 0x966f481d, 0x88217a7e, 0xff4fbac7,
+    0x78db3232, 0x4cab8b0d, 0xe4e1cb12, 0x3f44ee19, 0x03a5dc92, 0x8e8cfd72,
+    0xdf33be99, 0xa631111a, 0x3fc88bb4, 0x10a2bf03, 0xb2ee6eea, 0x65b7220a,
+    0x4c44553b, 0xd3a450cc, 0xa2648bea, 0x9ff7cec3, 0x59a03504, 0x2173ad02,
+    0xcb56c091, 0x512c42b7, 0x2f2332bd, 0xe06129f9, 0xf1c1e979, 0xc1f0c947,
+    0x176698ab, 0x7afbf9fa, 0x9bd6b6e8, 0x0d1d38ba, 0x674994e9, 0xb62b1811,
+    0xbe7d7d52, 0xeb57ed81, 0x40328c29, 0x59ffcd28, 0xd77adda3, 0x29d891e4,
+    0x32ae32ba, 0x9531413f, 0xeae91f35, 0xba745e0b, 0x0a5ce40d, 0x06a042db,
+    0x8746317c, 0x7632c61b, 0x7138f6e7, 0xca0d20ff, 0x956f2b50, 0x8232f871,
+    0x6f95eb66, 0x335e7fe6, 0xf99d0623, 0x42b80de8, 0x1de1419b, 0xf135652c,
+    0xc0b403e0, 0xdf91128c, 0x24403c75, 0x6f2c4e2b, 0xa9328b18, 0x18eaa8bc,
+    0x54d2e4b8, 0xa92100f9, 0x8dedebfd, 0xc285189b, 0x7d0ac30c, 0x78f8ed97,
+    0xe3673268, 0x0f7c3d43, 0x05914d68, 0xb4166e57, 0xdaf01bce, 0x9c53b989,
+    0x382c624a, 0x23a3cac5, 0xb4abf116, 0x536c8320, 0x4925978b, 0xe3997814,
+    0xa6d7da36, 0xa4422bca, 0x5f6274f5, 0x121299fb, 0xcd732dad, 0x678343fd,
+    0x2aea1fa8, 0xd141f965, 0xf44a24dc, 0xfd25315c, 0x13ca442a, 0x4edd4b15,
+    0x9ed0ad14, 0x3dbd9458, 0x63bb0b31, 0x8d7be79f, 0xacf79256, 0xd5ff3cda,
+    0x51602c06, 0x6265b157, 0xc59951eb, 0x16162616, 0x23ad3983, 0xa1fd6d17,
+    0xffc5bc7d, 0x88e6ac1d, 0x199a0ff2, 0x3832f634, 0x92583ce4, 0x4bad9651,
+    0x69373712, 0xf869838b, 0x8108a2b6, 0xb04b41e8, 0x767dac09, 0x09f6bdb4,
+    0xee9902ac, 0x7fa40b44, 0x0f707473, 0xc5269989, 0xd0fcafdd, 0xe4a52234,
+    0x36e4849c, 0x557947d3, 0xbb1f5b7d, 0x273009a9, 0x4483fa10, 0x9b2785c6,
+    0x9af47050, 0xf482dfaa, 0x661210aa, 0x46543255, 0xf01e5661, 0x355ff086,
+    0x16e9059f, 0x8657b67f, 0xca40397a, 0xac643a7c, 0x2e9a5e07, 0x1d29b47e,
+    0xa308d35d, 0x6a49ff07, 0x586288b2, 0xdb5050a9, 0xb36b9095, 0x92ad80b2,
+    0x4d631c2c, 0x2caa1e10, 0xde81db4c, 0x5c033b72, 0x3e6aed9e, 0xed5d181f,
+    0xe5600e99, 0xcf767bdf, 0x026a487a, 0x722f4603, 0x898653db, 0x03a00c19,
+    0x79387391, 0xbfe32c51, 0xa11c3fe1, 0xfa52192e, 0x5b2c767a, 0x48c2f176,
+    0xc84dae8f, 0x3aca1abf, 0x2c194171, 0x8b9d7ef7, 0xf37d394e, 0xa341a4fa,
+    0x15a6d770, 0x1534c6a1, 0x98db1419, 0x61ff8bc7, 0x65b92355, 0xd7f73621,
+    0x8a22d3dd, 0x9925fa60, 0x7add68d5, 0x25ab461a, 0xe70fec1e, 0x5655a243,
+    0x00279926, 0xe70e4e18, 0xdd1cd21c, 0xc77f81a0, 0x3cb63ddd, 0x7d03a031,
+    0xb0854b4c, 0x0b835b86, 0x4fa08539, 0xb28ceb56, 0x9187e12b, 0xd80a0eaa,
+    0x6bbace07, 0x69745eaf, 0xfc717b70, 0x1ff4d03e, 0x1b169e25, 0xae09eb9e,
+    0xc7ed4fce, 0x85e735eb, 0x2086cd57, 0x366f265d, 0xaecd4159, 0x45e073f9,
+    0x531e3bfc, 0xf780e86a, 0xb83142be, 0xbc015ab4, 0x46e10e58, 0x00de7f7e,
+    0xd3ec3298, 0x7013b089, 0x34ad1f65, 0xcc4e0eb0, 0xecd8a818, 0xee3188f9,
+    0x0de9f8b4, 0x5f9004c2, 0x82b6ed5d, 0x2ef7461d, 0x75a66246, 0x91722b37,
+    0xb782bfbe, 0xc880d8c7, 0x4ad558db, 0x74166a80, 0xd9acb6fd, 0x05fe0b95,
+    0x3afdb135, 0xb87c8fa3, 0xe040ee4a, 0x9782b5da, 0x06c5ee0c, 0x2ac729a8,
+    0x8ff6b384, 0x5bccd9c3, 0x7fb21959, 0xe8581873, 0x9d244c31, 0xaaabe9cc,
+    0x6027254b, 0x1b5074da, 0xf6bab7c7, 0x6cba8642, 0x107c243a, 0xdc68f0b9,
+    0xcf17d1ca, 0xf3e60411, 0x28c9918e, 0x4030e865, 0xa486a2be, 0x31b240fc,
+    0x5c8e3be7, 0x80e8748a, 0x84d43a8e, 0xe11a48ba, 0x733ff8d4, 0x50fa320b,
+    0xe853b00c, 0x20783d61, 0x09dccf9a, 0x9efeeee9, 0xd47b9f36, 0xb7d3a849,
+    0x3030f86f, 0x0cb87b24, 0xbd63d1ed, 0x7bbeb598, 0x422b4169, 0xc00717ba,
+    0xaabd0d2b, 0x8f092153, 0x56d917a0, 0x3ea5564d, 0xc3af0df1, 0x4da53b51,
+    0x275add81, 0xfeb95f58, 0xfae537c0, 0xd23dbbb3, 0x1f9f8850, 0x64550cbf,
+    0x96ebd67d, 0x11c68019, 0x6c3b07b0, 0xa71352c1, 0xb9ec6f8d, 0xfc7d827c,
+    0x4789f081, 0x4fad1c6b, 0xd2451820, 0x3c1350cd, 0x352b64eb, 0x8cc3317a,
+    0xed204181, 0xa57a61d1, 0x0cd70d08, 0x13519b5e, 0x83932756, 0x66e4d72c,
+    0x743376f4, 0xd04113e3, 0x909d9edd, 0x9daf6084, 0x6ada93f4, 0x22fb39d4,
+    0xfd654fa0, 0x524fb10d, 0x1aa3b8b8, 0xe20ab2fd, 0xc6e48beb, 0xc359eefd,
+    0x212ec15b, 0x79114bd6, 0xafa66f40, 0x0ed9858c, 0x52e90074, 0xb56b0d0f,
+    0x8bf5468d, 0xde688154, 0x7b3de913, 0x6e79b6e8, 0xe6589b6d, 0x199ff5f4,
+    0x01fd0995, 0xa801af46, 0xdca9d3de, 0x833a96de, 0x3d814364, 0x32c36097,
+    0xb1d24dd4, 0x43c44bc9, 0x4eda98e2, 0xf0c491bd, 0xa0ccee97, 0xbb88f687,
+    0x5a8edc2a, 0x0775f244, 0xc9df7b92, 0x771ade68, 0x2d556712, 0xcb994720,
+    0xf21294bb, 0xeac2e33e, 0x14590881, 0x584eca11, 0x99eae4d2, 0x282f312a,
+    0x646ba6ee, 0x94b936fa, 0xabe1b157, 0xce654079, 0x573caee7, 0x73b565de,
+    0xc2c6b7c9, 0x02e3c87a, 0x26c15533, 0xbe3b3b43, 0xfbf5167e, 0x931d48aa,
+    0x1e73ee17, 0x2dc8bbb3, 0x97ffb4a8, 0x5dca7e8e, 0x6d7336f1, 0xecf57320,
+    0x85abb834, 0xad8cfd67, 0x7249ca02, 0x1c0688a2, 0xe9d1e207, 0x6bd21494,
+    0x08da6459, 0xda30dd12, 0xd56c0ea3, 0xf57ff1c0, 0x31ecc8cf, 0x47dc79f4,
+    0xbc0981ba, 0x340d6c5c, 0x43d4a530, 0x8746bfed, 0x9cf3a572, 0xe5e7d4c9,
+    0x61df395d, 0x54a523e1, 0xf75e24a3, 0x26aa4236, 0x11cc9810, 0x9adcf12c,
+    0xce707f14, 0xb18bf720, 0x299376bc, 0x088d184b, 0xa5262eba, 0x7edb7a3b,
+    0x5d1f61be, 0xc438164e, 0xb67b4c17, 0x89a494ae, 0x4b21b6c7, 0x396367f9,
+    0xd87a631e, 0x4a6cc70a, 0x3b23948d, 0xf9ed06cf, 0xe181a4a1, 0xd45077d7,
+    0x078c9070, 0x63c33835, 0x8e6d997c, 0x1755526d, 0x7ea9e1fe, 0xa0d3b62b,
+    0xa76fda94, 0xef271855, 0x5e58181d, 0x5ea4265f, 0xcc82eac1, 0x2f3f2d7f,
+    0x2b368636, 0x905cb431, 0xf58600a8, 0xbd4ec516, 0x12e1c720, 0x010f9b3e,
+    0x9f1a16e2, 0x71a9c622, 0x62268389, 0xcd259a51, 0x8c021ecd, 0x843b5412,
+    0x7cddd0c3, 0x37910b5d, 0xe2973e95, 0x448bc0e6, 0x04d010d6, 0xf622c0d4,
+    0xdbaa1ada, 0xd9031ae6, 0x39dc73b9, 0x683a48f7, 0xb53b8093, 0x1ea8cd7e,
+    0x48dabf99, 0xaf4d87fd, 0x94f05c5f, 0xc6869342, 0x6ec33bb5, 0x7c2a6c96,
+    0xf8c07309, 0x0a41861d, 0x1c6289f1, 0xb327916a, 0xc15f241b, 0x9804398f,
+    0x25b6e935, 0x2496fd50, 0xa8430a7a, 0x575a62dd, 0x55a48e14, 0xe61c8b37,
+    0xbf8ad14f, 0xa2e99ceb, 0x4136348e, 0x14262612, 0xd6e3ebbe, 0x606f01a0,
+    0x334a5da6, 0xd641cb08, 0xebeed8e0, 0xfb39056c, 0x0bbe6c44, 0x49b948be,
+    0x8691680d, 0x3bb7ec83, 0x70b142ba, 0x8a21b3f3, 0xb2139b38, 0xd354a236,
+    0x4ca46a20, 0x6549bc9d, 0xdfdbef88, 0x10208397, 0x3f46ee83, 0xa6805d59,
+    0xe42e17a7, 0x8e5fdc4a, 0x03018d62, 0x3fa913ef, 0x88a9bfa6, 0x4c2fd099,
+    0x786ee1f3, 0xffe20a9c, 0x9b496ef4, 0xb6a5e756, 0x6794a26a, 0x0d9b438c,
+    0xf136e246, 0x7a11088c, 0x1795e241, 0xc15a5119, 0xcb8dce4b, 0xe090bf02,
+    0x2fb575eb, 0x51ab982b, 0xa2ee7f58, 0x21a56250, 0x596cb3ef, 0x9f02a195,
+    0x803eebd8, 0xf22f9c9c, 0x770432ae, 0x41995618, 0xefc7223c, 0x302216a2,
+    0x0eb7f7d8, 0x81e1509f, 0xd1fbad97, 0xab7f24f6, 0x3738481c, 0x1af2685d,
+    0xbad31625, 0x6d5aaddc, 0x45dc864c, 0xdd68d684, 0xada0ab91, 0x96fe8960,
+    0x5076bcda, 0x2b7c3e0e, 0xc4403bd9, 0x5acfb9e6, 0x22e0bd56, 0xe9aae1c4,
+    0xfe972a23, 0xc9a40ae5, 0x18ccf62c, 0x7510d374, 0x9316f277, 0x0478cb85,
+    0x68be61d1, 0xb981ddb6, 0xb408395a, 0xe32a4794, 0x499e0be4, 0x53c51ed1,
+    0xda39888a, 0x23326def, 0x38da1f26, 0x9cc3273e, 0xe38dd759, 0xb4f1f455,
+    0x05501ba2, 0x0f9f475a, 0x8d6b24c8, 0x7876fb1e, 0x7de566eb, 0xc277026c,
+    0x9e4f9db9, 0x8dc29257, 0x6304be39, 0x3d65df29, 0xf4b99696, 0x4e0bd30e,
+    0x1363a1a5, 0xfdbb324e, 0xcde6792d, 0xd1b7f92d, 0x2a0d3195, 0x672b14fc,
+    0xa6228e93, 0x12af7cc5, 0x5f9f62cc, 0xa4d16ab6, 0x87b2aad6, 0xcab6a1fa,
+    0x71862e47, 0x7687c129, 0xea7126ca, 0x064082a5, 0x0ae9967a, 0xbab2609e,
+    0xd7dc1582, 0x9597a702, 0x32236ba4, 0x294dbc58, 0xbe91a14c, 0x5924d123,
+    0x40a3a6a7, 0xebb222c0, 0xa9c585a2, 0xa9a72c25, 0x5428807c, 0x18069ac0,
+    0xc07e5a94, 0x6fcad413, 0x248757db, 0xdf6e8c24, 0xf928af05, 0xf1943755,
+    0x1d63f091, 0x42134df8, 0x95fc5240, 0x33c9f37d, 0x6f168467, 0x82fa7c76,
+    0xa3ad1c6f, 0xdbdf3048, 0x58f16127, 0x6aa3da03, 0xcac3fd87, 0x1deb91ea,
+    0x2e68df7e, 0xac9f7cce, 0xf0dba24e, 0x8686c28c, 0x16524bbf, 0x35e8dea3,
+    0x9a2fc3f4, 0x46e2fbd7, 0x66d17910, 0xf403033b, 0x89177930, 0xbf27fb05,
+    0x79c5c8ce, 0x03589ad4, 0xe59fa0c8, 0x72f89e2e, 0x02e76804, 0xcf835e43,
+    0xde019c49, 0xedb3401e, 0x3eaae9e0, 0x5ceb4525, 0xb3873207, 0x2c3467fd,
+    0x4db0afd5, 0x923a847e, 0x92cc599d, 0xf8ba8791, 0x69a6a919, 0x4b552a81,
+    0xff4ff95c, 0x38e3c61f, 0x19789cfe, 0x887990f3, 0xc55f8240, 0xa1647c8b,
+    0x2353b659, 0x16a3ec33, 0xac636336, 0x62e669ed, 0x51c4ffc0, 0xd5426094,
+    0xbba8ede8, 0x9be685d3, 0x44472ba4, 0x27d67bc2, 0xd02e23fa, 0x55d6e866,
+    0x3655a9f3, 0xe469406a, 0xee532596, 0xc5d7e18d, 0x0f850ef1, 0x7f550e7e,
+    0x81c5baf8, 0x090e593b, 0x76df7d23, 0xb0c273ca, 0xae6f76c2, 0xf7275782,
+    0x538eb322, 0x45696654, 0xc7319c29, 0x36e38f4d, 0x20060bf7, 0x856a4e40,
+    0xfcce4616, 0xaefaa3b8, 0x1ba41b05, 0x1f208fa7, 0x91142f90, 0x69f9510a,
+    0x6b22cb76, 0xd8bbc7fa, 0x826c845f, 0x91dce99b, 0x75352d8d, 0x2e0cd837,
+    0xec55cdf9, 0x5f0e29f3, 0x0d3a74fa, 0xeeaef339, 0xd313a83b, 0xcc841214,
+    0x342047f2, 0x70ebc3cc, 0xb8a59400, 0x003bd78a, 0x46316890, 0xbce17975,
+    0x987bca19, 0xd744ed6a, 0x652aab55, 0x610a8135, 0xf3e546e9, 0x15ee7e56,
+    0x1510baa5, 0xa3a70bb5, 0xc8bc10a6, 0x8b69cea7, 0x2c9073a4, 0x3a60026e,
+    0xa1b0efed, 0x4846ed2d, 0x5ba920a6, 0xfad979e4, 0xb02261fd, 0xb21e383e,
+    0x4f7b2de1, 0x0b76f542, 0xdddd5667, 0x7d925b9a, 0x3c19a89a, 0xc7bd9b5f,
+    0xe7c69e35, 0xe7a8afeb, 0x00b6d10c, 0x56eb50a3, 0x8a955b46, 0x253cbbe6,
+    0x7a0a43c4, 0x998e5e5b, 0xbd96a959, 0xc09f8dbd, 0x42fad3a8, 0x7b38a732,
+    0xd4ed4c39, 0x0c446ab4, 0x30875bc1, 0xb72fbc01, 0xe8f84d46, 0x9e5d5426,
+    0x0958f332, 0x20e9aa4b, 0x84677a0c, 0x5014facc, 0x7396fcd5, 0xe1c36575,
+    0x9643449e, 0xa7a256ec, 0x6c9e261c, 0x1126820e, 0xfa1d61ea, 0x64deaefa,
+    0x1f6d939b, 0xd2a51a88, 0xc32b8004, 0xfe193aec, 0x27afa253, 0x4d2c46a5,
+    0xaa78c954, 0x3e73b5ca, 0x567f7e45, 0x8fbf650b, 0x8f7a3a2f, 0xe89778c6,
+    0x7f2b56a5, 0x5b766cda, 0xe0bdddde, 0x2a630cc1, 0x066a92ee, 0x970aa69a,
+    0xd91de5d1, 0xb8c562df, 0x3a22e6e8, 0x0557fa7f, 0xb7672e9d, 0x74a579c9,
+    0x4a106f92, 0xc86a2dff, 0xa46f6f79, 0x805674e9, 0x5c1f131e, 0x31051aed,
+    0xcfe665e8, 0x40871e41, 0x286b6b0f, 0xf373dfa6, 0xf673feab, 0xdc9fae45,
+    0x10d23b16, 0x6c1048aa, 0x9d848200, 0x1bad03ed, 0x60dfac1e, 0xaa32ec26,
+    0xb6ea3dd3, 0xf9be17c0, 0x4bd69b5d, 0x4a1bd250, 0xd89425d8, 0x39138373,
+    0x3bbcbe41, 0x89e7a52c, 0xe14812c2, 0xa085dfec, 0x0702be32, 0x17068d51,
+    0x8e9c34e6, 0x6385520c, 0x7e00b9a0, 0xd419e39f, 0x9c768482, 0x9ab52dc8,
+    0x6144184e, 0x26c287ee, 0xf7df7ca4, 0x54e4f58b, 0x114f43e3, 0xe59a3c60,
+    0xceee2994, 0xc4685695, 0x292a8295, 0x7e966ae7, 0xa5d79a37, 0x08f60902,
+    0x5d92c8c2, 0xb1dea77b, 0x85688b45, 0xda4f583b, 0x728b6721, 0x6ba09849,
+    0xe92c5ec2, 0x1c773501, 0x085782a9, 0xadf7a898, 0xd58dc3c7, 0x870abbad,
+    0x3168ba92, 0x34512892, 0xbcad9624, 0x47b8059f, 0x430bad2e, 0xf530f060,
+    0xab029ae9, 0xbe7d09f6, 0x57b794e3, 0x0287c020, 0xc20fe079, 0x73c7606b,
+    0x2653918f, 0xce1c9e14, 0xfb7168d2, 0xecac3502, 0x1e9db997, 0x5d984307,
+    0x973e8e76, 0x2d8f69bf, 0x6de40c82, 0x93489b32, 0xa0219ef5, 0xcbcd40ee,
+    0x5a233690, 0x776123da, 0xc94450bb, 0x071a26d6, 0x2dd0f205, 0xbbe0f1a6,
+    0xf2a51138, 0x94e0aa00, 0x14f7eba9, 0x2842c633, 0x992071be, 0x5809a3bc,
+    0x64f506d7, 0xea9d4c96, 0x8b102de7, 0xa86ec9a8, 0x7bc2311a, 0x19ef6d0b,
+    0xe6935ad3, 0x6e06b883, 0x016f93b2, 0xde1793fa, 0xdc496533, 0xf09e40e7,
+    0x3d703362, 0x43af4eb1, 0xb14d1bfd, 0x328a6711, 0x4e4670cd, 0x837087bd,
+    0x90498d3e, 0xe276e96b, 0x6a3ab249, 0x522b5fa9, 0xfdba6abf, 0x22ba1a81,
+    0x1a4aebb6, 0x9df31609, 0xc646100c, 0xb525108a, 0x218ee23c, 0x0e9a53ba,
+    0xaf037b0e, 0x7969898d, 0x522f882c, 0xc332d699, 0xb9466c9c, 0x8c980425,
+    0x47199497, 0x3c588f50, 0xd2a1f3b8, 0x4fe6e64a, 0x35a0e663, 0xfc02013f,
+    0xedda8aac, 0xd02e877e, 0x0c59b910, 0x6699d760, 0x83622115, 0x132acbde,
+    0x74f7769c, 0xa53699ea, 0xad73b0a3, 0xe9fe8526, 0x509525a2, 0x5a810a94,
+    0xc49e38fe, 0x2b2d07ae, 0x221671e8, 0x96aa14b0, 0xfe771f1f, 0xb9ee3f5c,
+    0x1854bbc6, 0x042f1bb5, 0x93f769ea, 0x75649766, 0x6859e8fa, 0xc9d9d6e4,
+    0x80c763d8, 0x8198df48, 0x778f2249, 0x307ee1d6, 0xef5121aa, 0x41c03c03,
+    0x0e62b657, 0xf273e9de, 0xd10584a3, 0xdd30bcf9, 0x37cabc9d, 0x6d17cfeb,
+    0xba01a8d8, 0x1ab7aaf9, 0x4536625a, 0xab2e56a0, 0x9b9bf834, 0xc12e66a6,
+    0x6739bbc8, 0x7a619b8e, 0xf1943ede, 0x0dead153, 0x172a37d7, 0xb6e2d5bc,
+    0xcb25892c, 0x9f711fe5, 0x2f647887, 0x21d97e3f, 0xa211bf24, 0x51e97361,
+    0x59f10171, 0xe0e0b10b, 0xb292e09d, 0xa6c6952c, 0x4c22ce18, 0x104c6320,
+    0xdf70fc58, 0x653fc6ec, 0x3fac523e, 0xd30e95b4, 0xe4853c64, 0xff8b3e73,
+    0x03f73f17, 0x4c74b331, 0x885ab137, 0x3fd5a595, 0x78a55cd7, 0x8e10a95b,
+    0xbf4e0aa0, 0xd607f230, 0x41a8e30c, 0x601f58a7, 0xd63ac6e1, 0x1478e10c,
+    0x33ac0f8b, 0xa2b5a9b6, 0xeb2f5634, 0x8a582263, 0x0b5bc9ce, 0x3bd30197,
+    0x863d7d23, 0x49c5d1e1, 0x703d95cd, 0xfb5c0b85, 0x944d6d94, 0xb3537232,
+    0x6e5055a3, 0x0a194679, 0xf86f9f66, 0x7c5da6f7, 0x1cbd2d8c, 0xc6e2d7c6,
+    0xc1bd3492, 0xe67abbde, 0x2501a320, 0x57096a5d, 0xa8e2d44c, 0x24fb4ece,
+    0x554aea0d, 0x987f6769, 0x8cf67dc8, 0xf677879a, 0x7c685764, 0x44eed9da,
+    0xe260c718, 0x37e11e78, 0x0415c381, 0x846957ae, 0xdb79a2ab, 0xaf105c8a,
+    0x3902864c, 0x1efd5ccd, 0xb5b1ebd3, 0x684c1dc6, 0x485af24a, 0xd9464386,
+    0xa7fd392f, 0x90260e9a, 0x5ece0746, 0x2f43a919, 0xcc13d737, 0x5ed86432,
+    0x2bf68c84, 0xef7c84cf, 0xf54eed28, 0xcd74cf31, 0x1216e737, 0x71e6cae8,
+    0x9ffaafb3, 0x0148a822, 0x62863a53, 0xbd392ebb, 0xbb71d681, 0xe42eae2b,
+    0x44d37a26, 0x559d4ce7, 0xd09ce423, 0x279775d4, 0x36aec5be, 0x9bb9afb9,
+    0xeedb5d6a, 0xb0b164b6, 0x0f39d6ba, 0x0978eec9, 0x81470390, 0x7f10dc6a,
+    0x763e079c, 0xc5878cdd, 0x92064c70, 0x8825dd43, 0x6967e911, 0x388f62bc,
+    0xffb716fc, 0x4b0617e2, 0x19c371d6, 0xf8f16429, 0xc5c9d3a8, 0xd5052a9c,
+    0x23e8abbf, 0x628d0615, 0xacaddf98, 0x16d4b770, 0x510eb633, 0xa12fa7a3,
+    0x89d75ee2, 0xcff0036a, 0x79441c82, 0x72955b12, 0xe5363108, 0x030ebee0,
+    0x02037b51, 0xbf7248ae, 0xdec7d150, 0x9250561a, 0x3e067827, 0x2c64c5ec,
+    0xb31928a4, 0x5c9f8b63, 0x4d3d4389, 0xedcce950, 0xa37796db, 0xacccf695,
+    0x5824fa95, 0x1db25ed1, 0xca2fa774, 0x6ad1594e, 0x2edf8382, 0xdb8e803c,
+    0xf0715d52, 0xf459aab9, 0x169cef8f, 0x4688999b, 0x9aa7469e, 0x35bb579d,
+    0x66643b18, 0x86fc5840, 0xa953c1cb, 0xdf34e73e, 0x548f3cf1, 0x6fb89de8,
+    0xc0ea3503, 0x18792084, 0x243182c6, 0xa9c30012, 0xf9fcb2e0, 0x8290e085,
+    0x1d95425a, 0x3386b843, 0x9510444f, 0x4256ca3e, 0x6fef9ea0, 0xf1f35ca9,
+    0x872d282e, 0xbaf4f4de, 0x715d9fbf, 0x06033b69, 0xea942ead, 0x76c3f53a,
+    0x0a2a31ab, 0xcafefcbf, 0xd7012b0c, 0xebc8f786, 0x32c69e58, 0x5963002a,
+    0xbe34dec3, 0x2930c7de, 0x404f23e5, 0x95dc382e, 0x9eb68c03, 0xfdfbe261,
+    0x63f4268f, 0x4e5be983, 0xf423c819, 0x3d222bcd, 0x13aeb6ec, 0x8d9b760a,
+    0xcd139274, 0xa496d0a0, 0x2abe76e0, 0x12f67b2f, 0xa6b20aed, 0x675eaebb,
+    0x5f2cd415, 0xd1c154be, 0xb4d73fd7, 0x9c962746, 0x49422719, 0x2350eb68,
+    0xda9a450e, 0x53a8cd01, 0x387dda1c, 0xe3448fbd, 0xe32bafa2, 0xc2141e3a,
+    0x05d97200, 0x78314532, 0x8db63acf, 0x0fc0e683, 0x7d457211, 0xb48c932c,
+    0xa4c085db, 0xf3145b85, 0x5cfdf4a0, 0x40e6e5b1, 0xcf679c03, 0x31578dda,
+    0x288a4767, 0x80380f7e, 0xf6e1236c, 0xaa77e0d3, 0x10027b29, 0x1bee950a,
+    0x9d445426, 0x6c7c33ae, 0x60504fa3, 0xdcc42ace, 0x8fa8b3fb, 0x9748d1e6,
+    0x7fcb2461, 0x2a3fff37, 0xe03334f9, 0x5b312ef4, 0x06a050ff, 0xe8e189d5,
+    0xd9e76846, 0xc8333b50, 0x3a907efd, 0x74d016e1, 0xb7c9fd0d, 0x051fcc70,
+    0x4a9c8136, 0xb8bbd62b, 0x96908c6e, 0xd2ca1770, 0x6c6d20e2, 0x64983919,
+    0xfa81ab3e, 0x1173291d, 0x1fcfe7e0, 0xa7e6197d, 0xc3efd33f, 0x8fdf2b6f,
+    0x27367ffa, 0x3e229a43, 0xaaf93857, 0x4d793299, 0x569dd0ef, 0xfe446e61,
+    0xbd0e4218, 0xb766793d, 0x4272475a, 0x0c179d1d, 0xd429f55d, 0x7b47284e,
+    0x30504d5f, 0xc0f5d099, 0xe827f48b, 0xe1938bbe, 0x09af5ef0, 0x5061410a,
+    0x84a894a7, 0x20ac4de7, 0x73504de1, 0x9e261f48, 0xb0c8a554, 0xc7ed0da5,
+    0x4fd2ec88, 0x7dcde832, 0xdd4d7734, 0x0b131202, 0x3ce50f8c, 0xb252e7ae,
+    0xe7608c0e, 0x99d6049e, 0x005ec043, 0x255192b9, 0x8a6b6276, 0x568ee164,
+    0x7a8a4d92, 0xe7f03c8b, 0x9890c081, 0xa3d11032, 0x65d0b4bc, 0x15bb2f26,
+    0xf303ebde, 0x614ce340, 0x15cf04cc, 0xd721004e, 0xc838b86d, 0xfabc41bf,
+    0x2c6dadf9, 0x4828b872, 0xa1458b68, 0x3a38948c, 0x5b40dc3d, 0x8b2cf19c,
+    0x82e0d1e1, 0xeed3c0f4, 0x75d4e80b, 0x5f6b0b67, 0xecb580fe, 0x2e416ded,
+    0x0d93b42a, 0x918cd76d, 0xd394a779, 0xbcacf5c2, 0x34ec6d09, 0x0068f005,
+    0xb8499407, 0x70aaa281, 0x46b7a642, 0xcce82fee, 0xae9052f6, 0x85007046,
+    0x5378333a, 0x3689b259, 0xc7bdc52d, 0x4526b417, 0x20f7002e, 0xf755f4f9,
+    0xfc2acfbb, 0xd8d20132, 0x1b5ca53b, 0x69812a08, 0x91cc476c, 0x1f79f3d2,
+    0x6bd42441, 0xae917470, 0xbc458e6f, 0xf582831b, 0x439445da, 0x472124a5,
+    0xd5323bfc, 0x3487b6b5, 0x31baefe2, 0x87a4ec49, 0xe9afbf7a, 0xad51a10a,
+    0x089a095c, 0x1cad3d76, 0x85f8f1c8, 0x6b23888d, 0x7229aaa4, 0xdaf9022a,
+    0x978fd2aa, 0x93864199, 0x6d0c6771, 0x2d1e1e0f, 0xfba0dd8d, 0x5d2276b5,
+    0x1e361cac, 0xec1f28b3, 0xc2b8e19c, 0xcec74ed4, 0x26afd435, 0x734fc99a,
+    0xabb6a928, 0x025dfba0, 0x57632bb4, 0xbe9bb97b, 0x8e2ed281, 0xd4da49c5,
+    0x7efd07e0, 0x6362f74a, 0xe1f27bea, 0x17ba6e57, 0x07c4074b, 0xa02ed78e,
+    0xd80ee782, 0x8900ff5f, 0x3b438a7c, 0x39944c4a, 0xb63eb010, 0x4af24793,
+    0x4b57ee4d, 0xf935167d, 0xa5559430, 0xb1153e74, 0x5d67686a, 0x087c8153,
+    0xce008b04, 0x7e1f12b1, 0x29c06b73, 0xc48445cf, 0xf731549c, 0xe50507a7,
+    0x11838f47, 0x54468822, 0x9c907538, 0x261d3702, 0x61b896ea, 0x9a5aceff,
+    0xafe6565c, 0xc392c61e, 0x528cfde5, 0x79f8e8b9, 0xc69af6c9, 0x0e44e0f9,
+    0x2150e36b, 0xb5849a8d, 0xfd18b0a7, 0x9d0573d8, 0x1acd84d2, 0x224e2088,
+    0x90cc27a3, 0x52c50556, 0x6aa49536, 0xe29b14b5, 0x83e0791e, 0xa5fab351,
+    0x745eacc2, 0x138a345a, 0xed58129a, 0x662b67b7, 0x0cb6cd3a, 0xd0e0e118,
+    0xd20abe79, 0xfcd09ded, 0x35731dc8, 0x4f7fdd1d, 0xb9bc9568, 0x3cb1acad,
+    0x47c826cb, 0x8c15746f, 0x998084a0, 0xea264214, 0x642fd948, 0x58c665db,
+    0xf27a5465, 0x28f1d3de, 0x14189ecc, 0x9454e31b, 0xc9a7e7b1, 0xbb00056f,
+    0x2d1e9e79, 0x078c0a33, 0xa08e8c67, 0x7796deb5, 0x5afe655c, 0xcb0ebaa1,
+    0xb198af1a, 0x83b9145d, 0x4e87f006, 0x320b9419, 0xdce822d0, 0x4370fac6,
+    0x3dd90ed5, 0xf03fba96, 0xe63ad046, 0xde867c86, 0x01aa705a, 0x6ee3a8c3,
+    0x8ba485c4, 0x1969520f, 0x7b47ab3b, 0xa8c921ae, 0xa28fcf38, 0xe004ced4,
+    0x59197335, 0x514ad4c1, 0xcbceb8f9, 0x211a5590, 0x2fd54bee, 0x9fad6781,
+    0xf15dec50, 0xb67e6816, 0x17df4db7, 0x0d4a8b7b, 0x9b0cb4b6, 0x7a96bcea,
+    0x67f3441f, 0xc1810c7e, 0x88c10665, 0x8ec793d1, 0x78156a86, 0x3f0c5f08,
+    0xe46cf720, 0x4cf3f24f, 0x03745049, 0xff2d193d, 0xdfb5dd9c, 0xd3d968d9,
+    0x3f117d78, 0x65c01e3b, 0xb2646146, 0x10c0da07, 0x4cfec80c, 0xa66df1c2,
+    0x936909a3, 0xc9761c6c, 0x68ddf09e, 0x75cfa284, 0xfefecc32, 0x04bb3f09,
+    0x18b1be66, 0xb95f0716, 0xc43d6e3a, 0x960f9de4, 0x229c6d8c, 0x2b9a44dc,
+    0xadfe77eb, 0x5a4a8034, 0x5011016f, 0xe94fcd08, 0xbaa29e84, 0xabd25671,
+    0x45b3a303, 0x1a17f8b5, 0xd1867cbb, 0x6ddc5904, 0x3741537b, 0xddee58ef,
+    0xefb47014, 0xf2d9b1f2, 0x0efa06b5, 0x414fb33d, 0x807d3760, 0x30ebc2a1,
+    0x77561163, 0x816790ec, 0xb5485251, 0xd99f186a, 0x4881c99f, 0x68829742,
+    0xdbc1077a, 0x1e0382e7, 0x3988ada7, 0xaff2c8d9, 0xe2e3f39b, 0x84de7a95,
+    0x049edace, 0x3753ea94, 0x8c54e062, 0x4439e035, 0x7c9ac958, 0xf6c3fe79,
+    0x9f4670be, 0xbd8d47dd, 0x626a4d4e, 0x01e26cfb, 0xf5cd3134, 0x7118a10a,
+    0x12b1ef4e, 0xcdb305eb, 0xcce80033, 0xeff56e95, 0x2b7cf599, 0x5e78a2df,
+    0xa701f18b, 0x2fe86252, 0x5e050c4d, 0x90883c63, 0x86e38bab, 0xfb81ad7c,
+    0x70d37cfe, 0x493bede7, 0xeb995083, 0x3b0c51cc, 0x0beaf0d4, 0x8abf8642,
+    0xd68bbe97, 0xa246db52, 0x333980f1, 0x14c686ae, 0xbfc16279, 0x60ab9726,
+    0x4163216f, 0xd693ae29, 0xa804c415, 0x98cb3331, 0x55ee391c, 0x2420e0ba,
+    0xc117d550, 0x57bbf9fe, 0x25d1198b, 0xe6a526b5, 0xf8a78aa5, 0xc6439210,
+    0x1c355d52, 0x7cb44e74, 0x94b29351, 0x0acd9961, 0x6e94d06d, 0xb3aaaaad,
+    0xb3f59cdd, 0xed07b311, 0x4decd601, 0x5c651b17, 0xde7ae77e, 0x2ce82294,
+    0x3ee00b01, 0x92e6f7a8, 0xe5d3c1cb, 0xbf92789e, 0x02b079be, 0x03dce57a,
+    0x894f6b78, 0x727f7fe8, 0x79834771, 0xcf1500c9, 0x9a667dc0, 0x86327738,
+    0x66bec9cc, 0x3526368b, 0xf09c33e6, 0x4604eb04, 0x1637656f, 0xf4e51b62,
+    0xcaaa5e63, 0xdb133365, 0x2e0bb524, 0x6a3e355b, 0xa3e2772e, 0x1d4d273c,
+    0x5884e0eb, 0xac0cf1ef, 0x81a51296, 0xc57b56c3, 0x76b6712f, 0x7fcc3732,
+    0xee0ef5a1, 0x09b85ed2, 0x0fd691b8, 0xb02997e6, 0xd04f81cb, 0x9b6421ce,
+    0x3610178a, 0x274598cc, 0xbbe67f2e, 0x5509ca58, 0x441ce832, 0xe4f26378,
+    0xac0e6a2a, 0xa1954eb0, 0x51920c43, 0x167fa188, 0xc52a0b55, 0x62278130,
+    0x232de58a, 0xd5bc21b1, 0xff16f435, 0xf823b118, 0x19377778, 0x4bfbfe15,
+    0x929c8f7a, 0x385c3656, 0x69c5e9f8, 0x88979193, 0xa6535bdb, 0xd129619a,
+    0x5fe00038, 0x67f09c7b, 0xcd98eddf, 0x12690214, 0x2a6d93d6, 0xa4169367,
+    0xf4ef183e, 0x8d012418, 0x1320d859, 0x3de2f1f6, 0x9e29ccb3, 0x4ea06f2b,
+    0x637eb708, 0xfd6e472f, 0x8d14c596, 0xb47a0a6b, 0x7d851d53, 0x0f3574da,
+    0xe3e7698e, 0x788ce7e4, 0x052d342c, 0xc2c245b4, 0xda62f44b, 0xe3cbe94e,
+    0x38b59212, 0x53026b96, 0xb47d8063, 0x23cd8ea7, 0x49ef5f9e, 0x9c11512c,
+    0x95b3feaf, 0xf1538baa, 0x6f527577, 0x42cff564, 0xf97c9a20, 0x332dba36,
+    0x1d0a4107, 0x82614268, 0xc025c2dd, 0xa9638011, 0x24e8c416, 0x1890e27a,
+    0xa993f57a, 0x6f77f498, 0x5447a59d, 0xdfe6ab3e, 0xbee3729c, 0x95700ee6,
+    0x40e4c952, 0x29928bd8, 0xd78cfeb6, 0x59a532b4, 0x324a4b32, 0xeb1a8bab,
+    0xea0a7d38, 0xca6fd501, 0x0aaebe13, 0x7675bc40, 0x87d188d2, 0x06d1e994,
+    0x71e3805a, 0xba3eca2b, 0xaa20cde7, 0xfefe6ef6, 0x5632e336, 0x4ded3d50,
+    0xc34cc6f2, 0x3eca4021, 0x27cfef5b, 0x8f64b931, 0xfa75a07f, 0xa7659c86,
+    0x1f3c16ba, 0x1195ba29, 0x96339c43, 0x643a7db9, 0x6cdc9d6b, 0xd2587cb5,
+    0x840585e3, 0x9eb50d83, 0x73e826cf, 0x201c5846, 0xe89f0f78, 0x50aa6557,
+    0x092d0f05, 0xe1758418, 0xd49ea692, 0xc0460584, 0x30eabfd8, 0x7bd95193,
+    0xbdd83616, 0x0cf917a1, 0x42a8a005, 0xb79a6869, 0x9dc3d407, 0xdc03b909,
+    0x60971535, 0x6ccde260, 0xf609aa62, 0x1b00dbce, 0x10b166ef, 0xaafbf5ad,
+    0xcfbf815a, 0x80ad750d, 0x281e7ee8, 0x31d214b1, 0xa4181c71, 0x407205f7,
+    0x5c49a762, 0xf38014d8, 0xb726b78f, 0xb815661a, 0x4a45c76c, 0x05a21ace,
+    0xd97ec667, 0x7472c191, 0x3a720668, 0xc8f1e48f, 0xe0e4b288, 0xe80fd376,
+    0x063eff2a, 0x5bbc9b0b, 0x8f0f8da3, 0x2a86c99d, 0x7f575143, 0x97c54c6e,
+    0xb8fcd2f0, 0xcc27ff76, 0x466d0a6f, 0x7077cf1c, 0xd347eb0c, 0x00845b47,
+    0x347ef185, 0xbc6d7239, 0xec0e24c9, 0x910af0a4, 0x0d5c74a0, 0x2e9333fd,
+    0x8232fbb9, 0x5ff81d93, 0x7545a37b, 0xee6426df, 0x91533894, 0xae7d7058,
+    0x6b5ebc0d, 0x1f93be67, 0xfca2222c, 0x692609e3, 0x1bc168bc, 0xd85e6f9f,
+    0xc7649700, 0xf7ed52e9, 0x2066798d, 0x45ad1675, 0xae0d606f, 0x362e7f22,
+    0x53d7c1db, 0x85acc5a8, 0x8ae85ee0, 0xe741f42d, 0x7a4458f7, 0x5611ccf6,
+    0xe7a9ed30, 0x25cc7911, 0x00da1089, 0x996e574c, 0xdd92c190, 0xb2fb7690,
+    0x3c42fb4a, 0x0bd8bf03, 0xb07c600c, 0x7d43de27, 0x4f36b474, 0xc7086f01,
+    0xa1cad65b, 0x8bd7e477, 0x5bc916d5, 0x3a806d4c, 0xc8e7b236, 0x48a6c936,
+    0x2ccb8295, 0xfa2a76c9, 0xf3acbf4c, 0xd7a8182b, 0x155f874d, 0x61a60e6b,
+    0x981a525b, 0x15751064, 0x65569117, 0xa323f0b4, 0xccbd5a7b, 0xbbbd54cd,
+    0x50077b72, 0x6d3444e7, 0x97ca1d8f, 0x265c7a25, 0x22e1b8b3, 0xe433236f,
+    0xa6f33e08, 0xc187917f, 0x0c4807bc, 0x10644d8d, 0xfffc5e95, 0x58af428a,
+    0x7dc7fa77, 0x959dc83a, 0xe5ba578b, 0xf6fc2b71, 0x6c5ac527, 0x334de770,
+    0xb77aa324, 0x7baa4f29, 0x1dd2db2a, 0xa48be700, 0x84269e39, 0x83992d9e,
+    0x398f490e, 0x4205d052, 0xdd96c21b, 0x08215a11, 0x4883b319, 0xdd7f2ee1,
+    0xf08cc165, 0x9881447e, 0x73a12e42, 0x524cbe8c, 0xaa3edecd, 0x1aceb524,
+    0x06df659b, 0xcfaa2bc2, 0x9eb3fce9, 0xeebd76dc, 0x2cb21dd8, 0x2efcba11,
+    0xc64c9b32, 0x630c0936, 0x592c033d, 0xb5d29459, 0xd4bb866b, 0xd060be6c,
+    0x424b1ed7, 0x0060271c, 0x89857d42, 0x4df7dd37, 0x343e1f7a, 0x8cb53379,
+    0xbda7fb2f, 0xa9eb9bc2, 0x14836342, 0x73f7749e, 0xe89d4328, 0x3c646af7,
+    0x6530765c, 0xfcc29c08, 0xd95e2c87, 0x8a2d3622, 0x4dce968d, 0x480331f9,
+    0x8326bd20, 0x07022c3a, 0x3ef6bd91, 0xd54d28a6, 0xb15ba530, 0xf95f1773,
+    0x1a8531f2, 0x3b553ec4, 0xe0490dc4, 0x74432e9f, 0x6b79e1ee, 0xac785e66,
+    0xf8442990, 0xc86ff4df, 0x7901237d, 0x1ff7cb22, 0xa0a85023, 0x54b72f37,
+    0x09a4f40b, 0x9f45ee97, 0x92051044, 0xb3009f90, 0x24fd3455, 0x66e32566,
+    0xcbc60de2, 0x2a9990f7, 0x547eb1f7, 0xe9cc0de7, 0xeefe0207, 0xa091721c,
+    0x61064d11, 0x7f9fab32, 0xba9c4a46, 0x345c2713, 0x10497cab, 0xf3400a01,
+    0x8c6a62fc, 0xdb94faa9, 0x3360bd26, 0x0fa3768f, 0xd3b5b5bf, 0x45a70941,
+    0x450db23b, 0x85753e4e, 0xc0daa85d, 0xe342e2b7, 0x5c950e9f, 0x22b8c801,
+    0x9ac300a4, 0x6b581832, 0x2b3e1497, 0xbd4d12ba, 0xae3a34d2, 0x93bdff33,
+    0x03e77630, 0x5c649f2b, 0xf425ad2c, 0x15dc3d7f, 0x76624f9a, 0xc4167ddb,
+    0xd09a2180, 0xae62af40, 0x4698b9d5, 0x76f028cc, 0x8f9037f8, 0x38ebe29e,
+    0x303c7609, 0xfaee7eb9, 0xb9f80444, 0xd6e29ad5, 0x126ae8e4, 0x054c56e7,
+    0xedc177d5, 0x4b87791e, 0x6332bae9, 0x89576a66, 0xf640430d, 0xeb453c53,
+    0x7583d9ec, 0x28451db7, 0xadcd9a15, 0x65e64590, 0x00c31539, 0xb04f61c8,
+    0x99e1d492, 0x9d948892, 0x28caad48, 0x57531bd2, 0xc2ac1bce, 0x1cab4ae9,
+    0x5f1cd72a, 0xcac917df, 0xe2bf14eb, 0x87eb57bd, 0x69d7a0d5, 0x46959460,
+    0xb3306206, 0x0cb560b2, 0x18a0836f, 0xd8bc246e, 0x81d6826f, 0xf1a7d2cd,
+    0x3cb98e2f, 0x37882708, 0xdbdcd396, 0x7d075e28, 0x4eff6211, 0xa2b8d7b9,
+    0xc9775bf2, 0xc7dbb8b6, 0x57ec4965, 0x16ecf363, 0x9014eaa2, 0x5f8d7da2,
+    0x266c6415, 0x91313bba, 0xa256a4d5, 0xbe669e6c, 0x0a80da31, 0x69cfa917,
+    0xfb212a1b, 0x20c37341, 0x7a51ed60, 0xe0e74a41, 0xc5eb19ac, 0x9771eb28,
+    0x5b2aeb82, 0x5b131a94, 0x9ca8ea80, 0x134c644e, 0x2e84b71e, 0xc2f454fd,
+    0xa91db395, 0xe735110c, 0x05e4df6b, 0x2595be15, 0xf2cfd8ad, 0x6eb41412,
+    0x70534e22, 0xb9e616b4, 0xeaf16732, 0xde2bbd2c, 0x668fb9aa, 0x0bc10bd1,
+    0xbf088f4e, 0x403ea557, 0x16f182e5, 0x8088e0da, 0x8af7c5d1, 0xa7ad275c,
+    0x36adb22b, 0x7968f73d, 0xd742daba, 0x30a58ab3, 0x40abc490, 0xf5f485fe,
+    0xfcd8ea9a, 0xb6c759b1, 0x7ecd70b4, 0x61568663, 0xa4fe969e, 0x2caf3905,
+    0x0feef5a7, 0xede856ea, 0x94b1350d, 0xccd480dc, 0x217d7a95, 0x19073dad,
+    0xce58c49b, 0x50a4f8df, 0x53c91139, 0x9b4e8845, 0xdfb79c29, 0xff283456,
+    0x4b66a204, 0x3efadd4f, 0x861c184b, 0x71df53ac, 0x3a00febc, 0xaa199494,
+    0xb55a4702, 0x8e38b839, 0x1f7dbecc, 0x4e755f63, 0xe60a719e, 0x02f80df4,
+    0x6e0ec471, 0xd31b8dcd, 0xc3fee8c2, 0xa5359725, 0x5e6202e9, 0x7a498dc2,
+    0x98198f72, 0x3279312b, 0x29265546, 0xf7a26c19, 0xac61d788, 0xdcb7e7f1,
+    0x01160581, 0x0930b3fb, 0xf7c85777, 0x437d0d06, 0x74f6ecd7, 0x82e73a5f,
+    0xeca6d990, 0xe5602e1d, 0x62657809, 0x27817b68, 0xb8b662af, 0x6cc50722,
+    0x13578fc5, 0xbad202d3, 0x8ed135c7, 0x94611630, 0x31526ae9, 0x591fd9a6,
+    0xd1cd7607, 0x11707c26, 0x471bb807, 0xc0bd0437, 0xfa6bea96, 0x8d306efe,
+    0x7bb543df, 0x4c90988b, 0xa3565ba7, 0x0147b6ac, 0x0b1cf79e, 0xd1b81625,
+    0x91459195, 0xfdacff2a, 0x27bc4d2a, 0x3de82c5a, 0xc824308e, 0x7228725a,
+    0x5645ea23, 0xa8f048d0, 0xda49946c, 0xcee84f82, 0x4f71d970, 0x1bb59c6a,
+    0x80c1f3f7, 0x53212d9b, 0x3d4c055e, 0x99b7af97, 0xb2cd150e, 0xb453c204,
+    0x19830014, 0x6257fba2, 0xe31a928c, 0x2f1c0d2b, 0x68aee68c, 0xef90cc34,
+    0xd6ca8ead, 0x9e1836f2, 0x4126e8a5, 0x55d114e2, 0x8b312944, 0x1e903f6a,
+    0x37838f6c, 0xc9633112, 0xbea82d38, 0xe8249e62, 0x17bc1d2c, 0x2b5caf12,
+    0xebc89382, 0x6765ec4d, 0x67a5ced0, 0xb29bbb65, 0xf3d54a2e, 0xd4f4f3d3,
+    0x7114048d, 0x0608ad4c, 0xa8fd223e, 0x4919fd65, 0x0482c218, 0x8bc417cb,
+    0x9d167aa3, 0xadc33e12, 0x2f280556, 0x75de97dd, 0xc499d7e4, 0x3aa548b3,
+    0x5ad5c102, 0xf8bd202f, 0xe7148fda, 0xbcc5c168, 0x6f2e716d, 0x6a6403d5,
+    0xb45cc484, 0x23940cc4, 0x1e2e02d1, 0xe221e7b3, 0x872a4140, 0xc5589be5,
+    0x3bfb1207, 0x14c9667a, 0xdee8b964, 0x5dea7113, 0x4a1322a3, 0x92fdad17,
+    0xcf238b94, 0xf24c8dc7, 0x52c39cdb, 0x350c16f4, 0x9518342f, 0x7ed2e94a,
+    0x20417971, 0xa1e46f6c, 0xa5d2e2ae, 0x847a87c8, 0x0e32fea6, 0x44645588,
+    0xfdbd8dd7, 0x0ee5dbb6, 0x7f501869, 0xda2f6eb4, 0xdc2b5920, 0xb139790e,
+    0x49232248, 0x647fd52b, 0x85f09eb2, 0x296da83f, 0x38416680, 0xea514698,
+    0xb6e4d953, 0xcb38fa52, 0x1ce468ec, 0x1d37e642, 0xe4416fbd, 0x567ca884,
+    0x6d5b524c, 0x9c60c7e3, 0xfe4685b3, 0xfb2877ec, 0x7c82000d, 0x39b82050,
+    0xa7bd8ee5, 0x77e422d6, 0x0db8d956, 0xaf426867, 0x96dbe1eb, 0x881f1923,
+    0x238671fa, 0x4a75649b, 0xcdc2a814, 0x042a9218, 0x51fde3e3, 0xd77c9817,
+    0xe917289e, 0x908df43c, 0x6435e5d0, 0x5eca1aae, 0xbc231636, 0x17fb2d45,
+    0x15b52f87, 0xc6064b7b, 0x88632491, 0xe18471f1, 0x356cdd43, 0x217f03dd,
+    0xd52248b9, 0x68828e09, 0x43da1502, 0xbffee879, 0xc786d859, 0xd968ad7c,
+    0x58ed8971, 0x0d28a996, 0x9f6e0852, 0x47614dc5, 0x2de6a9ac, 0x861d4d65,
+    0xab37acf0, 0xa37dcd47, 0x07beda18, 0x7c2055ce, 0xf173f34a, 0x36b0affe,
+    0x72389855, 0xf005c64a, 0xca579ee2, 0x81140dfe, 0x55478c0b, 0x413dc3b4,
+    0x93cf2fd6, 0x0afec5eb, 0x25fddbd9, 0xdf2b3055, 0xa10d484b, 0xf4a42b7d,
+    0x08325137, 0x31ae7c97, 0xf91f77f1, 0x78504d36, 0x78ae1d3d, 0xa6b76d36,
+    0xe158e5dd, 0xc3770e81, 0x6a4bffd1, 0x12816797, 0xb079cc72, 0x5a056abf,
+    0x1bb63497, 0x9658f65d, 0x82945ce3, 0xb80beb79, 0x3f928402, 0x6f506943,
+    0xd884eb70, 0x24f852f5, 0x4c62ffb4, 0xe6ecc61c, 0xf5965599, 0xab3a138f,
+    0x772dd356, 0x700ef8e9, 0xaf421707, 0x3f18524e, 0x02d036d9, 0xfea21c7c,
+    0x9b92093a, 0xd2bd05ea, 0x2ac698af, 0x03dd7721, 0xc16e329d, 0x4fa6a7a4,
+    0x5d298ee3, 0x8f3edf7e, 0xd28b7ebd, 0xec675f19, 0x448f63e4, 0x2dd7b0ed,
+    0x8db31eb9, 0x6059aff6, 0x323c9f7d, 0xb7a9c56c, 0xbba6092d, 0x9a43a5d1,
+    0x11b85f3a, 0x5170bfb6, 0xef07a9d9, 0x1815affb, 0x60cf60a8, 0xcde07339,
+    0xc6a68e6d, 0xb507233a, 0x59ffe92e, 0x63992164, 0x9e305239, 0x2e609925,
+    0x2c0c7248, 0xee372984, 0xaaa2e6b4, 0xcf77af20, 0x06246f3c, 0x1a1fd6a6,
+    0xf048e480, 0x52ff9ad3, 0x7359b413, 0x9812fb00, 0xe86dbf50, 0xfc271e64,
+    0x65a268d4, 0x3ca870d6, 0xbd151301, 0x734dd4ae, 0x1429162f, 0xa9766dd3,
+    0x890fb606, 0x8c6f3b9e, 0x348effde, 0x4d568a86, 0xd40bacd5, 0x00a4725e,
+    0x4288fe8c, 0xd0e10098, 0xff226d7e, 0x95487680, 0x7d0f9f38, 0x58440529,
+    0xa65c8023, 0x10fa0f3e, 0x0cd70015, 0xc119daec, 0x9778140a, 0xe493df3a,
+    0x224bd93a, 0x26dc1209, 0xcc79822d, 0x6db236c7, 0x50d1718a, 0xbb3b6e32,
+    0xdd56aab7, 0xddad0b23, 0x483e2596, 0x089dc69f, 0x84ec7909, 0x42c0f165,
+    0x390c564c, 0x8349ac63, 0xb7d91620, 0xa44b2d3f, 0x1d430064, 0x7b395b27,
+    0xe53f06f5, 0x3398f001, 0x6cada364, 0xf679f432, 0xd3799840, 0x85f1e695,
+    0x459f675d, 0x453026b6, 0x8c891a8c, 0x0f599806, 0x338f7605, 0xdb6d71f9,
+    0xba761b6e, 0xf3a779c4, 0x10a4f02d, 0x34a3e387, 0xee0c8dec, 0x7f66bd05,
+    0x6197ab7c, 0xa028396a, 0xf4acf0ff, 0xc4bf1f7e, 0x76c0ab7d, 0x153099a0,
+    0xaef61a7e, 0x5cfe4fd0, 0x032ef985, 0x9327bfc3, 0x9a357d56, 0xbd8cd83d,
+    0x2bd641fa, 0x6bad5584, 0xc02646c5, 0x226a48ce, 0x5c554bb6, 0xe3a2c3d9,
+    0xe0a63de8, 0xace5841a, 0x6bb3d5b6, 0x74c309dc, 0xb1c17408, 0x3b8006a0,
+    0x1a23024a, 0xf9bdf59b, 0x839570b5, 0xd58f8f99, 0x3e236170, 0x07fd7848,
+    0xd989166c, 0x48b795b0, 0x4d218a66, 0x8ada5a99, 0xcb3da3da, 0xe973b73a,
+    0x54ab9a0e, 0x2a0f8309, 0x92b8e014, 0x662eb4a2, 0x2418e845, 0xb3e0d7c1,
+    0xa065ff33, 0x9fd15862, 0x0901e93b, 0x54244e74, 0xf8d0e829, 0x1f57a4d3,
+    0x79869b14, 0xc8820556, 0xdb4d0853, 0xa210262c, 0x4e25655a, 0x7dc64dee,
+    0x814e49ac, 0x37644c3b, 0x3c025725, 0xf10086e8, 0xb39abb18, 0xd81615e3,
+    0x181d61fe, 0x0c486c8a, 0xe25c932c, 0x460203ad, 0x6935a3cf, 0x87611255,
+    0xfbc2f6c2, 0xe057f1cb, 0x7a9eacbe, 0x202ef1fa, 0xa2f4a1d7, 0x6932dc9a,
+    0x0a0ef417, 0xbecfa679, 0x908b9a28, 0x91fd242d, 0x26e5b979, 0x5f15441f,
+    0xc9bc0fbd, 0x1626ba2c, 0x5738a7b3, 0xc75e375d, 0xed45ac5c, 0x899b1837,
+    0x63dccb59, 0x4b3ebc11, 0xb9642c16, 0x05b476e5, 0x12eb57c4, 0xd66fad87,
+    0x8f104ba1, 0xfa01cbd5, 0x30948459, 0x383b6e87, 0xd03262e6, 0x763c8468,
+    0x466cf49e, 0xaebc1724, 0xc23016fd, 0xca69e1ba, 0x5ff4231d, 0x1c0351c0,
+    0x9941507d, 0x57f74e12, 0x28499cd3, 0x9d0a2902, 0xad1c084c, 0xb0facff0,
+    0x007795b8, 0x657b5690, 0xf6f80770, 0x28d5ed96, 0x753a0214, 0xebf7eca0,
+    0xced8a72f, 0x9be791b4, 0x5329a60a, 0x501dc7ad, 0x942472e1, 0x19b92dd0,
+    0x21ce9e12, 0xcc0132c0, 0xa420f2d0, 0xed01868d, 0x0f56214e, 0x2c68afa4,
+    0xfc406dcb, 0x619ee56d, 0x7e41eea7, 0xb64ef289, 0xe6bafe36, 0xd3e98553,
+    0x6eddc9d4, 0x0248f7d9, 0xb5c80016, 0x4eaf3bed, 0x1f973c20, 0x8edf352b,
+    0x86d58510, 0xaaf47fb9, 0x3acc01d6, 0x7139673c, 0xdf132617, 0x3e673443,
+    0x4b864df4, 0xffe580c6, 0xf2300b6a, 0xb937376b, 0x70ed0331, 0x6e3944b9,
+    0xa996fbd2, 0x250846e3, 0x0512140f, 0xe79ad5be, 0x9c62340a, 0xc258d14a,
+    0x2e12fc01, 0x1398472b, 0xc525fe50, 0x5ba1405b, 0x5bd008da, 0x97ebd375,
+    0xd7ab25ea, 0xf557d83f, 0x4075b4c7, 0x30430e32, 0x8a5fe9f3, 0x79ea5998,
+    0x36420ea0, 0xa758f929, 0xbf8ab9db, 0x8060d2b1, 0x166fcc0f, 0x40adf5f9,
+    0xea500bf7, 0x0b64c9f3, 0x6639b6fd, 0xdee7bd5a, 0xc8feaa5e, 0xa85b61cf,
+    0x568bfbac, 0x72a14579, 0x91b7e527, 0x3d12d0dd, 0x2760c67f, 0xfd79e150,
+    0xa3ac32ba, 0xd1111471, 0x0be773c6, 0x01e5c3d3, 0xfa83304d, 0x4c32b80f,
+    0x7b19e6a0, 0x8dc2b938, 0xe3ff5bbb, 0xef560ebb, 0x6851b267, 0x2ff47356,
+    0xb260be00, 0x62d732de, 0x197b1b30, 0xb4dc69de, 0x8056f9a5, 0x99512588,
+    0x3da9389f, 0x538c996b, 0xda97b463, 0x1b686df1, 0x4ff2bfb1, 0xce267df2,
+    0xf765a5cf, 0x82234a6e, 0x742ba8ae, 0x43b6911d, 0xaccd747f, 0x09fc2438,
+    0x01ed91fa, 0xdc58c34a, 0x98f6858e, 0xf76f114e, 0x29ae7a6d, 0x32aadfc9,
+    0xc335fdd7, 0x7abd0534, 0x5e86fe77, 0xa5c67726, 0xd1336cd9, 0xc062b222,
+    0x47c305a9, 0x11a16571, 0x8e4fd0fe, 0x59a8718c, 0x31d29fc3, 0x94c3ef4f,
+    0xb85d07a5, 0xba611889, 0x139923bf, 0x6c7b806a, 0xec6126ef, 0x272b1772,
+    0x62dbb8eb, 0xe5caa0e6, 0xde00098a, 0x922bfb74, 0x4add2809, 0x5d7e21ad,
+    0x8799e7ab, 0x143179a5, 0x3b70adf6, 0xc5cddae2, 0xb4a56dd9, 0xe2a2f932,
+    0x1ed7e456, 0x2378cb2d, 0xe7af22b2, 0x6ab5fddf, 0x6ffe36f7, 0xbc6d80e5,
+    0xfd2390b7, 0xdab2747a, 0x7fd3c414, 0x0e1a293d, 0xa57e99f6, 0x44863f6b,
+    0x0ecaea68, 0x84ffff3e, 0x958272dc, 0xa14d237a, 0x20af367a, 0x7e0d08be,
+    0xcfada108, 0x35a3e36d, 0x525b9d26, 0xf294d0ac, 0xeb07671a, 0xb20f88fe,
+    0x67378c87, 0x67bdc541, 0xbe18ec92, 0x2bbd126e, 0x171868da, 0xe89986fd,
+    0x8bae4832, 0xc99e25a8, 0x377aa90f, 0x1e31be8c, 0xd67f83ed, 0x5512ccd6,
+    0x41fa4532, 0x9ec8e418, 0xc402d243, 0xf85915ba, 0x5a509435, 0x3a3860ef,
+    0x9db58aba, 0x752a934d, 0x2fc257f2, 0xad7e7932, 0xa8648578, 0x8b164010,
+    0x045c23be, 0x49aeaa46, 0xf34da6fc, 0x06b0945d, 0x71ab2074, 0xd45eed8b,
+    0xd5e3f527, 0xbf48ebd3, 0x43306d7c, 0x68562e10, 0x889a0477, 0x21ad9c36,
+    0x358db22f, 0xe167e4cb, 0xbcb7c575, 0xc68e91f4, 0x151ccf8f, 0x174b48a1,
+    0xe9a18c0c, 0x5e2fd872, 0x64d87d9a, 0x901a197e, 0xf1f10379, 0xf09b7a9a,
+    0x72a567b8, 0x362adfaf, 0xabf66ec7, 0x7c8414fe, 0x072d445f, 0xa3d45c44,
+    0x9fa707a7, 0x8693a7da, 0x2d6ae70b, 0x47e75182, 0xc77e002c, 0x0df12a2b,
+    0x5807300b, 0xd9a2d810, 0xe4a599ac, 0x9cd1831e, 0x6de33901, 0x56cdcf2f,
+    0xb619aae7, 0x1dd34936, 0x1c710af7, 0xcba46b45, 0x855b7376, 0xeab81d62,
+    0x38dc321d, 0x29fb4bcd, 0xdcabb182, 0x64abf56b, 0x49a0f5e2, 0xb1e240d2,
+    0xcd51192c, 0xd7e351be, 0x517e9215, 0x048457ab, 0x96774743, 0x4ac55aef,
+    0x2331243f, 0x88f50fe3, 0xa7202c7e, 0xafb27a4b, 0x0d6e9410, 0x772eeb41,
+    0xfe9f9932, 0x391406e0, 0x7c606544, 0xfb83f147, 0xc1c0d651, 0x8fcf3e6b,
+    0x5dfdd9b4, 0x4f10752f, 0x9b052a81, 0x03120327, 0x2a6c13ca, 0xd2108e2e,
+    0xafdc105f, 0xfe67a83b, 0x02580128, 0x3fc55344, 0xf5285189, 0x70f52ccd,
+    0x77c9f654, 0xabefeef7, 0xefed1e5d, 0xcd1f5872, 0x6033dbc4, 0x18aca188,
+    0xbb74a247, 0x519469e3, 0x111594d5, 0x9ade4ba8, 0x8d0676c1, 0xb703815e,
+    0x32b373ec, 0x609b9cb6, 0xd203fd76, 0x2d548472, 0x4433da69, 0xecaf3f97,
+    0xf9e5cc4b, 0xa60afc3d, 0x784fe810, 0x78e64b59, 0xa1d8ecbd, 0x317d6eee,
+    0x08e036ab, 0xf411da21, 0x933a567e, 0xdffe9e45, 0x254d228c, 0x0a2418a6,
+    0xca866f31, 0x418f6457, 0x5592dda1, 0x81f56387, 0xd818b09e, 0xe628407a,
+    0x4cb51136, 0x2462ccba, 0x8209774c, 0x6ff137c0, 0x3f699b6c, 0xb8af3c46,
+    0xb0a6ed5c, 0x969b1c58, 0x1b2b3d15, 0x5ae45cc6, 0xe1e15dda, 0x124999e5,
+    0x6addd258, 0xc3ed56a7, 0xcb9cdfc2, 0xb3bc0b26, 0x5420054c, 0x66470e5b,
+    0x92448d57, 0x2a4a1f48, 0x24b88f0b, 0xe9160fce, 0xa0ff3b35, 0xc8e9c47f,
+    0x09c48261, 0x1f314c5b, 0xf8056ac3, 0x54545323, 0x797628ad, 0x9fa6e26e,
+    0xe033c7be, 0xf9ecceb3, 0x6b0953b2, 0x3bfb1266, 0xb117ba8f, 0x74bd4475,
+    0x1aeedefb, 0xac9b694c, 0x836bdc9f, 0x8aaf375e, 0x3ea73514, 0x48d2368c,
+    0xd931a1a2, 0x079fbe22, 0x4dab96be, 0xd5dd6779, 0xf449153a, 0x9342541f,
+    0x762181d9, 0x5cba2a91, 0xae59739a, 0x15751eac, 0x038e788b, 0xc4dca7f5,
+    0x9a80eaf4, 0xe3ff1773, 0x2b64a676, 0x222c0b17, 0xc08b4b43, 0x6bd39807,
+    0x5cf474bb, 0xbddb3bc4, 0xd3ff7886, 0xdb284031, 0x45786f13, 0x0f0df08c,
+    0x8c112040, 0x4556509f, 0x333152fa, 0x85ac2228, 0xbae01a78, 0xa05bf10a,
+    0x10121c66, 0x7f01d603, 0xee922ebe, 0x34d52f85, 0x6167ae0f, 0xf3c9587c,
+    0xddf2995d, 0x8315153f, 0x48c0e8ed, 0x429a9f16, 0x8442bcae, 0x08d66189,
+    0x39cddf35, 0xdde0dcf5, 0xb72c45be, 0xf6359dd9, 0x1d9641b8, 0x33d35b8a,
+    0xe5e9ddd3, 0x7b7e0c40, 0x6c120f89, 0xa43b5dff, 0xffb82c26, 0xc14fc86b,
+    0x7d92d29d, 0x10b9f479, 0xa69303e0, 0x583249fb, 0x0c19fe3e, 0x95155219,
+    0x97b8b091, 0xbb4140e0, 0x22b8436f, 0x6dc60c09, 0xccec6dae, 0x26b7c492,
+    0x507a455d, 0xe4d06e31, 0xe8e3a48a, 0xa931efe5, 0x65526030, 0x7307dc8c,
+    0xbdebe1f0, 0x3cdf4fc3, 0x14fbcfa3, 0xfc603b18, 0x89ce02bd, 0xd08565f4,
+    0x34606dfb, 0x00c82362, 0xd4f836dc, 0x4d0c5c8e, 0x4238c015, 0x8c3e1fa8,
+    0xc60a0d5b, 0xee421d77, 0x5946b5b1, 0x2e086c2c, 0x9ec3beb2, 0x63f71f2a,
+    0x2cd637ad, 0xb55e5086, 0xaa610126, 0x986042c4, 0x0699f3c3, 0x52a197b1,
+    0xf0edd081, 0x1a6dda95, 0x73e930ce, 0xcf01e8d9, 0xd72fd7e4, 0xa70980b1,
+    0x40f8099b, 0x79a044ed, 0x8a8d8e2c, 0x30351e1c, 0x36c0426a, 0xf5382ff9,
+    0xbf582289, 0xde8e970c, 0x16a405ea, 0x0b3bcc4f, 0xeabbaca7, 0x40d26bf4,
+    0x66dbca1c, 0x800a152d, 0xf29c2640, 0xe7c942c9, 0x70246f22, 0x257b437b,
+    0xa97c46e0, 0x6e76e6b9, 0x059fb2cc, 0xb9415e39, 0x9cc95092, 0x9791c3c5,
+    0x2edf26dc, 0x5bfc5ea0, 0xc5a6950c, 0x13eccbaf, 0x5b458fb9, 0xc2305296,
+    0xe665bf91, 0x8eae38b1, 0x6e6339b4, 0x4ed3ed10, 0xb51b99df, 0x0220867a,
+    0x1f20a559, 0xd39c782f, 0x86454648, 0xffaed9a2, 0x3a52a3e3, 0x3e263839,
+    0xdfdc0d37, 0x716c98d2, 0x4b1359ce, 0xaa827300, 0xce374249, 0xcc435236,
+    0x53bf093f, 0x19dad4a3, 0x94ded08d, 0x506f8b3c, 0x212c0a31, 0x9b9dd98c,
+    0xa4b4cde8, 0xb61a681a, 0x0f8aa5fc, 0x61d07209, 0xfcb23c20, 0x2c10f25d,
+    0x7ebb27ed, 0xed5da3c0, 0xc2ceebe4, 0x9d6e911e, 0x5f631446, 0x57abce48,
+    0x99a51abd, 0x1c654d2e, 0x28879248, 0xca0931ca, 0xada8032d, 0xebbd12cc,
+    0x00a0c77f, 0x28afbdd4, 0xf6358780, 0x653bf06f, 0x75f4af37, 0xb0bd0e1e,
+    0xedb38104, 0xd6352e04, 0x634e89b6, 0x05cde940, 0xb9ac60b0, 0x4b4e3e67,
+    0x121a38d7, 0x89ec378d, 0x8fd9b32a, 0xaed3d314, 0x304dba68, 0x7640877b,
+    0xd0cf4544, 0x38601442, 0x46d6be36, 0xfa7f66c6, 0xfb4ce564, 0xbe946d55,
+    0x7a1a1145, 0x69402e8a, 0xa21469cc, 0x206c731e, 0x0ace09c2, 0xe03054b0,
+    0x904b796b, 0xc70cf8ab, 0x26212577, 0x1660b856, 0xc9125693, 0x5f57ef52,
+    0x578a8b73, 0x91a919a2, 0xdb939b29, 0xf1595623, 0x4eb27364, 0x371b7eda,
+    0x81998985, 0x7db8cc73, 0x3ce3d86f, 0xa269d287, 0xb3619598, 0x8720a844,
+    0x18c3044e, 0x4643fe04, 0xe2dbaa48, 0x0c3ab5e6, 0x69880314, 0xd8418449,
+    0xc4d358ef, 0xad18eb78, 0x5ab9231e, 0x75537014, 0x9d56a5a2, 0x3a76d312,
+    0x2f58bbe1, 0xf81260c8, 0xa8a03496, 0xd4040e7b, 0x04cf7e09, 0x06f6af76,
+    0xf3884e89, 0x49c76797, 0x71678cb8, 0x8b7fea8f, 0xebb1a99f, 0xe8cd1013,
+    0x67f7b9ca, 0x2be3b0ba, 0xbef8922c, 0x67fb904c, 0x17dbefed, 0xb2633107,
+    0x8b774d92, 0x9ea2a6da, 0x37e8694d, 0x55781150, 0xd68c5229, 0x1e5ee811,
+    0x415d7120, 0xc9e61d02, 0xfdcdf94b, 0x848ae115, 0x7f310b7a, 0x44f0abb7,
+    0xa583b2c4, 0x0e7970a7, 0x0e69bef9, 0xdada5939, 0x9571a1c0, 0xf2fb27bd,
+    0x202a2cda, 0x35df1198, 0xcf72afee, 0x7e54e47c, 0x52908d31, 0xa121a308,
+    0xdeb6a9e1, 0xc59019c2, 0x4a580fa6, 0x1442f5ab, 0x87719568, 0x5d3d03de,
+    0x3b9819f3, 0x92490a7e, 0xb41dff2a, 0xbc2cae2a, 0x1e5ac76e, 0x6ad2b504,
+    0xe76b6e80, 0x2303f056, 0x6f51bf34, 0xe2f3a43c, 0xd18d7476, 0x9480849e,
+    0x477ef2e5, 0x59d8abcd, 0x8ea39bf1, 0x11f10837, 0x3127e108, 0xc00df909,
+    0xb8eb0a83, 0xe5b405ae, 0x13022013, 0x277d1ddc, 0xecef92e8, 0x6c099c0a,
+    0x622e0227, 0xba3e5f0c, 0xf78e4c98, 0xdc2eb422, 0x749e6f3a, 0x09af40a3,
+    0xac3e0a9b, 0x43c2b93f, 0x017ddcb7, 0x8259ed62, 0x9852a6d3, 0xa5af6d9e,
+    0x2961668e, 0x7ad84287, 0xc3b26c70, 0x32e55d00, 0x5e2c39d8, 0xf7308ed4,
+    0xe3709d67, 0xb495de6b, 0x68e7329c, 0x62ba1024, 0xb2871654, 0x2fb60376,
+    0x19e100f9, 0xef19659e, 0x80bd8464, 0xce52987e, 0x3d389d2c, 0x1b3bf513,
+    0xda36d8aa, 0x53e75944, 0x4f32cafa, 0x9938f998, 0xc848326e, 0xfd09ba88,
+    0x561127d8, 0x3d6432b2, 0x9107225e, 0x72e74dbd, 0x27e2b1cf, 0xa81ed5fe,
+    0xa33c6a70, 0x8da190c8, 0x0b6b4d56, 0x4c7ad661, 0xfa25cceb, 0x01aef9ae,
+    0x7bd4a183, 0xd1662a27, 0xd8e1b24f, 0xb8c72081, 0x4c35d777, 0x6f95170a,
+    0x82eef2bf, 0x240a088f, 0x3fdf5619, 0xe6579ac7, 0xb0275a82, 0xc38b907d,
+    0x1bfb65e2, 0x12009a72, 0xe1268e5b, 0x5a925c5b, 0x6a115832, 0x96d3be0d,
+    0xf9496539, 0xf45c8ea6, 0x78e33577, 0x31344f8d, 0xa17abb52, 0x78a31ae3,
+    0x08559b15, 0xa6459956, 0x93b0e290, 0x81a30bb5, 0x25b4950a, 0x41eeb99c,
+    0xca321b23, 0x0a7880fb, 0x552237e0, 0xdfb27a55, 0xef497f67, 0x9a912a20,
+    0x60aed054, 0x51d79325, 0xbbd58d6c, 0x18c6ac71, 0x11cb974e, 0xcd636272,
+    0x8de08fcf, 0xecefe362, 0x324e8bdb, 0x2d35ba3d, 0xd2c47928, 0x60e89d16,
+    0x44c95158, 0xb7695364, 0xc123b2b3, 0xd248bc7f, 0x5d60a287, 0x03778376,
+    0x9bf2f87d, 0x4f6f7539, 0x2abfa244, 0x8fb93cf8, 0xaf0edeeb, 0xabaad5c6,
+    0x02b038cd, 0x709e8401, 0xf5efa782, 0x3fb12bb6, 0x77794662, 0xfe39fd70,
+    0xcd9177c2, 0x888bae65, 0x5196e154, 0x4abe7ac4, 0x9691e41a, 0x04e0b88e,
+    0x23eef189, 0xd7884945, 0xa7d83fb5, 0xfbe59d68, 0x0dde45a2, 0x39553f1c,
+    0xfe0f9fbc, 0x774d28ee, 0x7cd9af57, 0xafd45a59, 0xe42c5df4, 0xcbfdaaef,
+    0x6d3054a4, 0x1d9804ec, 0xb6975498, 0x56b7bbbb, 0x1c99a60e, 0x9c8f57a1,
+    0x85a2658e, 0xb1ae8532, 0x382d6e33, 0x64e327b6, 0xdc73b3bb, 0x29beaafe,
+    0x4963abe0, 0xeae4b656, 0xf110a6b8, 0xa3baad1c, 0x7250ef43, 0x7cc07fe7,
+    0xab4b9f3a, 0x366f810d, 0x07faa9b6, 0xf0dda0f2, 0x9f36c5da, 0xd9e80ac6,
+    0x2d94791f, 0x0db98481, 0xc7fc1a44, 0x47913cdd, 0x58a376e8, 0x86c204a6,
+    0xd57cd393, 0xe105c278, 0x43a765dc, 0x21c8c1b9, 0x88158d95, 0x68251537,
+    0x35356d75, 0xbf3d2500, 0xbc6c2167, 0x904c1afd, 0x15fdb5c3, 0x5e74f9d2,
+    0xe95b72ff, 0x170ac524, 0x645d06da, 0xc6f31657, 0xc06ac914, 0xbd134967,
+    0x5c0489f7, 0x6b179b81, 0x9a47b19c, 0x22e96e62, 0x2b92d781, 0xe3036685,
+    0xaeaa0292, 0xc4660555, 0x036caa21, 0x159c9ab4, 0xf4e9a006, 0x5c108379,
+    0x76a93985, 0x93f747e5, 0xee5b59e8, 0xf306e0e1, 0x61ec36e4, 0x340d7e37,
+    0xba3a65fb, 0x7fdc1986, 0x10c2a813, 0xa0de5476, 0x8cd18885, 0x851fbcda,
+    0x33d8cd6f, 0x45ff2c8f, 0xd31ceea8, 0x0fe2e3f3, 0x45fd5333, 0xdbd5bc1b,
+    0xf8b8a1a7, 0x9f3cb70c, 0x79db73af, 0x54cf577f, 0xa01dfcdf, 0x1f97bfd9,
+    0x09697f63, 0xc80c70a3, 0x92f81164, 0xe9b9e6f0, 0x244e539e, 0x2aed1623,
+    0xcb452ba3, 0x669ca790, 0x54ea40f3, 0xb3422670, 0xd9c36be6, 0xd52ad21d,
+    0x4d6f0f75, 0x0745bb62, 0x83c841b5, 0x486aca5d, 0x3e5726d7, 0x8a782253,
+    0xb19457cc, 0xac307d72, 0x1a47d411, 0x7439035e, 0xe0fa4634, 0x3b3ad68c,
+    0x6be29697, 0xf90891f0, 0xd44f6987, 0x8ccc3007, 0x42c89c9b, 0x4d96664b,
+    0x8943808d, 0x00084667, 0x34d22989, 0xd03d0a30, 0xbd70852c, 0xfca4d069,
+    0x1458cc70, 0x3c19ad94, 0xe83db258, 0x73b011a3, 0x65fa00f3, 0xa9802387,
+    0xf010dc77, 0xcfd4a955, 0x732ccb0f, 0x1a96628c, 0xaac812e3, 0x522b458f,
+    0x06421c64, 0x98fcada3, 0x9e50935f, 0xb5bf2b16, 0x2c6186df, 0x63456b26,
+    0xc6dda0d5, 0x2e9a73b8, 0x59862906, 0xeef54eb4, 0xe5587229, 0xa4ee0709,
+    0x6cfd56b7, 0x7bd6b3e2, 0xb7adc860, 0x3307dbe5, 0x1d342b21, 0xf68b7143,
+    0x84863e46, 0xdd0b1006, 0x3949bfa1, 0x085000a8, 0xdd23ede5, 0x42708dd2,
+    0x4868127f, 0x83e22ed1, 0xcc2a3f03, 0xe463e8c4, 0x5098e37b, 0x261da1c7,
+    0x971b1f29, 0x6d601501, 0x2223a8e4, 0xbbfbd9a3, 0xa61668de, 0x95d3a4db,
+    0x0ca87345, 0x58e06fb3, 0xff617ec1, 0x10317fb5, 0x7d5bda56, 0xc1f275ea,
+    0xdf5c7860, 0xaa523641, 0x4bcdc848, 0x7190eab3, 0x86a2670f, 0x3ea95f86,
+    0x3ab82093, 0xff7cd14b, 0xb5a553f2, 0xd37b4b1c, 0x1fc3756a, 0x02937489,
+    0xe6d243f9, 0x4e0845a7, 0x6e853782, 0x8e488cf3, 0xfc314435, 0xed9b5592,
+    0x7e147d8b, 0x2cc273ad, 0xa45f8a93, 0x610a5ef3, 0x0f3f63ff, 0xb6aaa971,
+    0x9462c366, 0x9b3cfa3c, 0x219c4b62, 0x50ebd337, 0xcea5285d, 0x19478806,
+    0x534c0612, 0xcca04bf0, 0xea040875, 0x80f944fc, 0x6654781c, 0x4047ca63,
+    0xbfe7f3e5, 0x0bbf902c, 0x163a00e7, 0xde7b3e06, 0x8a028d81, 0xf5b78ca2,
+    0x360cac90, 0x30da297f, 0xd7f6bf23, 0x792d574d, 0x40109c5f, 0xa7dbaab1,
+    0xc544f818, 0xc2ad1ac1, 0x5bb5d590, 0x13387183, 0x9c039767, 0x5b6750ae,
+    0x2e51d527, 0x973f3710, 0xa9e25f8b, 0xb98f7b47, 0x055f0689, 0x6ef4bd86,
+    0xf26ec340, 0x25ec2e02, 0x7092c743, 0xe756e4a5, 0xc9d43d9a, 0x915b0ef2,
+    0x576a1cad, 0x5fd50506, 0x90f0931d, 0x16bc8421, 0x26b38e23, 0xc7b23950,
+    0xa28176ed, 0xe0b0f893, 0x0a607fff, 0x20bd96c4, 0xfbaaeb3f, 0x6992283f,
+    0x7ad0dd81, 0xbe1b9ef9, 0xe2050238, 0xd8fe334c, 0x697ef6dd, 0x0cfdcd35,
+    0xb3e3cdcf, 0x46fb28f5, 0x184f9bd4, 0x879b9f50, 0x812f8682, 0xa2fca91c,
+    0x3c4932ff, 0x7d547891, 0xdb01be86, 0x37d3443c, 0x4e690837, 0xf1e09d32,
+    0xf6a898b2, 0xb00b06a2, 0x754e0c4f, 0x65a9b305, 0xad4df2f5, 0x280f8537,
+    0x001b4d19, 0xeb195547, 0x993dce64, 0xca9f1ddc, 0x28164c93, 0x1cd807f2,
+    0xc2612b6d, 0x571cd32f, 0x5fbed1f3, 0x9dd38a7f, 0xd06d902f, 0xfaa431a3,
+    0x4619235f, 0x38961f0c, 0x8f749d7e, 0x768e92a7, 0x30d96f31, 0xae372373,
+    0xb93eb8fa, 0x89019a3d, 0x12b639b6, 0x4be25588, 0xed218ee8, 0x0538a00c,
+    0x63976f24, 0xd6bd9c70, 0xcfd15117, 0xa19ac90a, 0x523d0b65, 0x7e84edb5,
+    0x95c913b2, 0x3552cb1c, 0x20ca11f1, 0xf2275846, 0xa53c3699, 0xda71aea0,
+    0x0e9f2a2a, 0x0e97f0c2, 0xfd793639, 0x4419eefe, 0x7f97faea, 0x8405a765,
+    0xe7fab45a, 0xe26425f1, 0x6f9dcdf0, 0x23e9b847, 0xb4e11e52, 0x6a0534e6,
+    0x1eb4d6a3, 0xbc82ba3e, 0x87c9d77c, 0x929a1d07, 0x3b34d65c, 0x5da8a6fe,
+    0xde6d9223, 0x14bbb8c7, 0x4a948eab, 0xc52f70fd, 0xf31c6316, 0x8babdc23,
+    0x71f8dc4b, 0x49795143, 0xa826f649, 0x06460fb3, 0x0437329f, 0xd483c8a2,
+    0x9dffc12c, 0xf8d538d6, 0x2fb9b545, 0x3af937a9, 0xc463149c, 0x75a4e0c6,
+    0x5a3fb281, 0xada49beb, 0xd615eafb, 0xc929a987, 0x41af8ee2, 0x1ef5fc0f,
+    0x8bf49105, 0x55917f65, 0x37109e5c, 0x9e4a2733, 0xbe4ca2c0, 0xb2c6850a,
+    0x1764e043, 0x6712daa8, 0xeb77e081, 0x2b277ca5, 0x6740d5e4, 0xe87b6d82,
+    0xdac82b92, 0x99f26127, 0x4fa7eed4, 0x53768cfb, 0x8020d1df, 0x1be7569a,
+    0x3de3f108, 0xce9d9297, 0xb2154616, 0xefd007b4, 0x193e4f6f, 0x2f555cca,
+    0xe3baf282, 0x622268dd, 0x68286eb2, 0xb42c223b, 0xfac7b2ed, 0xd1f39f0c,
+    0x7b61ba7b, 0x01335a70, 0xa3eb2583, 0x4cf528cc, 0x0ba4ecd6, 0x8d4ae89d,
+    0x91c79fd3, 0xa896db0b, 0x27180078, 0x7268a17a, 0xc891f04a, 0x3d84b4f5,
+    0x56c1bdc3, 0xfdd7efd2, 0xec0edfba, 0xbab5b5ba, 0x62889de5, 0x6c8f98a4,
+    0xb8216097, 0x27cefdcb, 0x13fdb490, 0xe514b248, 0x8e1b8a43, 0xc0d67885,
+    0x31894702, 0x1115e67b, 0xd15bc5b7, 0x595eb3ef, 0x47b80198, 0x941d3b31,
+    0xc342f712, 0xf7c59486, 0x5ece49e6, 0x32161515, 0x9898a35f, 0x7a2d7314,
+    0x29c1370d, 0xa55cd264, 0xaca66dd5, 0x82a04944, 0x01a32f26, 0x43095886,
+    0xf72c266f, 0x094653d2, 0x74450b9c, 0xdcfc5860, 0xd244f48f, 0xb7d00df8,
+    0x444e558f, 0x6015f081, 0x8d4f0c80, 0x2dabd5d9, 0x32fefb31, 0xec05a334,
+    0xbb3c0ac1, 0xcd9872be, 0x117d3184, 0x1853bb52, 0xef822b20, 0x51198145,
+    0x604c7e84, 0x9a2a7bcf, 0xf542d695, 0xfeda1379, 0x77bca3ca, 0x3f5766c3,
+    0xaf8b6096, 0x705b8a86, 0x023d0831, 0xab5b6f91, 0x9b53dba5, 0x8f7ce54e,
+    0x2a1f97b4, 0x4fd51666, 0xc18f9222, 0x038e93e1, 0x5d83eb78, 0xd2fe987e,
+    0xe1bf298b, 0x963e05d5, 0x6abbcd56, 0x5a73f45f, 0xb0e4ea84, 0x12e7a1a0,
+    0x1b45a25d, 0xc322e416, 0x824e730f, 0xe69e8fc2, 0x3f00d67a, 0x24852c7f,
+    0xd86f3389, 0x6f0b05e8, 0x4cd91c9d, 0xb87e706b, 0xcade0a97, 0xdf6e9a37,
+    0x55fc1b13, 0x0aa59dd5, 0x935da714, 0x4167d884, 0x25282c01, 0x81481337,
+    0xa1b33942, 0xa6d9ea79, 0x08820fd8, 0x782b79f9, 0xf9a6c720, 0x31f07747,
+    0x7825e2ee, 0xf4f09c95, 0xc735b828, 0x86465167, 0x585e8bc6, 0x4739e6cf,
+    0x9fdc05cd, 0x0d606264, 0x2d241621, 0xd906e8cd, 0xab9a4270, 0xf060c308,
+    0x07792687, 0x36c5e850, 0xf19f4edc, 0x7c408c26, 0x72f8bca0, 0xa311d736,
+    0xe9d54993, 0xc67b229b, 0x6486f1b5, 0x17aab2a3, 0xbcc417d2, 0x5e81b283,
+    0x1563b744, 0x90f81fa5, 0x88e33123, 0xbfb31e16, 0x35e6f1e0, 0x68c1f286,
+    0xd5848d10, 0x2138c44e, 0x437f7579, 0xe1f7a3a1, 0xfed18039, 0xaf2d48e3,
+    0x7c09478f, 0x77a8ef41, 0xa7627b9b, 0x39ffdabc, 0x0d047a81, 0xfb4be69e,
+    0x963b61c7, 0xd716707a, 0x237f6bb5, 0x0463f1f9, 0xcd095d70, 0x4a1f89ae,
+    0x511f0eb9, 0x88585bb5, 0xdcdff93c, 0xea073168, 0x49d30882, 0x290de644,
+    0x85223a62, 0x6426faab, 0x38b17585, 0xb1713f53, 0xb66311a5, 0x9c1ebb97,
+    0x1c14fdd2, 0x5634af8c, 0xe4f762ae, 0x1d6bc506, 0x6d964c99, 0xcb59e203,
+    0xdcf68769, 0xa3f0bf8c, 0x1b733065, 0x5ee2b347, 0x91c19271, 0x18f9987a,
+    0x5bc5641d, 0xe3a24030, 0xae1d0afb, 0xc185352f, 0x79c93e20, 0x33085306,
+    0xe597900c, 0x684b6cea, 0x20e55ab9, 0x8131dd2f, 0xfa081c26, 0xf06bf238,
+    0x3122619b, 0x0cd899a7, 0xba87b03c, 0x472f8f5a, 0x6ba6f3d0, 0xbcdf00cb,
+    0x8b9b64fe, 0x9b52bd20, 0x4353fdca, 0x7790a772, 0xcd4ec7c4, 0x284367bc,
+    0x0c5280b4, 0xd36b5251, 0xe9cb85d1, 0x8f80333b, 0x2c97cdd0, 0x665170e1,
+    0xa44e9480, 0x3cdfc654, 0x74d01a43, 0xcd736f8b, 0x9ec8e792, 0xe9838600,
+    0x51b599da, 0x10845fe6, 0xd38f6fe0, 0x551ffeb9, 0x17b6ff69, 0xaebb2abd,
+    0xc0f3b5b2, 0xd9bed5f6, 0x00e96116, 0x23168471, 0x827a4e92, 0x7f8205f3,
+    0x4f905b36, 0x90fa7d66, 0xb5ad84c9, 0xb14c4dbd, 0x65191eca, 0x49814061,
+    0xf38f6ff5, 0x05fb3871, 0x38d7cc54, 0xfd05313e, 0xc97e2df6, 0x9553cc33,
+    0x0a944731, 0x7b55e0a7, 0x8fbf9289, 0x2402cd4a, 0x440b6f11, 0xde786499,
+    0xbf61b89a, 0xfbab8fd0, 0x6dbf0994, 0x015460db, 0xfcaaf47c, 0x4f83ada0,
+    0x34c28466, 0xb5793de9, 0xe1e461c2, 0xc898a50f, 0x2546a1bc, 0x388e6512,
+    0xa92b254e, 0x61205b57, 0x7fad7017, 0x8b7295bf, 0x94137e3e, 0xa8fd7e83,
+    0x5d341640, 0x5036e729, 0xdb0aed2c, 0x149295fc, 0x1d92d7f8, 0xec716359,
+    0xf41fe6e8, 0xbbea0052, 0x3eff793f, 0x40bab41c, 0xb1829a24, 0x0b8c6068,
+    0x61e3498a, 0xf58e51db, 0x854b22ae, 0xd7b265b7, 0x4be53f27, 0x2e0acf28,
+    0xc75e6ea7, 0x736b5de4, 0x06f44c14, 0x9c13476d, 0xd69af9ec, 0xe7fb27d0,
+    0x13fbc238, 0x1c28336d, 0x9b4dc16e, 0x5be318f4, 0x56d07253, 0xa4888687,
+    0xa2fb9804, 0x84a27acc, 0x73c04bb6, 0x6e582827, 0xedffffe6, 0x354c52e8,
+    0x2b768f34, 0xc47f41f0, 0xc5ebd6f7, 0xb7280539, 0x04bdb5f3, 0x4c1e8848,
+    0x879d8f38, 0x03d425b5, 0x4848ba0e, 0xf98b514d, 0xb3712cb3, 0xdcfd1906,
+    0x63624342, 0x27980aed, 0xf63258a3, 0x79853449, 0x3dd3e7ed, 0x97f1c49d,
+    0xef68be67, 0xee9b974a, 0x280c2472, 0x168d832f, 0xa145c353, 0x5277e115,
+    0x705e47b5, 0xaa87d623, 0x9888fa75, 0x89e09afb, 0x5418405f, 0x62e78151,
+    0xd5c48d10, 0x3ae6ece6, 0x11496ed1, 0xca270f2f, 0xfee1fef5, 0x9f72b53d,
+    0x3696da1e, 0x701fa15b, 0xbc4df1f5, 0x2d7549b7, 0x6f9bcdaa, 0xd4f5ae33,
+    0x8dc7843b, 0xf66f35e7, 0x461efd84, 0x08595bb4, 0xcbc7b07a, 0x435c77a4,
+    0x086e48df, 0xb8648fdb, 0xd8793195, 0xc710b538, 0x1e53c329, 0x3796e8cb,
+    0x97f685fe, 0x6dced59e, 0x5ea351ae, 0x87f9df67, 0xab5daaed, 0xa7afeedc,
+    0x7c4f3b62, 0x592da49a, 0xe24a8e94, 0x1f35ec6c, 0x26ef7617, 0xe5ff0a31,
+    0xd177a1a2, 0x82cc8152, 0x156632d5, 0x6a6d03e1, 0x9c8e93d5, 0x31815f3c,
+    0x52477000, 0xc39db53f, 0xa71b1a14, 0xe19d8485, 0x77f37ae4, 0x1ac80d2b,
+    0xeb951771, 0x5d606572, 0x2f567707, 0xa1787fcd, 0xf139c30f, 0xd17b4b32,
+    0x3b316b41, 0x2bddbf45, 0xb7f1eee5, 0x74a9471e, 0x676ba9f5, 0x98490785,
+    0x808e9646, 0xbf48b567, 0x4cb4ddca, 0x4527f43f, 0xc32d3c1b, 0x0e0419a2,
+    0x025e421a, 0xf23ba7fd, 0xe7f1e88e, 0xacf2d4a6, 0x22d6d063, 0x567cff78,
+    0xac810d9b, 0x12c39778, 0x7a83dd5e, 0xea86c626, 0x923b687c, 0xcfad3546,
+    0x582fcc72, 0x3e6c27a0, 0xdfc31723, 0x659af33b, 0x1829af0c, 0x8c5838f2,
+    0xceafe99b, 0xffa8c78e, 0x0ed727f8, 0x06724ab3, 0x88f053b3, 0x4be566ae,
+    0x409eaa28, 0xb2e9d3b1, 0xb86a1a4a, 0x920fe692, 0x687c67bc, 0x7cc81adb,
+    0xf996e644, 0x202bc069, 0x33947ad8, 0xdbec0842, 0xd4113b1e, 0xbd204828,
+    0x101c4358, 0x46ebb6a9, 0x996b9b30, 0x0d7166c1, 0x552fb01f, 0xf175b5fe,
+    0xa0f01994, 0xd2207d35, 0x7108b1c9, 0x29a81dd2, 0xee945089, 0x768549ef,
+    0x29ddbecd, 0x9a9e2ce6, 0xf7647dc1, 0xe23b5f4f, 0x3cacf688, 0x1994f8fa,
+    0xb234d2bf, 0x5fdc62b5, 0x62f5bb34, 0xa2cd37c8, 0x86b5b9a2, 0x8068a80a,
+    0x49be3ed3, 0x69a95e3b, 0xc45cfa69, 0x3244fafb, 0x05f07c5a, 0xc0f3d283,
+    0xe349015a, 0x91408912, 0x27478ca5, 0x7e9fd7b4, 0xaa01dc51, 0x2288f6d1,
+    0x7dd657ba, 0xd8ac0720, 0x9683e592, 0xfcb28412, 0x5f54fa73, 0x049dc99d,
+    0xd9aa9f1a, 0x48b461fa, 0x1fc0a31b, 0xb01454da, 0xca970676, 0xccc76d83,
+    0x09d3b8b8, 0x3d7d3663, 0x8c595389, 0x67c955ac, 0x47010e6a, 0x8e334424,
+    0xbd67e19b, 0xafb7c9cc, 0x6e2a60b4, 0x541e7cab, 0xffa5a0c1, 0x11f2ff29,
+    0x37554bb7, 0xe82b8b9f, 0xc2d3287b, 0x8ae372da, 0x033d3d2f, 0x609ad4f4,
+    0x81f1901a, 0x39385e7e, 0x4d0a0eab, 0xc904cda5, 0xb62f1ab5, 0xedf6b6fb,
+    0x662bfd38, 0x15f7ba8a, 0xf067476f, 0x51136b16, 0x3a422375, 0xa969305e,
+    0xeaad8a25, 0xdf8ee180, 0x2ea62aa7, 0x2515ddee, 0xa691b48d, 0x7a9fd231,
+    0x76024ae8, 0x94b2579a, 0x9d489659, 0xb41e908b, 0x53eff0d3, 0x4e3a1638,
+    0xd082971c, 0x00ca4a21, 0x14e8a7a4, 0xfa21e76a, 0xf8fbb38a, 0xa5858fdf,
+    0x32c868a6, 0x5ac6d8a7, 0xb9a2a5f4, 0x1db52494, 0x698a10e3, 0xe6c56675,
+    0x8970f952, 0xc5fda6b8, 0x41119307, 0x34694971, 0xcf1a03d8, 0x6fe7f885,
+    0x0fb95e37, 0x856a831a, 0xde1bcaaa, 0xf432cfd3, 0x1969765c, 0x0a77c29b,
+    0x93e1fbfc, 0x41cf9d87, 0x59c51c34, 0xbae6b6e4, 0xad248734, 0x9de06807,
+    0x7b8fd04e, 0x72f8c1b2, 0xe61c3d06, 0x2f93f46a, 0x2372778c, 0xd6636d4e,
+    0xcc18ea80, 0xab23d5e2, 0x0dc9450a, 0x53b2b817, 0x8a512bfa, 0x175de806,
+    0x428b8da5, 0xefe00772, 0xbb84032d, 0xcbaf6fc2, 0x6a74525a, 0x3b984811,
+    0xfbb6ef7b, 0x63904f85, 0x303b61c9, 0x88d3cdf7, 0xe47c3437, 0xf8eb0ac6,
+    0x2158fa1e, 0x0277b053, 0xaf8dd7f4, 0x4d8016d1, 0x78f6fa24, 0xb6d07db2,
+    0x906ca236, 0x9606e826, 0x5a02daff, 0x78b00fae, 0xddc8b40c, 0x26357fcc,
+    0x1ae19d06, 0xdd1b8252, 0xf2251d0b, 0x8693570d, 0x39c6843b, 0x6cf2df90,
+    0xb4759981, 0x367852fd, 0x64d6ef78, 0xc65869f6, 0x830cb4c4, 0xe4264a55,
+    0x4e64c971, 0x1e4c8ff5, 0xc1d0564b, 0x58578629, 0x01812d9d, 0xa6bd47ca,
+    0xd2d97897, 0xd5745673, 0x167324d6, 0x2c64ba4b, 0x9feac6a4, 0x713823b7,
+    0x50aeb4ba, 0x9e52af65, 0xa56e9d24, 0xb90f0e37, 0x75096fbe, 0x4241e7fb,
+    0xe8c67b6b, 0x09ff4858, 0x2d65c067, 0xf7c18da2, 0xda378eb9, 0x9983f068,
+    0x1c7c34f4, 0x758bbbc8, 0x95c783b8, 0x2a59b5af, 0x5cc0d6d5, 0xd060c7df,
+    0xa89a62a8, 0xf3878ec3, 0x7e1767f5, 0x0fc94038, 0xe0f42b79, 0x44d0d7d5,
+    0x242d82c9, 0xbe99a5bf, 0xfdc94907, 0xc2b079b1, 0x351438e7, 0x30b6f48e,
+    0xbef7cba0, 0x6b368983, 0x6c75cbf9, 0x832a886f, 0x8eb8a6b1, 0xa0c5f381,
+    0x45e80342, 0x5cc369e5, 0xc854fa14, 0x1b44f81e, 0x0b3a704b, 0xe0dbebf9,
+    0xec4522af, 0xb3eec7bf, 0x2ac20be5, 0x4ada6083, 0xa3b44037, 0x079fbf41,
+    0x727434c9, 0xfe91c324, 0x9a4cd359, 0xdac5f564, 0x57f5b69c, 0x21cfeca0,
+    0xd751d7ef, 0x7d240efb, 0x1208799f, 0x9331492b, 0xc63d7ecc, 0xebe6e575,
+    0x0724dacf, 0x13e2b1da, 0x8420f8ee, 0x57769492, 0x4ad57bb8, 0xada6200b,
+    0xb03cdb7d, 0x8d22caf2, 0x608745e7, 0x647863b6, 0xf5a7340a, 0x3f807df8,
+    0x3fdf1715, 0xcec85659, 0xd341681d, 0xae0c4ded, 0x1718af82, 0x55a30a90,
+    0x9e69a8e3, 0x107df195, 0x51444017, 0xe978728f, 0xa48fb40f, 0xcd813f5f,
+    0x74249ef1, 0x3c063a25, 0xe95f0734, 0x66c22c40, 0x2c198701, 0x8f59c0f2,
+    0xf3417b51, 0xfd87be3c, 0x38566c41, 0x0504d150, 0xb569cff9, 0x4974e279,
+    0x6596ff7a, 0xb184e2e7, 0x82de8adf, 0x9019d913, 0x4f73ab06, 0x7f429d42,
+    0xc0709617, 0x23d7d72d, 0x0031e3e0, 0xd94e2c5a, 0xe53e4826, 0x81b94091,
+    0x205f6953, 0x68b1ff21, 0xae9042ac, 0x33b4f7eb, 0x79388161, 0xc121ef79,
+    0x91305b42, 0xe36504d4, 0x5b2c0ee8, 0x18797bdb, 0xdc21460d, 0x5e18d4c3,
+    0x1bcf1bfc, 0xa32495ae, 0xcdb0c1d1, 0xd3aee4b3, 0x0cee3eb4, 0x28e12507,
+    0x8b310093, 0x7735bc7e, 0x43b4e2ed, 0x9b8d9456, 0xba04a583, 0xbc21f5ad,
+    0x6b69919b, 0x479048a6, 0xfa8ae600, 0x0c317925, 0x31f92534, 0xf08f83ac,
+    0xc7a73982, 0x9c8d5875, 0x0615c99d, 0x73996825, 0x85cb5908, 0x2e918559,
+    0x4b481346, 0xd7689207, 0xb1610d7c, 0xf50bdfa4, 0x615d2236, 0x0b7501e5,
+    0xf4fb8bc6, 0x40629ca3, 0x3e42dfe1, 0xbb265802, 0xed25504c, 0xc4e2b407,
+    0x2be5671c, 0x35c4472e, 0xa223de6b, 0x6eacb344, 0x7339dcde, 0x843c31ed,
+    0x9bf52ef0, 0xa4102cd3, 0x5618f8da, 0x5b2ee8f9, 0xd64bc471, 0x1cd23bb6,
+    0x1368c65e, 0xe756402a, 0xfc123e2e, 0xb5f46e31, 0x34709942, 0x4f21612d,
+    0xbfe29b97, 0x01d67ef1, 0x6d654d31, 0xfb1e45e7, 0x8f237c54, 0xdeec2e25,
+    0x44ab0d92, 0x24cc1b7c, 0xc9c38ec8, 0x7baacbc3, 0x0a67462e, 0x95fdd408,
+    0xdbf5bd89, 0xec9bee6a, 0x1d10ed12, 0x14563644, 0x94b50c1b, 0x50fdce56,
+    0x5dbb8791, 0xa81d1989, 0xa9dca6fa, 0x8b9624cf, 0x7f10d848, 0x61a502b8,
+    0xe16dc0a9, 0x382b7da1, 0x25ddcf84, 0xc8741fc7, 0xcb482d75, 0xb8c51351,
+    0x08a1cbfd, 0x43f820cd, 0x8d18c390, 0x08edd5a3, 0x46a81157, 0xf6888de9,
+    0xbcf4be03, 0xd4434e2b, 0x6f3cc99a, 0x2dfccfd7, 0xfe3f9a10, 0x70a62f57,
+    0x366297d1, 0x9fbdaaf0, 0xe2ede304, 0xe513cd5b, 0x2615b950, 0x1f86886f,
+    0xabf5eba1, 0x59a99328, 0x7cdd85da, 0xa764865f, 0x9716d6e5, 0x873a82b1,
+    0x5e3ea5cf, 0x6d72e4d9, 0xd88b8551, 0x374d68b6, 0x1e9426f7, 0xc7912d5d,
+    0xf6dba535, 0x97780d21, 0x3d2fcac4, 0x7975ab83, 0xb3d00bbc, 0x270ab4c0,
+    0x63a616d9, 0xdc0519e3, 0x871c49cc, 0xf9201574, 0x48f7c8d5, 0x03622ccb,
+    0xc54ac332, 0x4cd6c0ef, 0x044c15a8, 0xb7c65c89, 0xd5652274, 0xcad33e20,
+    0x11834791, 0x3a4b4304, 0x982a219b, 0x6263b7c5, 0x54c41a10, 0x8974dab8,
+    0xa1a8a60d, 0xaa43f1df, 0x70e9596d, 0x52d51d54, 0xeffb1b2c, 0x162493e4,
+    0x28ec957e, 0xee51e10a, 0xdf0da028, 0x8c8c8725, 0x18d6793d, 0x6529a0bc,
+    0x929ef070, 0x3ec7b33c, 0x58da0a5f, 0xcf7bcd62, 0xac43a932, 0xea4444bc,
+    0x7a2ba09d, 0x127dad05, 0xe720c157, 0x56ebb269, 0x2251f715, 0xac452d44,
+    0xf94ee924, 0xdb6c5737, 0x3351dffc, 0x20f6f3d2, 0xb8d5eeef, 0x7c32770b,
+    0x68fa9253, 0x92adbf46, 0x8845b0f0, 0xb2193c0a, 0x4002dd2c, 0x4b7c471c,
+    0xce7bdf4f, 0x06eccaa9, 0x0e7c7072, 0xff6daed5, 0xeb3d401c, 0xa1f48441,
+    0x2fb9bd7c, 0x5dd4d501, 0xa7916da1, 0x1a61583f, 0x77255e74, 0xe1681de0,
+    0x9c5f5ff7, 0xc37dfef7, 0x529a9ae0, 0x31239286, 0xd18ccfe1, 0x6abeefeb,
+    0x15ba3f82, 0x82700a87, 0xc3b38110, 0xf2e9f0e1, 0x02cea4a0, 0x0ec22816,
+    0x8078bc4b, 0x45e3ce25, 0x4c343501, 0xbff0be69, 0xb7092d20, 0x98f12d44,
+    0x67f97fa2, 0x740289d1, 0xf1e81aa2, 0x2b4f8c29, 0x3bb5dadc, 0xd1cecd00,
+    0xd94b5df4, 0xb0f5ca0f, 0x1f5a5f22, 0x485fd033, 0x96086ec1, 0x0428cb1a,
+    0x5f8a2636, 0xfc1ed54c, 0xaafc6e9b, 0xd8475deb, 0x7d694943, 0x220115fc,
+    0xe3b3e51e, 0x7e48cd21, 0x27ba6a57, 0x91db622e, 0xff04d758, 0xe8e57174,
+    0x37c1e573, 0x116f7592, 0xbde282d4, 0x54bb1b5a, 0x6ec21bef, 0xaf4e68e4,
+    0x8ce1ae13, 0x8ee45369, 0x47c210ed, 0x6744d51b, 0xca012521, 0x3df5627e,
+    0x0901c0a0, 0xcc764d76, 0xee44e87f, 0x9a57abdc, 0x293754e6, 0x76428c42,
+    0xa06f4593, 0x294d757c, 0x71b3c592, 0xd29a608e, 0x99b200ff, 0xf1e6c5c4,
+    0x55d294a7, 0x0dd474cf, 0xd4df723e, 0x4666ceaf, 0x10bcf721, 0xbd9eb901,
+    0xc4a74b47, 0xc0171a77, 0x05731da3, 0x32a2e390, 0x8610430c, 0x690a6971,
+    0x491728d0, 0x80877eba, 0xb2826843, 0xa25b7122, 0x6277bae3, 0x5f513108,
+    0xf7f51ab1, 0x194e321c, 0x3c2b8561, 0xe2b07cbd, 0xcfd4ee28, 0x85b0e827,
+    0x0f701e93, 0x6f788679, 0x89d3dc34, 0x34d82b3c, 0x41c0e5e8, 0xc5765e25,
+    0xb90c4be6, 0xe64d19ca, 0x6960715f, 0x1d7f4df0, 0xf8115607, 0x5a30634f,
+    0x326eaec8, 0xa553409a, 0xe6ef025a, 0xd6f6d4a9, 0x23f6d290, 0x2f7fdf3a,
+    0xad913e4b, 0x721c27b3, 0x7b01e329, 0x9d513a70, 0x9313f557, 0xba604b2a,
+    0x59076d9f, 0x410acd1d, 0xde9aa632, 0x0a89ec9e, 0x199f3682, 0xf4cd840e,
+    0xf0e11d73, 0xa9892cb6, 0x3ab071b8, 0x519a426b, 0xb6eedb05, 0x1548fbd1,
+    0x66a80cff, 0xed1e9208, 0x816f625c, 0xc9a7a79c, 0x4dc336cd, 0x39e93f0a,
+    0xc22f09bf, 0x602c4a3f, 0x03b372f0, 0x8a327d5a, 0xd0661491, 0xfab1fa27,
+    0x14025013, 0x00072a93, 0x9da4a8cc, 0x4ee42e05, 0x532eadcd, 0xb4a4cfde,
+    0xa66c09c8, 0x9403caaa, 0x76f357a3, 0x7a436a85, 0xea606a2e, 0x2596d0af,
+    0x2e6a9be9, 0xdf2eadf2, 0xc106072d, 0xa6209d65, 0x014bbeca, 0x58e0eafc,
+    0x83b0a4a3, 0x1ef9f512, 0x4eaf9486, 0xe4ecc9ad, 0xb4897ea8, 0xc6f16c14,
+    0x642da858, 0x36894aed, 0xf29b50ed, 0x6c5e67e6, 0x390cea84, 0x8605c0d5,
+    0xe8030386, 0xf766c728, 0x2dd24eff, 0x0943608b, 0xa58b1b32, 0x42c13ecf,
+    0x75ff20c6, 0xb9ea0dd1, 0x9f4309c9, 0x9e9919f9, 0x501e5458, 0x7195bff8,
+    0xd250d386, 0x2c9ce367, 0x16ef368d, 0xd5a7802c, 0xfb2f7202, 0x88465382,
+    0x308b2886, 0x631475f9, 0xbb246374, 0x3b2a6f0e, 0x6acfda15, 0xcb78cc67,
+    0x8afca9ff, 0xef46fa71, 0x42558c1e, 0x17fee155, 0xccbb297c, 0x53125eac,
+    0x0d2cf919, 0xabf0c768, 0xdd26e35a, 0xddc2bb7f, 0x1a79c4d5, 0x26faefa0,
+    0x90db64f8, 0x7831f7a8, 0x5af03e68, 0x968dc04a, 0xaf013ad1, 0xb605a326,
+    0x78114b6d, 0x4d1512d6, 0xe4d3ed1b, 0x02f0247b, 0x21fdc21d, 0xf80e8ac5,
+    0xd78c61dd, 0x93cc5c04, 0x12bfb5c8, 0x7d9fa91d, 0x9ab35bc0, 0x2101917c,
+    0x574c839c, 0xda37ae40, 0xa304811e, 0xfe09d8a1, 0x72da6962, 0x0700fd5c,
+    0xecb7ed1b, 0x4a006d61, 0x2a5a0bad, 0xb3234be2, 0xf56d8795, 0xce207f88,
+    0x3f3f291b, 0x3f1c7b45, 0xb0cfde30, 0x64a73b66, 0x607a482a, 0x8d9e2e49,
+    0x84941628, 0xad4bdd43, 0x4a0e9444, 0x57e3e95f, 0xc6f775e0, 0x135b0595,
+    0x0783e83c, 0xeb408682, 0xe002a76c, 0xbe51fca7, 0x2490988a, 0x44685c7b,
+    0xa87a2e63, 0x0f59f5ba, 0x7e876308, 0xf34cfa63, 0x95086f92, 0xd083aa31,
+    0x5c1fae1b, 0x2a8d7dfa, 0xdadc63d9, 0x7579c68f, 0x1c97d4fd, 0x9965ddc9,
+    0xc89970d7, 0xe03a4762, 0x0bba0df1, 0x1bfbfa27, 0x8e64bf81, 0x5c43c980,
+    0x452bdf4d, 0xa0277a7b, 0xbe082a39, 0x8394050a, 0x6ccd426d, 0x6b840708,
+    0xfd1b841f, 0x303d835f, 0x35959957, 0xc2457a2b, 0xdb586e31, 0xa8605202,
+    0x1dfd99ad, 0x50872eab, 0x94676fa6, 0x141ae0ce, 0x5d78626e, 0xecfc0848,
+    0xa94b78cb, 0xc82fdff4, 0x7fedb8e6, 0x38698c70, 0xe1b65f0a, 0x61d9b10d,
+    0x2508877e, 0x8bd0eabe, 0xfce5e45c, 0xfb7f61ab, 0x34bd6276, 0x01b33738,
+    0xbf292a0a, 0x4f79144c, 0x6de442f9, 0xb586e6f6, 0x8ff42d8c, 0x95ba0886,
+    0x444763a0, 0x7be2bf51, 0xc9381149, 0x2494dd94, 0x0af20d18, 0xdea5c8ac,
+    0xedb6765e, 0x8471ae11, 0x2b0ec95f, 0x6ee6c184, 0xa2b1672f, 0x35b4149d,
+    0x73927f4e, 0xc4b2d8ee, 0x9b039236, 0xe73c8239, 0x56a550af, 0x1c9b5aaa,
+    0xd6e527e7, 0x5b6640a7, 0x139e76d1, 0xa4778fef, 0xc73023e0, 0xd72b014a,
+    0x06a0b754, 0x2ef339b4, 0x851ee246, 0x73c50e1d, 0x4ba8f8cc, 0x9cf02164,
+    0xb1fb9952, 0xbb6ec740, 0x61ab198f, 0x4026abbe, 0xf4517bb3, 0x0b276cb3,
+    0x3eb3e236, 0xf54a0308, 0xcd0c1861, 0x9be420fd, 0x0c1f2994, 0x77433e48,
+    0x8bdf0304, 0x28a8609f, 0x43098bd1, 0xd3f35425, 0xbad9b6fa, 0xf0fd1268,
+    0x6bcb7a20, 0x0c42d236, 0xfa6dd634, 0x47f47b82, 0x317257c3, 0xbc49bf02,
+    0xe5c80c70, 0xc16ab2fc, 0x2087bbaa, 0x33cc78f8, 0xae53b191, 0x68c6b223,
+    0x79a7b501, 0x81ce7c25, 0x919199f4, 0xa34c1e24, 0x5bb14477, 0x5e4ceedb,
+    0xdc8916a3, 0x1839882b, 0x1b2efae3, 0xe33953c6, 0xf3cb6ccc, 0xb1d6daec,
+    0x38804c38, 0x4915db80, 0xb5ceb065, 0x0551251d, 0x6549c1af, 0xfddf7e6f,
+    0x82162128, 0xd90fe734, 0x4fdf7570, 0x238aef49, 0xc0af5cb7, 0x7f02bf37,
+    0x00964df3, 0x907be741, 0xd3f23f6b, 0xe92016c8, 0x17f68d3e, 0x103ba80f,
+    0x9e9e280a, 0x55fdf367, 0x51d0c653, 0xae5063be, 0xa411b31e, 0x8f245322,
+    0x74a7c7e8, 0x6693891b, 0xe9bb2f47, 0x3c5e60a7, 0x2cead047, 0xcdc17d45,
+    0xc34234b0, 0xbf98cfbf, 0x0203e70e, 0x458d9e6a, 0x80f1ac19, 0x0e97bb8d,
+    0x4cfc4ac7, 0xf2996c04, 0xb7abdf88, 0xd19684e8, 0x672e5df9, 0x2b14a428,
+    0xf17510e5, 0x74621d23, 0x3b4c7d8b, 0x9885c8d0, 0xebf46586, 0xe13d1abb,
+    0x2f384425, 0x1a033f2c, 0xa74defc2, 0x5d8ee2bd, 0x77835da2, 0xa1add100,
+    0x9cf707a6, 0x8225f8b3, 0x5228fda6, 0x6ada5dc3, 0xd10a18c3, 0x317b7eb3,
+    0x152ade83, 0xc31c95ae, 0xf9cd92cb, 0x92c37763, 0x33ee02bb, 0x7c4fb7a6,
+    0xb8165658, 0x20bfcdfe, 0x68032081, 0xdb072ced, 0x889f4938, 0xff319c9b,
+    0x40c0cc88, 0x068429cf, 0xcec95ec7, 0x4b1f6870, 0x0ea37c94, 0xb256d961,
+    0xdf9d3546, 0xcf10d02a, 0x1863f397, 0x3e8517ac, 0x924d2ca3, 0x655716eb,
+    0x585431d7, 0x8cc25fe4, 0xacd03f68, 0xac145789, 0x7af67465, 0x569cb9a2,
+    0xe7b62a91, 0x1220f8ea, 0x22af3044, 0xea3f989a, 0xd5b394e2, 0x8931561d,
+    0x1126261e, 0x620130c6, 0x98c2b970, 0x3a3a6b37, 0x54579a69, 0xcab04692,
+    0xa1038398, 0xee1c1023, 0x701eb3bd, 0x167d3380, 0xef032d0e, 0x5290d80e,
+    0x285e8060, 0xaa3fe209, 0xf67bfdb4, 0xdc7e619d, 0x3dbc9073, 0x275e7285,
+    0xb331e75c, 0x7936831e, 0x633ab18c, 0x970f3970, 0x87d82b59, 0xb7b34e5e,
+    0x48387c3c, 0x4c9663f4, 0xc5b733fd, 0x033360c1, 0x04ddc48a, 0xf966aeb5,
+    0xe21f90f9, 0xa708bb32, 0x268f86b6, 0x59e9572b, 0xab064c66, 0x1fe30262,
+    0x7c2e9a1f, 0xe5631477, 0x97996f4f, 0xc7dbb855, 0x5edb5f26, 0x372a012e,
+    0xd80d8297, 0x6d09b022, 0x1e3d328c, 0x874df538, 0xcba108ee, 0xf6e0e7fe,
+    0x081796c5, 0x08a4f61c, 0x8d9a3acc, 0x43869807, 0x464b579c, 0xb89436f1,
+    0xbc2680dc, 0x9fca168b, 0x6ff32cf8, 0x70fd03c9, 0xfea7cb03, 0x2db5b61f,
+    0x36ebd7c8, 0xd41663fd, 0xd0cba6d4, 0xb4cc95fc, 0x14a30d55, 0x4eaa2ad2,
+    0x9d2c9b17, 0x00652319, 0x5381d2c3, 0xfafc2e8b, 0xa6fb17bb, 0xdf72856c,
+    0x7644d302, 0x25fbf731, 0xeaf218c6, 0x7a26802d, 0x2ecda815, 0x947e41c4,
+    0xf009792f, 0xed425432, 0x3a1f926f, 0x150a2bf7, 0xb67bc82a, 0x51c01058,
+    0x667fac8d, 0xa9c9ab27, 0x8196dc6d, 0x8a4c0d6d, 0x4d45e550, 0x607bddc5,
+    0xc28a8a56, 0x39875cbe, 0x0371f86a, 0xc9d8a646, 0xe67a9eaf, 0x9d102714,
+    0x232f24ee, 0x726afb91, 0xad42c810, 0x2f07b488, 0x7be84277, 0xd6a74e15,
+    0x93a87a72, 0xf4aeb3dc, 0x59a1ed6d, 0x0ad91ba2, 0xde6023ab, 0x416ce31c,
+    0x19159370, 0xba27ebbd, 0xcf41e061, 0xc5109661, 0x0ff81568, 0x34bbd526,
+    0x89304359, 0x6f07021b, 0x4143e46e, 0x85f93b6d, 0xb9c4eb44, 0xa530165b,
+    0x69ea6371, 0x5a5135c0, 0xf8b7042b, 0x1d3cfb25, 0x32bcac1a, 0xe63ed7c5,
+    0xc426d5c2, 0x80e9a8d4, 0x059bfef1, 0x69710a34, 0x86e62408, 0x32d95215,
+    0x49d4eb73, 0xc054fcef, 0xb24869e1, 0xe2df766a, 0x62aa6566, 0x19077e66,
+    0xf72947ab, 0x5f391dd0, 0x3cf70245, 0xa231c62b, 0xeee587b7, 0xd2f9b0a8,
+    0x29ab0bda, 0x292c9d59, 0xa094b08c, 0x76334bb1, 0x716705c6, 0x9a323578,
+    0x992c204a, 0xbdd78516, 0x5550ac8c, 0x461c1952, 0xd462fbc4, 0x0d9587b0,
+    0x1063496e, 0xf1b6f5c7, 0xfffa2260, 0xaf191cb1, 0x37192341, 0x54ec1caa,
+    0xbd357d12, 0x112dc713, 0x6e464177, 0xe8a60ce8, 0x8c0c0738, 0xcc16b921,
+    0x477d9e55, 0x3dba1a04, 0xcaf128f2, 0x6702df74, 0x09942a8b, 0x8e8bf0d0,
+    0xd9ca02aa, 0xfc77b93c, 0x1f84f630, 0x044da1af, 0x96fc044b, 0x481e9dc0,
+    0x5f22d846, 0xb0ac4aa0, 0xaa4719c6, 0x919a7a9c, 0x7dad520a, 0x7e2e65e2,
+    0xe312c954, 0x22549b62, 0x273b884b, 0xd8372d27, 0xc81b12f2, 0xa04a5973,
+    0x0b44a954, 0x5c1efc04, 0x8ed198d3, 0x1ba75bd5, 0x45a0fc77, 0xe07f632f,
+    0xbe8d50e4, 0xc2282685, 0x6c3b9dab, 0x304d65ef, 0xfda0294a, 0x6bdaf6d2,
+    0x356ae2da, 0x83ead19b, 0xe09c47be, 0xf3210a60, 0x244df081, 0x0f10b5fa,
+    0xa8c45a47, 0x4415af30, 0x7e497878, 0xbe3fa8b9, 0x958194e8, 0x99306e26,
+    0x5ca1a2a6, 0x75047a4b, 0xda59cc23, 0x2ac8db3e, 0x1c305af2, 0xd0c329bd,
+    0xf5dd35df, 0x8de303ae, 0x3fa428f4, 0x64d7b525, 0xb046e4f4, 0x3f7842c7,
+    0x60cde21c, 0xce6e7800, 0x8443761b, 0xeb0e81ce, 0x4a9cfa88, 0x13116858,
+    0xc65a2066, 0x57aa8161, 0x0775cc04, 0xad03c908, 0xd73b26e7, 0xda5802b3,
+    0x126483e3, 0x217adefe, 0x9a1aff65, 0x7df57d55, 0x57b5f8fb, 0x9382ad7d,
+    0xa3f1a3f2, 0xb3416be7, 0x7217eedf, 0x4a47f20b, 0xec1e16a8, 0x075b7483,
+    0x2ab3130d, 0xfe765449, 0xdda80b30, 0x96d2ea77, 0x1a90e816, 0x785139db,
+    0x9025a8ce, 0x26879507, 0x5a70a89e, 0xdda522bb, 0xafecfda5, 0xf85aeb7b,
+    0x78a18be0, 0x028b3027, 0xe40d1721, 0x4d4680a6, 0x2120ff44, 0xb67c83b3,
+    0xfbf1c602, 0xcb1af160, 0x30417a58, 0x3b725cef, 0xbbee3343, 0x6344baae,
+    0x6a3d76a2, 0x88133ca9, 0x8a391c95, 0xab876d49, 0x42fe02c9, 0x53761032,
+    0xcc42e30a, 0x17b06ace, 0x0d8c16ea, 0xef24a620, 0xe88f2039, 0xb9b34067,
+    0x2d2bf0a1, 0x42a856df, 0xa53345a2, 0x09266ea8, 0x7571ae71, 0xf702aca7,
+    0x9f897c7a, 0xd5d97576, 0x50dcd5b7, 0x2cee67c0, 0xd2a042a2, 0x71fa61ca,
+    0x161a6163, 0x9ecd30b1, 0xc19397f1, 0xe4810e12, 0x01d5258f, 0x1eb14f54,
+    0x834c3fe0, 0x58938672, 0x4e015a64, 0xa664818f, 0xb424fb88, 0x865f03c8,
+    0x64b4d116, 0x6c1ac836, 0xf2587be1, 0x36fc3e92, 0x3993a22e, 0xc6ae087c,
+    0xd62aa55e, 0xa4f45d95, 0x1335190f, 0x5ba105fb, 0x9b98f642, 0x1c729ddb,
+    0x5665ab27, 0xe7942a90, 0xa264f981, 0xc4384d2c, 0x737fa937, 0x35264b86,
+    0xed71af43, 0x6e10e876, 0x2bb5b640, 0x84f2ead2, 0xf4ac933f, 0xf5e91e17,
+    0x3e219fc3, 0x0bed9cf0, 0xb11951ff, 0x40e3d04a, 0x6100178f, 0xbbafac53,
+    0x85ae5141, 0x9c4fcd75, 0x4b25a098, 0x7331cd86, 0xc7d58da5, 0x2e550862,
+    0x0664e647, 0xd7edcea0, 0xe12bc5f9, 0x8b398e54, 0x2586bad0, 0x615dd59e,
+    0xa98a3823, 0x38f5feb6, 0x7f694fc5, 0xc8eee651, 0x94d2d225, 0xec28a9d9,
+    0x5dc5c918, 0x14e5cb16, 0xdba589b7, 0x506dcf6c, 0x1d7a27cd, 0xa894b7d3,
+    0xc998f744, 0xde38e202, 0x0a39da81, 0x2460de45, 0x8f61aab7, 0x7b1bfb37,
+    0x44fbcd1d, 0x953b1e84, 0xbf928d8b, 0xb52f5db7, 0x6d24c6ba, 0x4fec19f3,
+    0xfc5b51c4, 0x01297f97, 0x343d9833, 0xfbc434c7, 0xc00e911a, 0x90ba8a10,
+    0x004317c4, 0x7fcb067e, 0x828566a2, 0x23483bc5, 0x4f0e8c66, 0xd9c97aae,
+    0xb52e5ad8, 0xfd706508, 0x65ef9dd5, 0x05927a57, 0xf3137167, 0x49edfa84,
+    0x383e7f86, 0xb12b07af, 0xe90fa945, 0xcd2c5061, 0x2c681cf4, 0x3c9f4605,
+    0xa4c2a55d, 0x661689f2, 0x746e311a, 0x8fdd17ac, 0x9e2c90cb, 0xaec13f31,
+    0x510c5084, 0x5553b06f, 0xd338c9cf, 0x10e1fd89, 0x177c0258, 0xe9c47ca7,
+    0xfaeb4725, 0xbcab1ebb, 0x31bdef92, 0x47768248, 0xba478ade, 0x0ca61f16,
+    0x6b1e6d56, 0xf02e38de, 0x8b601f06, 0xd32519c0, 0x43ebdaf9, 0x2801d1ab,
+    0xcdd9468e, 0x77fbbd2f, 0x0ca5aed0, 0x9b3d84e0, 0xdc493a14, 0xe3c3e07b,
+    0x1bb026f7, 0x188b416c, 0x917d6545, 0x5eab45ff, 0x5b4ac55e, 0xa3ade969,
+    0xaef8f393, 0x8171ca1d, 0x7952d444, 0x680f4d1b, 0xe54a2a9f, 0x33687204,
+    0x20265845, 0xc1cd5ca1, 0xce2adc39, 0xb28cd0c5, 0x0e3949b1, 0x4b886475,
+    0x881227f0, 0x06227ea6, 0x404da7a5, 0xffe89f49, 0xb891bda3, 0xdbb14df0,
+    0x68aa7b91, 0x20437a59, 0xf9057d5a, 0x7c9f8211, 0x33288e4b, 0x9254121e,
+    0xe77b7a36, 0xeaeda9a9, 0x220f1d7f, 0x1286402f, 0xac0ac785, 0x560d4003,
+    0x7a4f59f4, 0xac83eab9, 0x92ff01fc, 0x8c3d7473, 0x588abf25, 0x65f241f5,
+    0xdf6527df, 0x3e3d4a4c, 0x18b49513, 0xcfeb41b9, 0xf1a1c785, 0x981904db,
+    0x3bf72314, 0x74e4205e, 0xb7666ac0, 0x2b99a79e, 0x6794154e, 0xd1390798,
+    0x802f5cf8, 0xf27be944, 0x4c57c31c, 0x0e7e3701, 0xc3c07bad, 0x457f17d3,
+    0x0299fdba, 0xbf1bea13, 0xd1e3f257, 0xc3d01027, 0x15cc7f81, 0x31c392b6,
+    0x9c3d631d, 0x6a0cc3a9, 0x52f1b6c6, 0x82968b86, 0xa7cda9ec, 0xa10275b1,
+    0x775191b9, 0x5d03defc, 0xeb68bafc, 0x1a8bd718, 0x2fcb8cab, 0xe1d48a4a,
+    0xd8faffd8, 0x87a9b232, 0x1ef6c2cc, 0x6daf047b, 0x975056dc, 0x37ca7fa2,
+    0x5e698ce6, 0xc74c8aec, 0xab818065, 0xe5b6ec30, 0x7c92ef95, 0x1f6685d0,
+    0xe29ff621, 0x59722c0d, 0x2658c72a, 0xa7e885c1, 0xfe4df428, 0xd4b71855,
+    0x3602334a, 0x2d083408, 0xbcb3c924, 0x704336ae, 0x6f5c14e0, 0x9f29db88,
+    0x8d4042bb, 0xb8324d6a, 0x46ed5c82, 0x430621bc, 0xcb103205, 0x08326598,
+    0x08d2e0b9, 0xf61800e9, 0xefbeb06b, 0xaaea1c25, 0x28bf16f0, 0x521d080f,
+    0xa1c13914, 0x16fac46e, 0x709a5e79, 0xeec9e80a, 0x986153d6, 0xca5759fd,
+    0x54a68a3b, 0x3a8e617b, 0xd50e81ef, 0x62a00049, 0x11c07c86, 0x89ac4ac7,
+    0xc513632c, 0xf9d1f022, 0x043da80e, 0x03b59e6c, 0x8778d589, 0x4c73f8d1,
+    0x48b46739, 0xb768794b, 0xb3b70602, 0x9788af63, 0x63fc7011, 0x79faf07f,
+    0xf6939d4a, 0x27f98c2b, 0x3d6414e7, 0xdc90c2da, 0xdec833b4, 0xba8591c6,
+    0x19c32bc2, 0x41875596, 0x93625a7b, 0x0a0987a3, 0x597fc107, 0xf4778df8,
+    0xadedf5f9, 0xd615d424, 0x7b55bf43, 0x2fdd5d2f, 0xe6809252, 0x72b12a91,
+    0x23be0fea, 0x9da67f98, 0xf85d1c58, 0xe695aadc, 0x322a0ea3, 0x1dc92b85,
+    0xb9751870, 0x5a85f3d6, 0x69254b7f, 0xa5eae98a, 0x89897430, 0x85376e60,
+    0x418fb672, 0x6f902307, 0xcfbc6411, 0x34165223, 0x0f100e2c, 0xc5b99257,
+    0xea0a29c8, 0x94d3387d, 0x2e3933b9, 0x7afb3fee, 0xa62176c1, 0x25703e89,
+    0x76b28ee7, 0xdfc8e495, 0x9dd73762, 0xfa6c888e, 0x53773a27, 0x009bd0f4,
+    0xd01190b3, 0x4e554bd0, 0x1472b6f0, 0xb456ef05, 0xc24e9a04, 0xc94c8cac,
+    0x03fe6598, 0x396a8e78, 0x813e0c3b, 0x60f2f187, 0x4da221a3, 0x8aa180b1,
+    0xb6a6ec7e, 0xa920cd3c, 0x66c5614a, 0x515ea4c2, 0xf0868900, 0x15b50817,
+    0x3ae1a918, 0xeda5ca7f, 0xca6b1bfc, 0x8e4bdea8, 0x0959c4be, 0x67a3d584,
+    0x8c9f8d2b, 0x3d17c672, 0x47b06254, 0xccb4428f, 0xbd857809, 0xe8461ee4,
+    0x6e89f8e7, 0x11a382aa, 0xff54c560, 0x544fbc68, 0x379ddcaf, 0xafe9c600,
+    0xe3faae7a, 0xd8ea866a, 0x27cedbcd, 0x22c4281e, 0xaab29cf6, 0x7ef8bbb4,
+    0x7d0e71e1, 0x913e93c0, 0x96765025, 0xb054233d, 0x5fefd630, 0x48ee8f83,
+    0xd921ba75, 0x04f42fba, 0x1f3dc9e6, 0xfcf7df5c, 0xf7811ecc, 0xa2a513f7,
+    0x3c494f94, 0x5fa2b63d, 0xb2ea9b0a, 0x19d3fe6b, 0x6214ee28, 0xe27bf25f,
+    0x8653d6af, 0xc0a6aa23, 0x49591b9e, 0x322ccbc5, 0xc4ed1431, 0x69c42a8c,
+    0x05003731, 0x800263f2, 0xd49f86a9, 0xf138369d, 0x10c43ffc, 0x0d187e76,
+    0x99cbf19d, 0x46806f39, 0x558226ee, 0xbd798495, 0xa03a4e21, 0x9ad81338,
+    0x71df76b3, 0x76d0f422, 0xee2990ab, 0x29efac94, 0x2978a2a7, 0xd27b2921,
+    0xc69b8f0d, 0xadc76972, 0x07c0773c, 0x57302c90, 0x84c974c5, 0x13834f94,
+    0x4a64b457, 0xeba93eee, 0xb091d677, 0xcea744e8, 0x600de689, 0x3ff1b6fa,
+    0xf51b7615, 0x642275f7, 0x3f477ff6, 0x8d77e924, 0xece4ecfd, 0xfec930bc,
+    0x2a0fce42, 0x07d17938, 0xa37b4d4b, 0x4aabc90c, 0x72a43681, 0xb3a7ec00,
+    0x9add98a6, 0x9361f8a6, 0x570f3758, 0x7d531396, 0xd7d7b7d2, 0x219cbd8f,
+    0x12ed877b, 0xda9e562c, 0xfd6f387a, 0x83504615, 0x35ca3314, 0x6b654719,
+    0xbe479584, 0x30d05713, 0x6c8ec345, 0xc2ce51dc, 0x8e154016, 0xe09da4cc,
+    0x45618e3a, 0x1b18d0fa, 0xc8ea7f3e, 0x5cb3073c, 0x0bd7aeb7, 0xa0891a89,
+    0xdabec365, 0xd01754aa, 0x1ce199d1, 0x2a2aa5cc, 0x955ec60b, 0x75faec15,
+    0x5c56a818, 0x99e34f6c, 0xa82e2895, 0xbee23ce7, 0x7ee4d067, 0x44ab8a87,
+    0xe04a4d8b, 0x0fa95e9b, 0x24f8a00d, 0xf3c12402, 0xd22723a1, 0x9e1bf5e7,
+    0x16bd83d0, 0x7145fd56, 0x9f127635, 0x2c32d2d8, 0x507af64d, 0xd503c50b,
+    0xa5eff280, 0xf780b819, 0x7582f9bf, 0x09b11cbc, 0xe86120d4, 0x423edc9b,
+    0x2dbdd4e2, 0xb961748e, 0xf2fd036f, 0xc6333052, 0x397e0ca6, 0x3625946d,
+    0xb4e88d2c, 0x6c85ab86, 0x646420cb, 0x86d880f8, 0x83ccecfc, 0xa6de9ce9,
+    0x4efb166a, 0x581cf445, 0xc14f75ce, 0x1e2dff6b, 0x013b164e, 0xe4459f79,
+    0xe48f2a84, 0xb69f49b1, 0x21b5fe70, 0x4dc8e9b8, 0xaf573135, 0x023382a0,
+    0x78602070, 0xf881d414, 0x90b4143b, 0xdd41f43f, 0x5abaadb7, 0x264e0048,
+    0xdd5181d1, 0x78cfdfbb, 0x1a23e07b, 0x966c74b2, 0xccfe78a2, 0xef9adca4,
+    0x0d784975, 0x173231ac, 0x8aa03971, 0x53c4540e, 0x423d962c, 0xab6d40cc,
+    0xbb5fc69b, 0x88b8ee1e, 0x6a932852, 0x63e42d0b, 0xfb75d62d, 0x3be80b9d,
+    0x30c0f20e, 0xcbcae5b1,
+};
+
+NORI_NAMESPACE_END
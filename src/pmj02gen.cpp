@@ -0,0 +1,261 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/pmj02.h>
+#include <nori/timer.h>
+#include <pcg32.h>
+#include <fstream>
+
+using namespace nori;
+
+/*
+ * Generates progressive multi-jittered (0,2) sequences (Christensen et al.,
+ * "Progressive Multi-Jittered Sample Sequences", EGSR 2018) and stores them
+ * as a ".pmj" table or as C++ source for the table compiled into Nori.
+ *
+ * The sequence grows in two alternating steps. When it has 4^k points,
+ * each of the 2^k x 2^k cells holds one point, and a new point is placed
+ * in the diagonally opposite subquadrant of its cell. When it has 2*4^k
+ * points, the two empty subquadrants of every cell are filled. Within its
+ * subquadrant, a new point is placed so that the points generated so far,
+ * together with the rest of the current batch, occupy every elementary
+ * interval of area 1/total at most once.
+ */
+class PMJ02Generator {
+public:
+    PMJ02Generator(uint64_t seed) : m_rng(seed, 0xda3e39cb94b95bdbull) { }
+
+    /// Generate one sequence with \c count points (a power of two)
+    void generate(uint32_t count, uint32_t *out) {
+        m_points.clear();
+        m_points.push_back(Point(m_rng.nextUInt(), m_rng.nextUInt()));
+
+        while (m_points.size() < count) {
+            uint32_t n = (uint32_t) m_points.size();
+            int level = log2i(n);
+            startBatch(2 * n);
+            if (level % 2 == 0) {
+                /* 4^k points: diagonally opposite subquadrants */
+                int cells = level / 2;
+                for (uint32_t i = 0; i < n; ++i) {
+                    uint32_t qx = subquadrant(m_points[i].x, cells) ^ 1;
+                    uint32_t qy = subquadrant(m_points[i].y, cells) ^ 1;
+                    addPoint(qx, qy, cells + 1);
+                }
+            } else {
+                /* 2*4^k points: fill the two remaining subquadrants */
+                int cells = (level - 1) / 2;
+                for (int pass = 0; pass < 2; ++pass) {
+                    for (uint32_t i = 0; i < n / 2; ++i) {
+                        uint32_t qx = subquadrant(m_points[i].x, cells);
+                        uint32_t qy = subquadrant(m_points[i].y, cells);
+                        if (pass == 0)
+                            addPoint(qx, qy ^ 1, cells + 1);
+                        else
+                            addPoint(qx ^ 1, qy, cells + 1);
+                    }
+                }
+            }
+        }
+
+        for (uint32_t i = 0; i < count; ++i) {
+            out[2 * i] = m_points[i].x;
+            out[2 * i + 1] = m_points[i].y;
+        }
+    }
+
+private:
+    struct Point {
+        uint32_t x, y;
+        Point(uint32_t x, uint32_t y) : x(x), y(y) { }
+    };
+
+    static int log2i(uint32_t v) {
+        int r = 0;
+        while (v >>= 1)
+            ++r;
+        return r;
+    }
+
+    /// Return the first \c bits binary digits of a fixed point value
+    static uint32_t digits(uint32_t v, int bits) {
+        return bits == 0 ? 0u : v >> (32 - bits);
+    }
+
+    /// Index of the subquadrant at resolution 2^(bits+1) along one axis
+    static uint32_t subquadrant(uint32_t v, int bits) {
+        return digits(v, bits + 1);
+    }
+
+    /// Prepare the elementary interval occupancy for a batch ending at \c total points
+    void startBatch(uint32_t total) {
+        m_total = total;
+        m_level = log2i(total);
+        m_occupied.assign((size_t) (m_level + 1) * total, false);
+        for (const Point &p : m_points)
+            mark(p);
+    }
+
+    /// Index of the elementary interval with 2^a columns and 2^(m-a) rows that contains \c p
+    size_t interval(const Point &p, int a) const {
+        return (size_t) a * m_total +
+            ((size_t) digits(p.x, a) << (m_level - a)) + digits(p.y, m_level - a);
+    }
+
+    bool isFree(const Point &p) const {
+        for (int a = 0; a <= m_level; ++a)
+            if (m_occupied[interval(p, a)])
+                return false;
+        return true;
+    }
+
+    void mark(const Point &p) {
+        for (int a = 0; a <= m_level; ++a)
+            m_occupied[interval(p, a)] = true;
+    }
+
+    /// Place a point in the subquadrant (qx, qy) at resolution 2^bits
+    void addPoint(uint32_t qx, uint32_t qy, int bits) {
+        /* The x and y strata of width 1/total within the subquadrant */
+        int strataBits = m_level - bits;
+        uint32_t strata = 1u << strataBits;
+        auto makePoint = [&](uint32_t sx, uint32_t sy) {
+            int shift = 32 - m_level;
+            uint32_t mask = shift == 32 ? 0xffffffffu : (1u << shift) - 1;
+            uint32_t x = (((qx << strataBits) | sx) << shift) | (m_rng.nextUInt() & mask);
+            uint32_t y = (((qy << strataBits) | sy) << shift) | (m_rng.nextUInt() & mask);
+            return Point(x, y);
+        };
+
+        /* Random candidates usually succeed quickly .. */
+        for (int attempt = 0; attempt < 256; ++attempt) {
+            Point p = makePoint(m_rng.nextUInt(strata), m_rng.nextUInt(strata));
+            if (isFree(p)) {
+                mark(p);
+                m_points.push_back(p);
+                return;
+            }
+        }
+
+        /* .. otherwise, search all strata in random order */
+        std::vector<uint32_t> order(strata);
+        for (uint32_t i = 0; i < strata; ++i)
+            order[i] = i;
+        m_rng.shuffle(order.begin(), order.end());
+        for (uint32_t sx : order) {
+            for (uint32_t sy : order) {
+                Point p = makePoint(sx, sy);
+                if (isFree(p)) {
+                    mark(p);
+                    m_points.push_back(p);
+                    return;
+                }
+            }
+        }
+        throw NoriException("PMJ02 generation failed at %i points!", m_points.size());
+    }
+
+private:
+    pcg32 m_rng;
+    std::vector<Point> m_points;
+    std::vector<bool> m_occupied;
+    uint32_t m_total = 0;
+    int m_level = 0;
+};
+
+/* Write the table as C++ source defining the table compiled into Nori */
+static void writeSource(const std::string &filename, const PMJ02Table &table) {
+    std::ofstream os(filename);
+    if (os.fail())
+        throw NoriException("Unable to open \"%s\" for writing!", filename);
+
+    os << "/* Generated by pmj02gen, do not edit */\n\n"
+       << "#include <nori/common.h>\n\n"
+       << "NORI_NAMESPACE_BEGIN\n\n"
+       << "extern const uint32_t PMJ02DefaultSetCount = " << table.setCount << ";\n"
+       << "extern const uint32_t PMJ02DefaultSampleCount = " << table.sampleCount << ";\n\n"
+       << "extern const uint32_t PMJ02DefaultPoints[] = {\n";
+    for (size_t i = 0; i < table.points.size(); i += 6) {
+        os << "   ";
+        for (size_t j = i; j < std::min(i + 6, table.points.size()); ++j)
+            os << tfm::format(" 0x%08x,", table.points[j]);
+        os << "\n";
+    }
+    os << "};\n\nNORI_NAMESPACE_END\n";
+    if (os.fail())
+        throw NoriException("Error while writing \"%s\"!", filename);
+}
+
+int main(int argc, char **argv) {
+    std::vector<std::string> args;
+    uint32_t setCount = 4, sampleCount = 1024;
+    uint64_t seed = 0;
+    bool source = false;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string token(argv[i]);
+            if (token == "--source")
+                source = true;
+            else if (token == "--sets" && i + 1 < argc)
+                setCount = (uint32_t) std::stoul(argv[++i]);
+            else if (token == "--samples" && i + 1 < argc)
+                sampleCount = (uint32_t) std::stoul(argv[++i]);
+            else if (token == "--seed" && i + 1 < argc)
+                seed = std::stoull(argv[++i]);
+            else
+                args.push_back(token);
+        }
+    } catch (const std::exception &) {
+        args.clear();
+    }
+
+    if (args.size() != 1 || setCount == 0 || sampleCount == 0 ||
+        (sampleCount & (sampleCount - 1)) != 0) {
+        cerr << "Syntax: " << argv[0] << " [--sets N] [--samples N] [--seed N] [--source] <output>" << endl << endl;
+        cerr << "Writes N sets (default 4) of a power-of-two number of PMJ02 points (default 1024)" << endl;
+        cerr << "to a .pmj table, or as C++ source (--source) for src/pmj02data.cpp." << endl;
+        return -1;
+    }
+
+    try {
+        PMJ02Table table;
+        table.setCount = setCount;
+        table.sampleCount = sampleCount;
+        table.points.resize(2 * (size_t) setCount * sampleCount);
+
+        cout << "Generating " << setCount << " x " << sampleCount << " points .. ";
+        cout.flush();
+        Timer timer;
+        for (uint32_t set = 0; set < setCount; ++set) {
+            PMJ02Generator generator(seed * setCount + set);
+            generator.generate(sampleCount, table.points.data() + 2 * (size_t) set * sampleCount);
+        }
+        cout << "done. (took " << timer.elapsedString() << ")" << endl;
+
+        if (source)
+            writeSource(args[0], table);
+        else
+            table.save(args[0]);
+    } catch (const std::exception &e) {
+        cerr << "Error: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/pmj02.h>
+#include <fstream>
+#include <cstring>
+
+NORI_NAMESPACE_BEGIN
+
+/* Defined in pmj02data.cpp, which is generated by pmj02gen --source */
+extern const uint32_t PMJ02DefaultSetCount;
+extern const uint32_t PMJ02DefaultSampleCount;
+extern const uint32_t PMJ02DefaultPoints[];
+
+static void checkEndianness() {
+    uint16_t probe = 1;
+    if (*((uint8_t *) &probe) != 1)
+        throw NoriException("PMJ02 tables can only be used on little endian machines!");
+}
+
+std::shared_ptr<PMJ02Table> PMJ02Table::load(const std::string &filename) {
+    checkEndianness();
+
+    std::ifstream is(filename, std::ios::binary);
+    if (is.fail())
+        throw NoriException("Unable to open PMJ02 table \"%s\"!", filename);
+
+    PMJ02Header header;
+    is.read((char *) &header, sizeof(PMJ02Header));
+    if (is.fail() || memcmp(header.magic, "PMJ2", 4) != 0)
+        throw NoriException("\"%s\" is not a PMJ02 table!", filename);
+    if (header.version != 1)
+        throw NoriException("PMJ02 table \"%s\": unsupported version %i!", filename, header.version);
+    if (header.setCount == 0 || header.sampleCount == 0 ||
+        (header.sampleCount & (header.sampleCount - 1)) != 0)
+        throw NoriException("PMJ02 table \"%s\" has an invalid size!", filename);
+
+    auto table = std::make_shared<PMJ02Table>();
+    table->setCount = header.setCount;
+    table->sampleCount = header.sampleCount;
+    table->points.resize(2 * (size_t) header.setCount * header.sampleCount);
+    is.read((char *) table->points.data(), (std::streamsize) (table->points.size() * sizeof(uint32_t)));
+    if (is.fail())
+        throw NoriException("PMJ02 table \"%s\" is truncated!", filename);
+    return table;
+}
+
+void PMJ02Table::save(const std::string &filename) const {
+    checkEndianness();
+
+    PMJ02Header header;
+    memcpy(header.magic, "PMJ2", 4);
+    header.version = 1;
+    header.setCount = setCount;
+    header.sampleCount = sampleCount;
+
+    std::ofstream os(filename, std::ios::binary);
+    if (os.fail())
+        throw NoriException("Unable to open \"%s\" for writing!", filename);
+    os.write((const char *) &header, sizeof(PMJ02Header));
+    os.write((const char *) points.data(), (std::streamsize) (points.size() * sizeof(uint32_t)));
+    if (os.fail())
+        throw NoriException("Error while writing \"%s\"!", filename);
+}
+
+std::shared_ptr<const PMJ02Table> PMJ02Table::getDefault() {
+    static std::shared_ptr<const PMJ02Table> table = [] {
+        auto table = std::make_shared<PMJ02Table>();
+        table->setCount = PMJ02DefaultSetCount;
+        table->sampleCount = PMJ02DefaultSampleCount;
+        table->points.assign(PMJ02DefaultPoints,
+            PMJ02DefaultPoints + 2 * (size_t) PMJ02DefaultSetCount * PMJ02DefaultSampleCount);
+        return table;
+    }();
+    return table;
+}
+
+NORI_NAMESPACE_END
@@ -32,6 +32,20 @@ public:
         return 1.f;
     }
 
+    virtual Color3f getPower() const override {
+        return power;
+    }
+
+    virtual LightBounds getLightBounds(float phi) const override {
+        /* Emits in all directions; the normal cone is the full sphere */
+        LightBounds lb;
+        lb.bounds = BoundingBox3f(position);
+        lb.phi = phi;
+        lb.cosTheta_o = -1.f;
+        lb.cosTheta_e = 0.f;
+        return lb;
+    }
+
     virtual std::string toString() const override {
         return tfm::format(
                 "PointLight[\n"
@@ -82,6 +82,7 @@ static void renderBlock(const Scene *scene, Sampler *sampler, ImageBlock &block,
     /* For each pixel and pixel sample sample */
     for (int y=0; y<size.y(); ++y) {
         for (int x=0; x<size.x(); ++x) {
+            sampler->startPixelSample(Point2i(x + offset.x(), y + offset.y()), (uint32_t) k);
 
             Point2f pixelSample = Point2f((float) (x + offset.x()), (float) (y + offset.y())) + sampler->next2D();
             
@@ -188,6 +189,15 @@ void RenderThread::renderScene(const std::string & filename) {
 
             cout << "done. (took " << timer.elapsedString() << ")" << endl;
 
+            /* Report the tracking statistics of the participating media */
+            for (const Shape *shape : m_scene->getShapes()) {
+                if (!shape->isMedium())
+                    continue;
+                std::string stats = shape->getMedium()->getStatistics();
+                if (!stats.empty())
+                    cout << "Medium statistics: " << stats << endl;
+            }
+
             /* Now turn the rendered image block into
                a properly normalized bitmap */
             m_block.lock();
@@ -0,0 +1,74 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/ris.h>
+#include <nori/scene.h>
+#include <nori/sampler.h>
+#include <nori/bsdf.h>
+
+NORI_NAMESPACE_BEGIN
+
+Color3f sampleDirectRIS(const Scene *scene, Sampler *sampler, const Intersection &its,
+                        const Vector3f &wi, int candidates, EmitterQueryRecord &lRec) {
+    const BSDF *bsdf = its.mesh->getBSDF();
+    Vector3f wiLocal = its.toLocal(wi);
+
+    /* The reservoir holds one sample and the sum of all candidate weights */
+    float weightSum = 0.f;
+    Color3f selected(0.f);
+    bool found = false;
+
+    for (int i = 0; i < candidates; ++i) {
+        float lightPdf;
+        EmitterQueryRecord cRec(its.p);
+        const Emitter *light = scene->getRandomEmitter(its.p, its.shFrame.n, sampler->next1D(), lightPdf, cRec);
+        Point2f sample = sampler->next2D();
+        float select = sampler->next1D();
+        if (!light || lightPdf <= 0.f)
+            continue;
+
+        Color3f Le = light->sample(cRec, sample); /* Radiance divided by the solid angle density */
+        if (cRec.pdf <= 0.f || Le.maxCoeff() <= 0.f)
+            continue;
+
+        BSDFQueryRecord bRec(wiLocal, its.toLocal(cRec.wi), ESolidAngle);
+        bRec.uv = its.uv;
+        bRec.p = its.p;
+        float cosTheta = std::abs(its.shFrame.n.dot(cRec.wi));
+
+        /* Contribution divided by the source density */
+        Color3f contrib = bsdf->eval(bRec) * Le * cosTheta / lightPdf;
+        float weight = contrib.getLuminance();
+        if (!(weight > 0.f) || !std::isfinite(weight))
+            continue;
+
+        weightSum += weight;
+        if (select * weightSum < weight) {
+            lRec = cRec;
+            selected = contrib / weight; /* Contribution divided by the target function */
+            found = true;
+        }
+    }
+
+    if (!found)
+        return Color3f(0.f);
+
+    return selected * (weightSum / candidates);
+}
+
+NORI_NAMESPACE_END
@@ -25,12 +25,20 @@
 
 NORI_NAMESPACE_BEGIN
 
-Scene::Scene(const PropertyList &) {
+Scene::Scene(const PropertyList &propList) {
     m_bvh = new BVH();
+
+    /* Strategy for choosing the emitter at a shading point ("power" or "bvh") */
+    std::string lightSampling = propList.getString("lightSampling", "power");
+    if (lightSampling == "bvh")
+        m_useLightBVH = true;
+    else if (lightSampling != "power")
+        throw NoriException("Scene: unknown light sampling strategy \"%s\"!", lightSampling);
 }
 
 Scene::~Scene() {
     delete m_bvh;
+    delete m_lightBVH;
     delete m_sampler;
     delete m_camera;
     delete m_integrator;
@@ -54,11 +62,106 @@ void Scene::activate() {
         m_sampler->activate();
     }
 
+    buildLightDistributions();
+
     cout << endl;
     cout << "Configuration: " << toString() << endl;
     cout << endl;
 }
 
+void Scene::buildLightDistributions() {
+    /* Lights whose power cannot be estimated fall back to the average
+       weight, so that they are still sampled */
+    auto build = [](const std::vector<float> &power, DiscretePDF &pdf) {
+        float sum = 0.f;
+        size_t valid = 0;
+        for (float p : power) {
+            if (std::isfinite(p) && p > 0.f) {
+                sum += p;
+                valid++;
+            }
+        }
+        float fallback = valid > 0 ? sum / valid : 1.f;
+        pdf.clear();
+        pdf.reserve(power.size());
+        for (float p : power)
+            pdf.append(std::isfinite(p) && p > 0.f ? p : fallback);
+        return pdf.normalize();
+    };
+
+    std::vector<float> power;
+    m_emitterIndex.clear();
+    for (size_t i = 0; i < m_emitters.size(); ++i) {
+        power.push_back(m_emitters[i]->getPower().getLuminance());
+        m_emitterIndex[m_emitters[i]] = i;
+    }
+    float emitterPower = build(power, m_emitterPdf);
+
+    if (m_useLightBVH && !m_emitters.empty()) {
+        for (size_t i = 0; i < m_emitters.size(); ++i)
+            power[i] = m_emitterPdf[i];
+        delete m_lightBVH;
+        m_lightBVH = new LightBVH(m_emitters, power);
+    }
+
+    power.clear();
+    for (size_t i = 0; i < m_emissiveMedia.size(); ++i)
+        power.push_back(m_emissiveMedia[i]->getPower().getLuminance());
+    float mediaPower = build(power, m_emissiveMediaPdf);
+
+    if (m_emitters.empty())
+        m_emitterFraction = 0.f;
+    else if (m_emissiveMedia.empty())
+        m_emitterFraction = 1.f;
+    else
+        m_emitterFraction = emitterPower / (emitterPower + mediaPower);
+}
+
+const Emitter *Scene::getRandomEmitter(const Point3f &p, const Normal3f &n, float rnd, float &pdf,
+                                       EmitterQueryRecord &lRec) const {
+    if (m_lightBVH)
+        return m_lightBVH->sample(p, n, rnd, pdf, lRec);
+    lRec.fixedPrimitive = false;
+    return getRandomEmitter(rnd, pdf);
+}
+
+float Scene::getEmitterPdf(const Point3f &p, const Normal3f &n, const Emitter *emitter,
+                           EmitterQueryRecord &lRec) const {
+    if (m_lightBVH)
+        return m_lightBVH->pdf(p, n, emitter, lRec);
+    lRec.fixedPrimitive = false;
+    return getEmitterPdf(emitter);
+}
+
+Color3f Scene::transmittance(const Ray3f &ray, Sampler *sampler, const Medium *medium) const {
+    Intersection its;
+    std::vector<MediumCrossing> crossings;
+    if (m_bvh->rayIntersect(ray, its, crossings))
+        return Color3f(0.f);
+
+    /* Walk the medium segments between the invisible interfaces */
+    Color3f result(1.f);
+    float tStart = ray.mint;
+    for (size_t i = 0; i <= crossings.size(); ++i) {
+        float tEnd = i < crossings.size() ? crossings[i].t : ray.maxt;
+        if (medium && tEnd > tStart) {
+            MediumQueryRecord mRec(ray(tStart), ray(tEnd));
+            result *= medium->Tr(mRec, sampler);
+            if (result.isZero())
+                break;
+        }
+        if (i == crossings.size())
+            break;
+        const MediumCrossing &crossing = crossings[i];
+        if (crossing.entering && crossing.medium)
+            medium = crossing.medium;
+        else if (!crossing.entering && crossing.medium == medium)
+            medium = nullptr;
+        tStart = tEnd;
+    }
+    return result;
+}
+
 void Scene::addChild(NoriObject *obj) {
     switch (obj->getClassType()) {
         case EMesh: {
@@ -126,6 +229,7 @@ std::string Scene::toString() const {
 
     return tfm::format(
         "Scene[\n"
+        "  lightSampling = %s,\n"
         "  integrator = %s,\n"
         "  sampler = %s\n"
         "  camera = %s,\n"
@@ -134,6 +238,7 @@ std::string Scene::toString() const {
         "  emitters = {\n"
         "  %s  }\n"
         "]",
+        m_useLightBVH ? "bvh" : "power",
         indent(m_integrator->toString()),
         indent(m_sampler->toString()),
         indent(m_camera->toString()),
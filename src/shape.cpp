@@ -73,6 +73,10 @@ void Shape::addChild(NoriObject *obj) {
     }
 }
 
+bool Shape::isNullInterface() const {
+    return m_bsdf && m_bsdf->isNull() && !m_emitter;
+}
+
 std::string Intersection::toString() const {
     if (!mesh)
         return "Intersection[invalid]";
@@ -0,0 +1,185 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/sampler.h>
+#include <nori/block.h>
+#include <nori/lowdiscrepancy.h>
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * Scrambled Sobol sampling - returns components of a randomized
+ * low-discrepancy sequence.
+ *
+ * Every 1D or 2D request is drawn from its own randomization of the
+ * first two Sobol dimensions (a "padded" sequence), so arbitrarily many
+ * components are available and the stratification does not depend on
+ * how many of them an integrator consumes. The randomization is keyed
+ * by the pixel, the index of the request within the sample and the
+ * \c seed property: the sample index is shuffled and the values are
+ * scrambled either with hash-based Owen scrambling (\c scramble="owen",
+ * the default) or with a random XOR (\c scramble="xor"). The sample
+ * count should be a power of two for the best stratification.
+ *
+ * With \c blueNoise=true, the pixels of each 64x64 tile share one
+ * sequence instead (Ahmed and Wonka, "Screen-Space Blue-Noise Diffusion
+ * of Monte Carlo Sampling Error via Hierarchical Ordering of Pixels",
+ * 2020): a pixel's samples are the consecutive points
+ * <tt>(rank << log2(sampleCount)) + i</tt>, where the rank is the
+ * Z-order (Morton) index of the pixel within its tile. Every aligned
+ * 2^k x 2^k square of pixels thus receives an aligned block of the
+ * sequence, i.e. a stratified point set, and the shuffling of the index
+ * randomly permutes the quadrants at every level for each request.
+ * Neighboring pixels then make complementary errors, which pushes the
+ * error into high screen-space frequencies. This mostly helps at low
+ * sample counts, e.g. for previews or denoiser inputs.
+ */
+class Sobol : public Sampler {
+public:
+    Sobol(const PropertyList &propList) {
+        m_sampleCount = (size_t) propList.getInteger("sampleCount", 1);
+        m_seed = (uint32_t) propList.getInteger("seed", 0);
+
+        std::string scramble = propList.getString("scramble", "owen");
+        if (scramble == "owen")
+            m_owen = true;
+        else if (scramble == "xor")
+            m_owen = false;
+        else
+            throw NoriException("Sobol: unknown scrambling method \"%s\"", scramble);
+
+        m_blueNoise = propList.getBoolean("blueNoise", false);
+        while (((size_t) 1 << m_log2Samples) < m_sampleCount)
+            ++m_log2Samples;
+        if (m_blueNoise && m_log2Samples > 32 - 2 * TileLevels)
+            throw NoriException("Sobol: the blue noise mode supports at most 2^%i samples per pixel",
+                                32 - 2 * TileLevels);
+    }
+
+    virtual ~Sobol() { }
+
+    std::unique_ptr<Sampler> clone() const {
+        std::unique_ptr<Sobol> cloned(new Sobol());
+        cloned->m_sampleCount = m_sampleCount;
+        cloned->m_seed = m_seed;
+        cloned->m_owen = m_owen;
+        cloned->m_blueNoise = m_blueNoise;
+        cloned->m_log2Samples = m_log2Samples;
+        cloned->m_pixel = m_pixel;
+        cloned->m_index = m_index;
+        cloned->m_dimension = m_dimension;
+        return std::move(cloned);
+    }
+
+    void prepare(const ImageBlock &block) {
+        m_pixel = block.getOffset();
+        m_index = m_dimension = 0;
+    }
+
+    void generate() {
+        m_index = m_dimension = 0;
+    }
+
+    void advance() {
+        ++m_index;
+        m_dimension = 0;
+    }
+
+    void startPixelSample(const Point2i &pixel, uint32_t index) {
+        m_pixel = pixel;
+        m_index = index;
+        m_dimension = 0;
+    }
+
+    float next1D() {
+        uint64_t hash;
+        uint32_t index = nextIndex(hash);
+        return fixedToFloat(scramble(sobolSample(index, 0), (uint32_t) (hash >> 32)));
+    }
+
+    Point2f next2D() {
+        uint64_t hash;
+        uint32_t index = nextIndex(hash);
+        uint64_t hashY = mixBits(hash);
+        return Point2f(
+            fixedToFloat(scramble(sobolSample(index, 0), (uint32_t) (hash >> 32))),
+            fixedToFloat(scramble(sobolSample(index, 1), (uint32_t) (hashY >> 32)))
+        );
+    }
+
+    virtual std::string toString() const override {
+        return tfm::format(
+            "Sobol[sampleCount=%i, scramble=%s, seed=%i, blueNoise=%s]",
+            m_sampleCount, m_owen ? "owen" : "xor", m_seed, m_blueNoise ? "true" : "false");
+    }
+protected:
+    Sobol() { }
+
+    /**
+     * \brief Return the shuffled sequence index of the next request
+     * along with the hash (of the pixel or tile, the current dimension
+     * and the seed) that randomizes it
+     */
+    uint32_t nextIndex(uint64_t &hash) {
+        Point2i key = m_pixel;
+        uint32_t index = m_index, pass = 0;
+        if (m_blueNoise) {
+            key = Point2i(m_pixel.x() >> TileLevels, m_pixel.y() >> TileLevels);
+            uint32_t rank = mortonIndex(m_pixel);
+            uint32_t mask = (1u << m_log2Samples) - 1;
+            index = (rank << m_log2Samples) | (m_index & mask);
+            pass = m_index >> m_log2Samples;
+        }
+
+        hash = hashCombine(mixBits(((uint64_t) (uint32_t) key.x() << 32) |
+                                   (uint32_t) key.y()), m_dimension++);
+        hash = hashCombine(hash, m_seed);
+        if (pass != 0)
+            hash = hashCombine(hash, pass);
+        return owenScramble(index, (uint32_t) hash);
+    }
+
+    /// Z-order index of a pixel within its tile
+    static uint32_t mortonIndex(const Point2i &pixel) {
+        uint32_t index = 0;
+        for (int level = 0; level < TileLevels; ++level) {
+            index |= (((uint32_t) pixel.x() >> level) & 1u) << (2 * level);
+            index |= (((uint32_t) pixel.y() >> level) & 1u) << (2 * level + 1);
+        }
+        return index;
+    }
+
+    uint32_t scramble(uint32_t v, uint32_t seed) const {
+        return m_owen ? owenScramble(v, seed) : v ^ seed;
+    }
+
+private:
+    /// The blue noise mode uses tiles of 2^TileLevels x 2^TileLevels pixels
+    static const int TileLevels = 6;
+
+    uint32_t m_seed = 0;
+    bool m_owen = true;
+    bool m_blueNoise = false;
+    int m_log2Samples = 0;
+    Point2i m_pixel = Point2i(0, 0);
+    uint32_t m_index = 0;
+    uint32_t m_dimension = 0;
+};
+
+NORI_REGISTER_CLASS(Sobol, "sobol");
+NORI_NAMESPACE_END
@@ -78,16 +78,57 @@ public:
         its.shFrame = Frame((its.p - m_position).normalized());
         its.geoFrame = Frame((its.p - m_position).normalized());
         its.mesh = this;
+        its.primIndex = 0;
     }
 
     virtual void sampleSurface(ShapeQueryRecord & sRec, const Point2f & sample) const override {
-        Vector3f q = Warp::squareToUniformSphere(sample);
-        sRec.p = m_position + m_radius * q;
-        sRec.n = q;
-        sRec.pdf = std::pow(1.f/m_radius,2) * Warp::squareToUniformSpherePdf(Vector3f(0.0f,0.0f,1.0f));
+        sRec.primIndex = 0;
+        float cosThetaMax;
+        if (!sRec.hasRef || !getConeAngle(sRec.ref, cosThetaMax)) {
+            /* No reference point outside of the sphere: sample the area uniformly */
+            Vector3f q = Warp::squareToUniformSphere(sample);
+            sRec.p = m_position + m_radius * q;
+            sRec.n = q;
+            sRec.pdf = pdfSurface(sRec);
+            return;
+        }
+
+        /* Sample the cone of directions subtended by the sphere and find
+           the nearest intersection along the sampled direction. The point
+           is placed through its angle at the center, which stays on the
+           sphere even for grazing directions */
+        Vector3f axis = m_position - sRec.ref;
+        float dist = axis.norm();
+        Frame frame(axis / dist);
+        Vector3f local = Warp::squareToUniformSphereCap(sample, cosThetaMax);
+        float sinTheta2 = std::max(0.f, 1.f - local.z() * local.z());
+        float t = dist * local.z() - std::sqrt(std::max(0.f, m_radius * m_radius - dist * dist * sinTheta2));
+        float cosAlpha = clamp((dist * dist + m_radius * m_radius - t * t) / (2.f * dist * m_radius), -1.f, 1.f);
+        float sinAlpha = std::sqrt(std::max(0.f, 1.f - cosAlpha * cosAlpha));
+        float sinTheta = std::sqrt(sinTheta2);
+        float cosPhi = sinTheta > 0.f ? local.x() / sinTheta : 1.f;
+        float sinPhi = sinTheta > 0.f ? local.y() / sinTheta : 0.f;
+        sRec.n = frame.toWorld(Vector3f(sinAlpha * cosPhi, sinAlpha * sinPhi, -cosAlpha));
+        sRec.p = m_position + m_radius * sRec.n;
+        sRec.pdf = pdfSurface(sRec);
+    }
+    virtual float getSurfaceArea() const override {
+        return 4.f * M_PI * m_radius * m_radius;
     }
+
     virtual float pdfSurface(const ShapeQueryRecord & sRec) const override {
-        return std::pow(1.f/m_radius,2) * Warp::squareToUniformSpherePdf(Vector3f(0.0f,0.0f,1.0f));
+        float cosThetaMax;
+        if (!sRec.hasRef || !getConeAngle(sRec.ref, cosThetaMax))
+            return std::pow(1.f/m_radius,2) * Warp::squareToUniformSpherePdf(Vector3f(0.0f,0.0f,1.0f));
+
+        /* Uniform density over the cone, converted to area measure.
+           The far side of the sphere is never sampled */
+        Vector3f d = sRec.ref - sRec.p;
+        float dist2 = d.squaredNorm();
+        float cosTheta = sRec.n.dot(d) / std::sqrt(dist2);
+        if (cosTheta <= 0.f)
+            return 0.f;
+        return cosTheta / (dist2 * 2.f * M_PI * (1.f - cosThetaMax));
     }
 
     //virtual void sampleVolume(ShapeQueryRecord& sRec, const Point3f& sample) const override {
@@ -104,6 +145,10 @@ public:
 
     virtual float pdfVolume(ShapeQueryRecord& sRec) const override { return std::pow(1.f / m_radius, 3) * 3.f / (4.f * M_PI); }
 
+    virtual bool contains(const Point3f &p) const override {
+        return (p - m_position).squaredNorm() <= m_radius * m_radius;
+    }
+
 
     virtual std::string toString() const override {
         return tfm::format(
@@ -126,6 +171,18 @@ public:
         return m_position.z() - m_radius;
     }
 protected:
+    /**
+     * \brief Compute the cosine of the half-angle of the cone that the
+     * sphere subtends as seen from \c ref; fails if \c ref is inside
+     */
+    bool getConeAngle(const Point3f &ref, float &cosThetaMax) const {
+        float sinTheta2 = m_radius * m_radius / (ref - m_position).squaredNorm();
+        if (sinTheta2 >= 1.f)
+            return false;
+        cosThetaMax = std::sqrt(1.f - sinTheta2);
+        return true;
+    }
+
     Point3f m_position;
     float m_radius;
 };
@@ -0,0 +1,437 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/shape.h>
+#include <nori/bsdf.h>
+#include <nori/emitter.h>
+#include <nori/warp.h>
+#include <nori/dpdf.h>
+#include <nori/timer.h>
+#include <nori/plyfile.h>
+#include <filesystem/resolver.h>
+#include <Eigen/LU>
+#include <fstream>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#  include <emmintrin.h>
+#  define NORI_SPHERESET_SSE 1
+#endif
+
+NORI_NAMESPACE_BEGIN
+
+/**
+ * \brief Large collection of analytic spheres stored as a single shape
+ *
+ * Centers and radii are kept in structure-of-arrays form. Spheres are
+ * sorted along a Morton curve and grouped into packets of four nearby
+ * spheres; each packet is one BVH primitive and is intersected with a
+ * single SSE kernel. The index of the sphere hit within a packet is
+ * passed from \ref rayIntersect() to \ref setHitInformation() through
+ * the \c u coordinate, like the barycentrics of a triangle mesh.
+ *
+ * The spheres are read either from a PLY point file (a "vertex" element
+ * with x/y/z and an optional "radius" property) or from a raw binary
+ * file with the following little endian layout:
+ *
+ *     char[4]    "NSPH"
+ *     uint32     version (1)
+ *     uint64     sphere count N
+ *     float[N]   x, followed by the y, z and radius arrays
+ *
+ * Spheres without a stored radius use the \c radius property.
+ */
+class SphereSet : public Shape {
+public:
+    SphereSet(const PropertyList &propList) {
+        filesystem::path filename =
+            getFileResolver()->resolve(propList.getString("filename"));
+        float defaultRadius = propList.getFloat("radius", 1.f);
+        Transform trafo = propList.getTransform("toWorld", Transform());
+
+        Timer timer;
+
+        std::vector<float> x, y, z, r;
+        if (filename.extension() == "ply")
+            loadPLY(filename.str(), defaultRadius, x, y, z, r);
+        else
+            loadBinary(filename.str(), x, y, z, r);
+
+        m_count = (uint32_t) x.size();
+        if (m_count == 0) {
+            throw NoriException("Sphere set \"%s\" contains no spheres!", filename);
+        }
+
+        /* Radii follow the (assumed uniform) scale of the transformation */
+        float scale = std::cbrt(std::abs(trafo.getMatrix().topLeftCorner<3, 3>().determinant()));
+        for (uint32_t i = 0; i < m_count; ++i) {
+            Point3f c = trafo * Point3f(x[i], y[i], z[i]);
+            x[i] = c.x(); y[i] = c.y(); z[i] = c.z();
+            r[i] *= scale;
+            if (!(r[i] > 0))
+                throw NoriException("Sphere set \"%s\": sphere %i has a non-positive radius!", filename, i);
+            m_bbox.expandBy(c - Vector3f(r[i]));
+            m_bbox.expandBy(c + Vector3f(r[i]));
+        }
+
+        buildPackets(x, y, z, r);
+
+        m_name = filename.str();
+        /* Print in one go, since several objects may be loading in parallel */
+        cout << tfm::format("Loading \"%s\" .. done. (N=%i, took %s and %s)\n",
+            filename, m_count, timer.elapsedString(),
+            memString(sizeof(float) * 4 * m_cx.size()));
+    }
+
+    virtual void activate() override {
+        Shape::activate();
+
+        m_pdf.reserve(m_count);
+        for (uint32_t i = 0; i < m_count; ++i)
+            m_pdf.append(4.f * M_PI * m_r[i] * m_r[i]);
+        m_pdf.normalize();
+
+        buildInsideGrid();
+    }
+
+    virtual uint32_t getPrimitiveCount() const override {
+        return (uint32_t) (m_cx.size() / PACKET_SIZE);
+    }
+
+    virtual BoundingBox3f getBoundingBox(uint32_t index) const override {
+        BoundingBox3f bbox;
+        for (uint32_t i = index * PACKET_SIZE; i < (index + 1) * PACKET_SIZE; ++i) {
+            Point3f c(m_cx[i], m_cy[i], m_cz[i]);
+            bbox.expandBy(c - Vector3f(m_r[i]));
+            bbox.expandBy(c + Vector3f(m_r[i]));
+        }
+        return bbox;
+    }
+
+    virtual Point3f getCentroid(uint32_t index) const override {
+        return getBoundingBox(index).getCenter();
+    }
+
+    virtual bool rayIntersect(uint32_t index, const Ray3f &ray, float &u, float &v, float &t) const override {
+        const uint32_t base = index * PACKET_SIZE;
+        float lanes[PACKET_SIZE];
+        float a = ray.d.squaredNorm();
+
+#if defined(NORI_SPHERESET_SSE)
+        __m128 ox = _mm_sub_ps(_mm_set1_ps(ray.o.x()), _mm_loadu_ps(&m_cx[base]));
+        __m128 oy = _mm_sub_ps(_mm_set1_ps(ray.o.y()), _mm_loadu_ps(&m_cy[base]));
+        __m128 oz = _mm_sub_ps(_mm_set1_ps(ray.o.z()), _mm_loadu_ps(&m_cz[base]));
+        __m128 r  = _mm_loadu_ps(&m_r[base]);
+
+        /* Half-b form of the quadratic: t = (-b +- sqrt(b^2 - a*c)) / a */
+        __m128 b = _mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(ox, _mm_set1_ps(ray.d.x())),
+            _mm_mul_ps(oy, _mm_set1_ps(ray.d.y()))),
+            _mm_mul_ps(oz, _mm_set1_ps(ray.d.z())));
+        __m128 c = _mm_sub_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(ox, ox), _mm_mul_ps(oy, oy)), _mm_mul_ps(oz, oz)),
+            _mm_mul_ps(r, r));
+        __m128 discr = _mm_sub_ps(_mm_mul_ps(b, b), _mm_mul_ps(_mm_set1_ps(a), c));
+
+        __m128 zero = _mm_setzero_ps();
+        __m128 hit = _mm_cmpgt_ps(discr, zero);
+        __m128 sqrtd = _mm_sqrt_ps(_mm_max_ps(discr, zero));
+        __m128 invA = _mm_set1_ps(1.f / a);
+        __m128 nb = _mm_sub_ps(zero, b);
+        __m128 t0 = _mm_mul_ps(_mm_sub_ps(nb, sqrtd), invA);
+        __m128 t1 = _mm_mul_ps(_mm_add_ps(nb, sqrtd), invA);
+
+        __m128 mint = _mm_set1_ps(ray.mint), maxt = _mm_set1_ps(ray.maxt);
+        __m128 valid0 = _mm_and_ps(hit, _mm_and_ps(_mm_cmpge_ps(t0, mint), _mm_cmple_ps(t0, maxt)));
+        __m128 valid1 = _mm_and_ps(hit, _mm_and_ps(_mm_cmpge_ps(t1, mint), _mm_cmple_ps(t1, maxt)));
+
+        /* Prefer the near root, then the far one, otherwise +inf */
+        __m128 inf = _mm_set1_ps(std::numeric_limits<float>::infinity());
+        __m128 tFar = _mm_or_ps(_mm_and_ps(valid1, t1), _mm_andnot_ps(valid1, inf));
+        __m128 tHit = _mm_or_ps(_mm_and_ps(valid0, t0), _mm_andnot_ps(valid0, tFar));
+        _mm_storeu_ps(lanes, tHit);
+#else
+        for (uint32_t k = 0; k < PACKET_SIZE; ++k) {
+            uint32_t i = base + k;
+            Vector3f oc = ray.o - Point3f(m_cx[i], m_cy[i], m_cz[i]);
+            float b = oc.dot(ray.d);
+            float c = oc.squaredNorm() - m_r[i] * m_r[i];
+            float discr = b * b - a * c;
+            lanes[k] = std::numeric_limits<float>::infinity();
+            if (discr <= 0)
+                continue;
+            float sqrtd = std::sqrt(discr);
+            float t0 = (-b - sqrtd) / a, t1 = (-b + sqrtd) / a;
+            if (t0 >= ray.mint && t0 <= ray.maxt)
+                lanes[k] = t0;
+            else if (t1 >= ray.mint && t1 <= ray.maxt)
+                lanes[k] = t1;
+        }
+#endif
+
+        uint32_t best = 0;
+        for (uint32_t k = 1; k < PACKET_SIZE; ++k)
+            if (lanes[k] < lanes[best])
+                best = k;
+        if (lanes[best] == std::numeric_limits<float>::infinity())
+            return false;
+
+        t = lanes[best];
+        u = (float) best;
+        v = 0.f;
+        return true;
+    }
+
+    virtual void setHitInformation(uint32_t index, const Ray3f &ray, Intersection & its) const override {
+        uint32_t i = index * PACKET_SIZE + (uint32_t) its.uv.x();
+        Point3f center(m_cx[i], m_cy[i], m_cz[i]);
+
+        its.p = ray(its.t);
+        Vector3f n = (its.p - center).normalized();
+        its.uv[0] = 0.5f + std::atan2(n.y(), n.x()) / (2.f * M_PI);
+        its.uv[1] = 0.5f + std::asin(clamp(n.z(), -1.f, 1.f)) / M_PI;
+        its.shFrame = Frame(n);
+        its.geoFrame = Frame(n);
+        its.mesh = this;
+        its.primIndex = i;
+    }
+
+    virtual void sampleSurface(ShapeQueryRecord & sRec, const Point2f & sample) const override {
+        Point2f s = sample;
+        size_t i = m_pdf.sampleCDFReuse(s.x());
+
+        Vector3f q = Warp::squareToUniformSphere(s);
+        sRec.p = Point3f(m_cx[i], m_cy[i], m_cz[i]) + m_r[i] * q;
+        sRec.n = q;
+        sRec.pdf = m_pdf.getNormalization();
+        sRec.primIndex = (uint32_t) i;
+    }
+
+    virtual float pdfSurface(const ShapeQueryRecord & sRec) const override {
+        return m_pdf.getNormalization();
+    }
+
+    virtual float getSurfaceArea() const override { return m_pdf.getSum(); }
+
+    /* Only the packets overlapping the grid cell of 'p' are tested */
+    virtual bool contains(const Point3f &p) const override {
+        if (!m_bbox.contains(p))
+            return false;
+        int cell = 0;
+        for (int k = 2; k >= 0; --k)
+            cell = cell * m_insideRes[k] + clamp((int) ((p[k] - m_bbox.min[k]) * m_insideScale[k]), 0, m_insideRes[k] - 1);
+
+        for (uint32_t j = m_insideCells[cell]; j < m_insideCells[cell + 1]; ++j) {
+            const uint32_t base = m_insidePackets[j] * PACKET_SIZE;
+#if defined(NORI_SPHERESET_SSE)
+            __m128 dx = _mm_sub_ps(_mm_set1_ps(p.x()), _mm_loadu_ps(&m_cx[base]));
+            __m128 dy = _mm_sub_ps(_mm_set1_ps(p.y()), _mm_loadu_ps(&m_cy[base]));
+            __m128 dz = _mm_sub_ps(_mm_set1_ps(p.z()), _mm_loadu_ps(&m_cz[base]));
+            __m128 r  = _mm_loadu_ps(&m_r[base]);
+            __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+            if (_mm_movemask_ps(_mm_cmple_ps(d2, _mm_mul_ps(r, r))))
+                return true;
+#else
+            for (uint32_t i = base; i < base + PACKET_SIZE; ++i) {
+                Vector3f d = p - Point3f(m_cx[i], m_cy[i], m_cz[i]);
+                if (d.squaredNorm() <= m_r[i] * m_r[i])
+                    return true;
+            }
+#endif
+        }
+        return false;
+    }
+
+    virtual float getZMax() const override { return m_bbox.max.z(); }
+    virtual float getZMin() const override { return m_bbox.min.z(); }
+
+    virtual std::string toString() const override {
+        return tfm::format(
+                "SphereSet[\n"
+                "  name = \"%s\",\n"
+                "  spheres = %i,\n"
+                "  bsdf = %s,\n"
+                "  emitter = %s\n"
+                "]",
+                m_name,
+                m_count,
+                m_bsdf ? indent(m_bsdf->toString()) : std::string("null"),
+                m_emitter ? indent(m_emitter->toString()) : std::string("null"));
+    }
+
+protected:
+    /// Number of spheres intersected by one SIMD kernel invocation
+    static const uint32_t PACKET_SIZE = 4;
+
+    void loadPLY(const std::string &filename, float defaultRadius,
+            std::vector<float> &x, std::vector<float> &y,
+            std::vector<float> &z, std::vector<float> &r) const {
+        PLYReader ply(filename);
+
+        for (const PLYElement &element : ply.getElements()) {
+            if (element.name != "vertex") {
+                for (size_t j = 0; j < element.count; ++j)
+                    for (const PLYProperty &prop : element.properties)
+                        ply.skip(prop);
+                continue;
+            }
+
+            int ix = element.find("x"), iy = element.find("y"), iz = element.find("z");
+            int ir = element.find("radius");
+            if (ix < 0 || iy < 0 || iz < 0)
+                throw NoriException("PLY file \"%s\": vertices lack x/y/z coordinates!", filename);
+
+            x.resize(element.count); y.resize(element.count);
+            z.resize(element.count); r.resize(element.count, defaultRadius);
+            for (size_t j = 0; j < element.count; ++j) {
+                for (int k = 0; k < (int) element.properties.size(); ++k) {
+                    const PLYProperty &prop = element.properties[k];
+                    if (prop.isList()) {
+                        ply.skip(prop);
+                        continue;
+                    }
+                    float value = (float) ply.read(prop.type);
+                    if (k == ix) x[j] = value;
+                    else if (k == iy) y[j] = value;
+                    else if (k == iz) z[j] = value;
+                    else if (k == ir) r[j] = value;
+                }
+            }
+            /* Nothing after the vertices is of interest */
+            break;
+        }
+    }
+
+    void loadBinary(const std::string &filename,
+            std::vector<float> &x, std::vector<float> &y,
+            std::vector<float> &z, std::vector<float> &r) const {
+        std::ifstream is(filename, std::ios::binary);
+        if (is.fail())
+            throw NoriException("Unable to open sphere set \"%s\"!", filename);
+
+        char magic[4];
+        uint32_t version = 0;
+        uint64_t count = 0;
+        is.read(magic, 4);
+        is.read((char *) &version, sizeof(uint32_t));
+        is.read((char *) &count, sizeof(uint64_t));
+        if (!is || memcmp(magic, "NSPH", 4) != 0)
+            throw NoriException("\"%s\" is not a sphere set file!", filename);
+        if (version != 1)
+            throw NoriException("Sphere set \"%s\": unsupported version %i!", filename, version);
+
+        std::vector<float> *arrays[4] = { &x, &y, &z, &r };
+        for (std::vector<float> *array : arrays) {
+            array->resize((size_t) count);
+            is.read((char *) array->data(), (std::streamsize) (sizeof(float) * count));
+        }
+        if (!is)
+            throw NoriException("Sphere set \"%s\" is truncated!", filename);
+    }
+
+    /// Sort the spheres along a Morton curve and pad them to full packets
+    void buildPackets(const std::vector<float> &x, const std::vector<float> &y,
+            const std::vector<float> &z, const std::vector<float> &r) {
+        std::vector<std::pair<uint32_t, uint32_t>> order(m_count);
+        Vector3f extents = m_bbox.getExtents();
+        for (uint32_t i = 0; i < m_count; ++i) {
+            uint32_t code = 0;
+            float p[3] = { x[i], y[i], z[i] };
+            uint32_t q[3];
+            for (int k = 0; k < 3; ++k) {
+                float rel = extents[k] > 0 ? (p[k] - m_bbox.min[k]) / extents[k] : 0.f;
+                q[k] = (uint32_t) clamp((int) (rel * 1024.f), 0, 1023);
+            }
+            for (int bit = 9; bit >= 0; --bit)
+                for (int k = 0; k < 3; ++k)
+                    code = (code << 1) | ((q[k] >> bit) & 1);
+            order[i] = std::make_pair(code, i);
+        }
+        std::sort(order.begin(), order.end());
+
+        /* Unused lanes of the last packet repeat its last sphere */
+        size_t padded = (m_count + PACKET_SIZE - 1) / PACKET_SIZE * PACKET_SIZE;
+        m_cx.resize(padded); m_cy.resize(padded);
+        m_cz.resize(padded); m_r.resize(padded);
+        for (size_t i = 0; i < padded; ++i) {
+            uint32_t src = order[std::min(i, (size_t) m_count - 1)].second;
+            m_cx[i] = x[src]; m_cy[i] = y[src];
+            m_cz[i] = z[src]; m_r[i] = r[src];
+        }
+    }
+
+    /// Bin the packets into a uniform grid over the bounding box for \ref contains()
+    void buildInsideGrid() {
+        uint32_t nPackets = getPrimitiveCount();
+
+        /* Aim for a handful of packets per cell */
+        int res = clamp((int) std::cbrt(nPackets / 2.f), 1, 128);
+        Vector3f extents = m_bbox.getExtents();
+        for (int k = 0; k < 3; ++k) {
+            m_insideRes[k] = extents[k] > 0 ? res : 1;
+            m_insideScale[k] = extents[k] > 0 ? m_insideRes[k] / extents[k] : 0.f;
+        }
+        auto cellRange = [&](const BoundingBox3f &bbox, int lo[3], int hi[3]) {
+            for (int k = 0; k < 3; ++k) {
+                lo[k] = clamp((int) ((bbox.min[k] - m_bbox.min[k]) * m_insideScale[k]), 0, m_insideRes[k] - 1);
+                hi[k] = clamp((int) ((bbox.max[k] - m_bbox.min[k]) * m_insideScale[k]), 0, m_insideRes[k] - 1);
+            }
+        };
+
+        /* Count the packets overlapping each cell, then scatter them */
+        int nCells = m_insideRes.x() * m_insideRes.y() * m_insideRes.z();
+        m_insideCells.assign(nCells + 1, 0u);
+        for (int pass = 0; pass < 2; ++pass) {
+            std::vector<uint32_t> fill;
+            if (pass == 1) {
+                for (int i = 0; i < nCells; ++i)
+                    m_insideCells[i + 1] += m_insideCells[i];
+                m_insidePackets.resize(m_insideCells.back());
+                fill.assign(m_insideCells.begin(), m_insideCells.end() - 1);
+            }
+            for (uint32_t f = 0; f < nPackets; ++f) {
+                int lo[3], hi[3];
+                cellRange(getBoundingBox(f), lo, hi);
+                for (int z = lo[2]; z <= hi[2]; ++z) {
+                    for (int y = lo[1]; y <= hi[1]; ++y) {
+                        for (int x = lo[0]; x <= hi[0]; ++x) {
+                            int cell = (z * m_insideRes.y() + y) * m_insideRes.x() + x;
+                            if (pass == 0)
+                                m_insideCells[cell + 1]++;
+                            else
+                                m_insidePackets[fill[cell]++] = f;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+protected:
+    std::vector<float> m_cx, m_cy, m_cz, m_r; ///< Centers and radii (SoA, padded to full packets)
+    uint32_t m_count = 0;                      ///< Number of actual spheres
+    DiscretePDF m_pdf;                         ///< Discrete pdf proportional to the sphere areas
+    std::string m_name;                        ///< Name of the file the spheres were loaded from
+    Vector3i m_insideRes = Vector3i(1, 1, 1);  ///< Resolution of the grid used by contains()
+    Vector3f m_insideScale = Vector3f(0.f);    ///< Cells per unit length along each axis
+    std::vector<uint32_t> m_insideCells;       ///< Offsets of the cells into m_insidePackets
+    std::vector<uint32_t> m_insidePackets;     ///< Packets overlapping each cell
+};
+
+NORI_REGISTER_CLASS(SphereSet, "sphereset");
+NORI_NAMESPACE_END
@@ -44,6 +44,8 @@ public:
         return 1.f;
     }
 
+    virtual bool isNull() const override { return true; }
+
     virtual std::string toString() const override {
         return tfm::format("Transparent[]");
     }
@@ -0,0 +1,80 @@
+/*
+    This file is part of Nori, a simple educational ray tracer
+
+    Copyright (c) 2015 by Wenzel Jakob
+
+    Nori is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License Version 3
+    as published by the Free Software Foundation.
+
+    Nori is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <nori/brickgrid.h>
+#include <nori/timer.h>
+#include <nori/mmap.h>
+
+using namespace nori;
+
+/*
+ * Converts a dense Mitsuba grid volume (".vol") into the sparse brick
+ * format (".bvol") that GridVolume loads without a dense copy. Bricks of
+ * 8x8x8 voxels that are entirely zero are dropped.
+ */
+int main(int argc, char **argv) {
+    std::vector<std::string> args;
+    float threshold = 0.f;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string token(argv[i]);
+            if (token == "--threshold" && i + 1 < argc)
+                threshold = std::stof(argv[++i]);
+            else
+                args.push_back(token);
+        }
+    } catch (const std::exception &) {
+        args.clear();
+    }
+
+    if (args.size() != 2 || threshold < 0) {
+        cerr << "Syntax: " << argv[0] << " [--threshold T] <input.vol> <output.bvol>" << endl << endl;
+        cerr << "Converts a dense grid volume into sparse 8^3 bricks. Values whose magnitude" << endl;
+        cerr << "does not exceed T (default 0) are treated as empty space." << endl;
+        return -1;
+    }
+
+    try {
+        MemoryMappedFile file(args[0]);
+        VolHeader header;
+        const float *data = getVolData(file.getData(), file.getSize(), args[0], header);
+
+        cout << "Building bricks for " << header.xres << "x" << header.yres << "x" << header.zres
+             << " voxels (" << header.channels << " channel(s)) .. ";
+        cout.flush();
+        Timer timer;
+        BrickGrid grid;
+        grid.build(data, header.xres, header.yres, header.zres, header.channels, threshold);
+        cout << "done. (took " << timer.elapsedString() << ")" << endl;
+
+        size_t denseSize = file.getSize() - sizeof(VolHeader);
+        cout << tfm::format("Stored %i of %i bricks: %s instead of %s (%.1f%%)",
+            grid.getBrickCount(), grid.getTableSize(), memString(grid.getMemoryUsage()),
+            memString(denseSize), 100.0 * grid.getMemoryUsage() / denseSize) << endl;
+
+        grid.save(args[1], BoundingBox3f(
+            Point3f(header.bbox[0], header.bbox[1], header.bbox[2]),
+            Point3f(header.bbox[3], header.bbox[4], header.bbox[5])));
+    } catch (const std::exception &e) {
+        cerr << "Error: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -4,6 +4,7 @@
 #include <nori/sampler.h>
 #include <nori/phasefunction.h>
 #include <stack>
+#include <vector>
 NORI_NAMESPACE_BEGIN
 using namespace std;
 
@@ -17,117 +18,164 @@ public:
         Color3f color = 0;
         Color3f t = 1.f;
         Ray3f currRay = ray;
-        Ray3f trackRay;
-        int bounce_cnt = 0;
         const Medium* current_medium = nullptr;
         Intersection its;
-        Intersection trackIts;
         stack<const Medium*> media;
+        vector<MediumCrossing> crossings;
         float w_mat = 1.f;
-        bool has_intersection = scene->rayIntersect(currRay, its);
+        float pdf_phase = 0.f;
         current_medium = scene->getCameraMedium();
-        while (true) {
-            MediumQueryRecord mRec(currRay.o, -currRay.d, its.t);
-
-            if (current_medium && current_medium->sample_freepath(mRec, sampler)) {
-                // continuously scattering inside the medium
-                PhaseFunctionQueryRecord pRec(mRec.wi);
-                current_medium->getPhaseFunction()->sample(pRec, sampler->next2D());   
-                //sample direction to next interaction
-                currRay = Ray3f(mRec.p, pRec.wo);
-                has_intersection = scene->rayIntersect(currRay, its);
-                t *= mRec.ret;
+
+        //update the medium stack when passing through the boundary of a shape
+        auto crossBoundary = [&](const Shape* mesh, bool entering) {
+            if (!entering && mesh->getMedium() == current_medium) {
+                //if escaping the medium, carefully pop
+                if (!media.empty()) {
+                    media.pop();
+                    if (media.empty()) {
+                        current_medium = nullptr;
+                    }
+                    else {
+                        current_medium = media.top();
+                    }
+                }
+            }
+            else if (entering && mesh->getMedium() != nullptr) {
+                //if entering medium, push into the stack
+                current_medium = mesh->getMedium();
+                media.push(current_medium);
             }
-            else {
+        };
+
+        //null interfaces (medium boundaries) are passed through inside the traversal
+        bool has_intersection = scene->rayIntersect(currRay, its, crossings);
+        while (true) {
+            //walk the medium segments up to the first real surface
+            bool scattered = false;
+            float t_start = 0.f;
+            for (size_t i = 0; i <= crossings.size(); ++i) {
+                float t_end = i < crossings.size() ? crossings[i].t : its.t;
                 if (current_medium) {
-                    //hit a surface of mesh or medium during scattering, update the throughput
+                    MediumQueryRecord mRec(currRay(t_start), -currRay.d, t_end - t_start);
+                    if (current_medium->sample_freepath(mRec, sampler)) {
+                        t *= mRec.ret;
+                        const PhaseFunction* phase = current_medium->getPhaseFunction();
+
+                        /* sample emitter, the shadow ray is attenuated by the media it passes */
+                        float lightPdf;
+                        auto light = scene->getRandomEmitter(sampler->next1D(), lightPdf);
+                        EmitterQueryRecord lRec(mRec.p);
+                        Color3f Li = light->sample(lRec, sampler->next2D());
+                        if (!Li.isZero()) {
+                            Color3f tr = scene->transmittance(lRec.shadowRay, sampler, current_medium);
+                            PhaseFunctionQueryRecord pRec_em(mRec.wi, lRec.wi, ESolidAngle);
+                            float pdf_em = light->pdf(lRec) * lightPdf;
+                            float pdf_phase_em = phase->pdf(pRec_em);
+                            if (!tr.isZero() && pdf_em + pdf_phase_em > 1e-8) {
+                                float w_em = pdf_em / (pdf_phase_em + pdf_em);
+                                color += w_em * t * tr * phase->eval(pRec_em) * Li / lightPdf;
+                            }
+                        }
+
+                        // continuously scattering inside the medium
+                        PhaseFunctionQueryRecord pRec(mRec.wi);
+                        phase->sample(pRec, sampler->next2D());
+                        pdf_phase = phase->pdf(pRec);
+                        //sample direction to next interaction
+                        currRay = Ray3f(mRec.p, pRec.wo);
+                        scattered = true;
+                        break;
+                    }
+                    //left the segment without scattering, update the throughput
                     t *= mRec.ret;
                 }
-                if (!has_intersection) {
+                if (i == crossings.size())
                     break;
-                }
+                crossBoundary(crossings[i].mesh, crossings[i].entering);
+                t_start = t_end;
+            }
 
-                /* compute Le when intersection is an emitter */
-                if (its.mesh->isEmitter()) {
-                    EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n);
-                    Color3f Li = its.mesh->getEmitter()->eval(lRec);
-                    color += w_mat * t * its.mesh->getEmitter()->eval(lRec);
-                }
+            if (scattered) {
+                has_intersection = scene->rayIntersect(currRay, its, crossings);
 
-                /* sample emitter */
-                auto light = scene->getRandomEmitter(sampler->next1D());
-                int n_lights = scene->getLights().size();
-                EmitterQueryRecord lRec(its.p);
-                Color3f Li = light->sample(lRec, sampler->next2D());
-
-
-                /* compute w_em */
-                if (!scene->rayIntersect(lRec.shadowRay)) {  // if shadow ray is NOT occluded
-                    float cosTheta = its.shFrame.n.dot(lRec.wi);
-                    BSDFQueryRecord bRec(its.toLocal(-currRay.d), its.toLocal(lRec.wi), ESolidAngle);
-                    bRec.uv = its.uv;
-                    float pdf_em = light->pdf(lRec);
-                    float pdf_mat = its.mesh->getBSDF()->pdf(bRec);
-                    if (pdf_em + pdf_mat > 1e-8) {
-                        float w_em = pdf_em / (pdf_mat + pdf_em);
-                        color += w_em * t * its.mesh->getBSDF()->eval(bRec) * Li * cosTheta * n_lights;
-                    }
+                /* compute w_mat for the phase function sample */
+                if (has_intersection && its.mesh->isEmitter()) {
+                    EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n, its.primIndex);
+                    float pdf_em = its.mesh->getEmitter()->pdf(lRec) * scene->getEmitterPdf(its.mesh->getEmitter());
+                    w_mat = pdf_phase / (pdf_phase + pdf_em);
                 }
+                continue;
+            }
 
-                /* Russian roulette */
-                float p = std::min(t.maxCoeff(), 0.99f);
-                if (sampler->next1D() > p || p <= 0.f) {
-                    break;
-                }
-                t /= p;
+            if (!has_intersection) {
+                break;
+            }
 
-                /* sample brdf */
-                BSDFQueryRecord bRec(its.toLocal((-currRay.d).normalized()));
-                bRec.p = its.p;
-                bRec.uv = its.uv;
-                Color3f brdf = its.mesh->getBSDF()->sample(bRec, sampler->next2D());
+            /* compute Le when intersection is an emitter */
+            if (its.mesh->isEmitter()) {
+                EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n, its.primIndex);
+                color += w_mat * t * its.mesh->getEmitter()->eval(lRec);
+            }
 
-                /* recursion */
-                t *= brdf;
-                currRay = Ray3f(bRec.p, its.toWorld(bRec.wo));
+            /* sample emitter */
+            float lightPdf;
+            auto light = scene->getRandomEmitter(sampler->next1D(), lightPdf);
+            EmitterQueryRecord lRec(its.p);
+            Color3f Li = light->sample(lRec, sampler->next2D());
 
-                /* current pdf mat */
+
+            /* compute w_em, the shadow ray is attenuated by the media it passes */
+            Color3f tr = scene->transmittance(lRec.shadowRay, sampler,
+                Scene::getShadowMedium(its, lRec.wi, current_medium));
+            if (!tr.isZero()) {
+                float cosTheta = its.shFrame.n.dot(lRec.wi);
+                BSDFQueryRecord bRec(its.toLocal(-currRay.d), its.toLocal(lRec.wi), ESolidAngle);
+                bRec.uv = its.uv;
+                float pdf_em = light->pdf(lRec) * lightPdf;
                 float pdf_mat = its.mesh->getBSDF()->pdf(bRec);
-                if (Frame::cosTheta(its.shFrame.toLocal(currRay.d)) >= 0.0f && its.mesh->getMedium() == current_medium) {
-                    //if escaping the medium, carefully pop
-                    if (!media.empty()) {
-                        media.pop();
-                        if (media.empty()) {
-                            current_medium = nullptr;
-                        }
-                        else {
-                            current_medium = media.top();
-                        }
-                    }
-                }
-                else if (Frame::cosTheta(its.shFrame.toLocal(currRay.d)) < 0.0f && its.mesh->getMedium() != nullptr) {
-                    //if entering medium, push into the stack
-                    current_medium = its.mesh->getMedium();
-                    media.push(current_medium);
+                if (pdf_em + pdf_mat > 1e-8) {
+                    float w_em = pdf_em / (pdf_mat + pdf_em);
+                    color += w_em * t * tr * its.mesh->getBSDF()->eval(bRec) * Li * cosTheta / lightPdf;
                 }
+            }
 
-                has_intersection = scene->rayIntersect(currRay, its);
-
-                /* compute w_mat */
-                if (its.mesh->isEmitter()) {
-                    EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n);
-                    float pdf_em = its.mesh->getEmitter()->pdf(lRec);
-                    if (pdf_em + pdf_mat > 1e-8) {
-                        w_mat = pdf_mat / (pdf_mat + pdf_em);
-                    }
-                    else {
-                        w_mat = 0.f;
-                    }
+            /* Russian roulette */
+            float p = std::min(t.maxCoeff(), 0.99f);
+            if (sampler->next1D() > p || p <= 0.f) {
+                break;
+            }
+            t /= p;
+
+            /* sample brdf */
+            BSDFQueryRecord bRec(its.toLocal((-currRay.d).normalized()));
+            bRec.p = its.p;
+            bRec.uv = its.uv;
+            Color3f brdf = its.mesh->getBSDF()->sample(bRec, sampler->next2D());
+
+            /* recursion */
+            t *= brdf;
+            currRay = Ray3f(bRec.p, its.toWorld(bRec.wo));
+
+            /* current pdf mat */
+            float pdf_mat = its.mesh->getBSDF()->pdf(bRec);
+            crossBoundary(its.mesh, Frame::cosTheta(its.shFrame.toLocal(currRay.d)) < 0.0f);
+
+            has_intersection = scene->rayIntersect(currRay, its, crossings);
+
+            /* compute w_mat */
+            if (has_intersection && its.mesh->isEmitter()) {
+                EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n, its.primIndex);
+                float pdf_em = its.mesh->getEmitter()->pdf(lRec) * scene->getEmitterPdf(its.mesh->getEmitter());
+                if (pdf_em + pdf_mat > 1e-8) {
+                    w_mat = pdf_mat / (pdf_mat + pdf_em);
+                }
+                else {
+                    w_mat = 0.f;
                 }
-
-                if (bRec.measure == EDiscrete)
-                    w_mat = 1.f;
             }
+
+            if (bRec.measure == EDiscrete)
+                w_mat = 1.f;
         }
 
         return color;
@@ -30,39 +30,66 @@ public:
             MediumQueryRecord mRec(currRay.o, -currRay.d, its.t);
             if (current_medium && current_medium->sample_freepath(mRec, sampler)) {
 
-                //emission sampling
-                auto emissive = scene->getRandomEmissiveMedia(sampler->next1D());
-                int n_emissive = scene->getEmissiveMedia().size();
-                MediumQueryRecord mRec_ems(its.p);
-                Color3f Li = emissive->sample_radiance(mRec_ems, sampler);
-                float pdf_em = Epsilon;
-                Ray3f testRay = Ray3f(mRec_ems.p, (emissive->getShape()->getBoundingBox().getCenter() - mRec_ems.p).normalized(), Epsilon, (emissive->getShape()->getBoundingBox().getCenter() - mRec_ems.p).norm());
-                Ray3f sampleRay = Ray3f(its.p, (mRec_ems.p - its.p).normalized(), Epsilon, (mRec_ems.p - its.p).norm());
-
-                if (!scene->rayCurrIntersect(testRay, emissive->getShape())) {
-                    //if not rejected (inside bbox, outside the medium), accept the distribution
-                    if (!scene->rayIntersect(sampleRay)) {
-                        //if not occuluded set the pdf, otherwise 0 contribution.
-                        pdf_em = mRec_ems.radiance_pdf;
+                const PhaseFunction* phase = current_medium->getPhaseFunction();
+
+                //choose between the emitters and the emissive media in proportion to their power
+                float groupPdf;
+                if (scene->sampleEmitter(sampler->next1D(), groupPdf)) {
+                    /* sample emitter, weighted against phase function sampling */
+                    float lightPdf;
+                    auto light = scene->getRandomEmitter(sampler->next1D(), lightPdf);
+                    EmitterQueryRecord lRec(mRec.p);
+                    Color3f Li = light->sample(lRec, sampler->next2D());
+                    if (!Li.isZero()) {
+                        Color3f tr = scene->transmittance(lRec.shadowRay, sampler, current_medium);
+                        PhaseFunctionQueryRecord pRec_em(mRec.wi, lRec.wi, ESolidAngle);
+                        float pdf_em = light->pdf(lRec) * lightPdf * groupPdf;
+                        float pdf_phase_em = phase->pdf(pRec_em);
+                        if (!tr.isZero() && pdf_em + pdf_phase_em > 1e-8) {
+                            float w_em = pdf_em / (pdf_phase_em + pdf_em);
+                            color += w_em * t * mRec.ret * tr * phase->eval(pRec_em) * Li / (lightPdf * groupPdf);
+                        }
                     }
                 }
+                else {
+                    /* emission sampling; media emission is only gathered here, so no MIS is needed */
+                    float mediaPdf;
+                    auto emissive = scene->getRandomEmissiveMedia(sampler->next1D(), mediaPdf);
+                    MediumQueryRecord mRec_ems(mRec.p);
+                    Color3f Li = emissive->sample_radiance(mRec_ems, sampler);
+                    float pdf_em = Epsilon;
+                    const Ray3f& sampleRay = mRec_ems.shadowRay;
+
+                    if (emissive->getShape()->contains(mRec_ems.p)) {
+                        //if not rejected (inside bbox, outside the medium), accept the distribution
+                        pdf_em = mRec_ems.radiance_pdf;
+                    }
 
-                Color3f Transmittance = transmittance(scene, sampler, sampleRay, current_medium);
-                PhaseFunctionQueryRecord pRec_ems(mRec.wi, sampleRay.d, ESolidAngle);
-                float pdf_mat = current_medium->getPhaseFunction()->pdf(pRec_ems);
-                if (pdf_em >= 2 * Epsilon) {
-                    //ignore invalid contributions
-                    color += t * Li * n_emissive / pdf_em;
+                    //attenuation by the media between the scattering and the sampled point, 0 if occluded
+                    Color3f Transmittance = scene->transmittance(sampleRay, sampler, current_medium);
+                    if (pdf_em >= 2 * Epsilon && !Transmittance.isZero()) {
+                        //ignore invalid contributions
+                        color += t * Transmittance * Li / (groupPdf * mediaPdf * pdf_em);
+                    }
                 }
 
-
                 // scattered inside the medium
                 PhaseFunctionQueryRecord pRec(mRec.wi);
-                current_medium->getPhaseFunction()->sample(pRec, sampler->next2D());   //sample direction to next interaction
+                phase->sample(pRec, sampler->next2D());   //sample direction to next interaction
+                float pdf_phase = phase->pdf(pRec);
                 //sample direction to next sampling
                 currRay = Ray3f(mRec.p, pRec.wo);
                 has_intersection = scene->rayIntersect(currRay, its);
                 t *= mRec.ret;
+
+                /* compute w_mat for the phase function sample */
+                w_mat = 1.f;
+                if (has_intersection && its.mesh->isEmitter()) {
+                    EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n, its.primIndex);
+                    float pdf_em = its.mesh->getEmitter()->pdf(lRec) * scene->getEmitterPdf(its.mesh->getEmitter())
+                        * scene->getEmitterFraction();
+                    w_mat = pdf_phase + pdf_em > 1e-8 ? pdf_phase / (pdf_phase + pdf_em) : 0.f;
+                }
             }
             else {
                 if (current_medium) {
@@ -74,26 +101,28 @@ public:
 
                 /* compute Le when intersection is an emitter */
                 if (its.mesh->isEmitter()) {
-                    EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n);
+                    EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n, its.primIndex);
                     Color3f Li = its.mesh->getEmitter()->eval(lRec);
                     color += w_mat * t * its.mesh->getEmitter()->eval(lRec);
                 }
                 /* sample emitter */
-                auto light = scene->getRandomEmitter(sampler->next1D());
-                int n_lights = scene->getLights().size();
+                float lightPdf;
+                auto light = scene->getRandomEmitter(sampler->next1D(), lightPdf);
                 EmitterQueryRecord lRec(its.p);
                 Color3f Li = light->sample(lRec, sampler->next2D());
 
-                /* compute w_em */
-                if (!scene->rayIntersect(lRec.shadowRay)) {  // if shadow ray is NOT occluded
+                /* compute w_em, the shadow ray is attenuated by the media it passes */
+                Color3f tr = scene->transmittance(lRec.shadowRay, sampler,
+                    Scene::getShadowMedium(its, lRec.wi, current_medium));
+                if (!tr.isZero()) {
                     float cosTheta = its.shFrame.n.dot(lRec.wi);
                     BSDFQueryRecord bRec(its.toLocal(-currRay.d), its.toLocal(lRec.wi), ESolidAngle);
                     bRec.uv = its.uv;
-                    float pdf_em = light->pdf(lRec);
+                    float pdf_em = light->pdf(lRec) * lightPdf;
                     float pdf_mat = its.mesh->getBSDF()->pdf(bRec);
                     if (pdf_em + pdf_mat > 1e-8) {
                         float w_em = pdf_em / (pdf_mat + pdf_em);
-                        color += w_em * t * its.mesh->getBSDF()->eval(bRec) * Li * cosTheta * n_lights;
+                        color += w_em * t * tr * its.mesh->getBSDF()->eval(bRec) * Li * cosTheta / lightPdf;
                     }
                 }
 
@@ -127,8 +156,8 @@ public:
 
                 /* compute w_mat */
                 if (its.mesh->isEmitter()) {
-                    EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n);
-                    float pdf_em = its.mesh->getEmitter()->pdf(lRec);
+                    EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n, its.primIndex);
+                    float pdf_em = its.mesh->getEmitter()->pdf(lRec) * scene->getEmitterPdf(its.mesh->getEmitter());
                     if (pdf_em + pdf_mat > 1e-8) {
                         w_mat = pdf_mat / (pdf_mat + pdf_em);
                     }
@@ -145,61 +174,6 @@ public:
         return color;
     }
 
-    /* assumption: trRay.o, trRay.d, trRay.maxt*/
-    Color3f transmittance(const Scene* scene, Sampler* sampler, const Ray3f & trRay, const Medium* medium) const {
-        float start = 0.f;
-        Color3f Tr = Color3f(1);
-        const Medium* current_medium = medium;
-        Ray3f currRay = trRay;
-        Intersection its;
-        int count = 0;
-        int maxDepth = 30;
-        //based on the assumption that no overlapping medium
-        while (true) {
-            count++;
-            if (count > maxDepth) {
-                break;
-            }
-            if (start >= trRay.maxt) {
-                break;
-            }
-            bool intersect = scene->rayIntersect(currRay, its);
-            if (!intersect|| its.t >= currRay.maxt)  {
-                if (current_medium) {
-                    MediumQueryRecord segMRec(currRay.o, currRay(currRay.maxt));
-                    return Tr * current_medium->Tr(segMRec, sampler);
-                }
-                else {
-                    return Tr;
-                }
-            }
-            else {
-                if (!its.mesh->isMedium()) {
-                    return Color3f(0.0f);
-                }
-                else {
-                    if (Frame::cosTheta(its.shFrame.toLocal(currRay.d)) >= 0.0f && current_medium) {
-                        MediumQueryRecord segMRec(currRay.o, currRay(currRay.maxt));
-                        Tr *= current_medium->Tr(segMRec, sampler);
-                        current_medium = nullptr;
-                        start += its.t;
-                        currRay.maxt = trRay.maxt - start;
-                        currRay.o = trRay(start);
-                        currRay.update();
-                    }
-                    if (Frame::cosTheta(its.shFrame.toLocal(currRay.d)) < 0.0f && !current_medium) {
-                        current_medium = its.mesh->getMedium();
-                        start += its.t;
-                        currRay.maxt = trRay.maxt - start;
-                        currRay.o = trRay(start);
-                        currRay.update();
-                    }
-                }
-            }
-
-        }
-    }
-
     std::string toString() const {
         return "VolPathEmissiveIntegrator[]";
     }
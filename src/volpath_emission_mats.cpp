@@ -50,28 +50,30 @@ public:
 
                 /* compute Le when intersection is an emitter */
                 if (its.mesh->isEmitter()) {
-                    EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n);
+                    EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n, its.primIndex);
                     Color3f Li = its.mesh->getEmitter()->eval(lRec);
                     color += w_mat * t * its.mesh->getEmitter()->eval(lRec);
                 }
 
                 //determine whether to sample it or not
                 /* sample emitter */
-                auto light = scene->getRandomEmitter(sampler->next1D());
-                int n_lights = scene->getLights().size();
+                float lightPdf;
+                auto light = scene->getRandomEmitter(sampler->next1D(), lightPdf);
                 EmitterQueryRecord lRec(its.p);
                 Color3f Li = light->sample(lRec, sampler->next2D());
 
-                /* compute w_em */
-                if (!scene->rayIntersect(lRec.shadowRay)) {  // if shadow ray is NOT occluded
+                /* compute w_em, the shadow ray is attenuated by the media it passes */
+                Color3f tr = scene->transmittance(lRec.shadowRay, sampler,
+                    Scene::getShadowMedium(its, lRec.wi, current_medium));
+                if (!tr.isZero()) {
                     float cosTheta = its.shFrame.n.dot(lRec.wi);
                     BSDFQueryRecord bRec(its.toLocal(-currRay.d), its.toLocal(lRec.wi), ESolidAngle);
                     bRec.uv = its.uv;
-                    float pdf_em = light->pdf(lRec);
+                    float pdf_em = light->pdf(lRec) * lightPdf;
                     float pdf_mat = its.mesh->getBSDF()->pdf(bRec);
                     if (pdf_em + pdf_mat > 1e-8) {
                         float w_em = pdf_em / (pdf_mat + pdf_em);
-                        color += w_em * t * its.mesh->getBSDF()->eval(bRec) * Li * cosTheta * n_lights;
+                        color += w_em * t * tr * its.mesh->getBSDF()->eval(bRec) * Li * cosTheta / lightPdf;
                     }
                 }
 
@@ -105,8 +107,8 @@ public:
 
                 /* compute w_mat */
                 if (its.mesh->isEmitter()) {
-                    EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n);
-                    float pdf_em = its.mesh->getEmitter()->pdf(lRec);
+                    EmitterQueryRecord lRec(currRay.o, its.p, its.shFrame.n, its.primIndex);
+                    float pdf_em = its.mesh->getEmitter()->pdf(lRec) * scene->getEmitterPdf(its.mesh->getEmitter());
                     if (pdf_em + pdf_mat > 1e-8) {
                         w_mat = pdf_mat / (pdf_mat + pdf_em);
                     }
@@ -19,6 +19,7 @@
 #include <nori/warp.h>
 #include <nori/vector.h>
 #include <nori/frame.h>
+#include <Eigen/Geometry>
 
 NORI_NAMESPACE_BEGIN
 
@@ -161,4 +162,65 @@ Vector3f Warp::squareToUniformTriangle(const Point2f &sample) {
     return Vector3f(u,v,1.f-u-v);
 }
 
+/* Angle between two unit vectors, accurate for nearly (anti)parallel ones */
+static float angleBetween(const Vector3f &v1, const Vector3f &v2) {
+    if (v1.dot(v2) < 0.f)
+        return M_PI - 2.f * std::asin(std::min(1.f, (v1 + v2).norm() * 0.5f));
+    return 2.f * std::asin(std::min(1.f, (v2 - v1).norm() * 0.5f));
+}
+
+/* Component of 'v' orthogonal to the unit vector 'w', normalized */
+static Vector3f orthogonalize(const Vector3f &v, const Vector3f &w) {
+    Vector3f r = v - v.dot(w) * w;
+    float length = r.norm();
+    return length > 0.f ? Vector3f(r / length) : Vector3f(0.f);
+}
+
+Vector3f Warp::squareToSphericalTriangle(const Point2f &sample,
+        const Vector3f &a, const Vector3f &b, const Vector3f &c) {
+    /* Normals of the great circles through the edges */
+    Vector3f n_ab = a.cross(b), n_bc = b.cross(c), n_ca = c.cross(a);
+    if (n_ab.squaredNorm() == 0.f || n_bc.squaredNorm() == 0.f || n_ca.squaredNorm() == 0.f)
+        return a;
+    n_ab.normalize(); n_bc.normalize(); n_ca.normalize();
+
+    /* Interior angles at the vertices */
+    float alpha = angleBetween(n_ab, -n_ca);
+    float beta = angleBetween(n_bc, -n_ab);
+    float gamma = angleBetween(n_ca, -n_bc);
+
+    /* Pick the sub-triangle (a, b, c') with a uniformly sampled area */
+    float areaPi = lerp(sample.x(), (float) M_PI, alpha + beta + gamma);
+    float cosAlpha = std::cos(alpha), sinAlpha = std::sin(alpha);
+    float sinPhi = std::sin(areaPi) * cosAlpha - std::cos(areaPi) * sinAlpha;
+    float cosPhi = std::cos(areaPi) * cosAlpha + std::sin(areaPi) * sinAlpha;
+    float k1 = cosPhi + cosAlpha;
+    float k2 = sinPhi - sinAlpha * a.dot(b);
+    float cosBp = (k2 + (k2 * cosPhi - k1 * sinPhi) * cosAlpha) /
+                  ((k2 * sinPhi + k1 * cosPhi) * sinAlpha);
+    cosBp = clamp(cosBp, -1.f, 1.f);
+    float sinBp = std::sqrt(std::max(0.f, 1.f - cosBp * cosBp));
+    Vector3f cp = cosBp * a + sinBp * orthogonalize(c, a);
+
+    /* Sample along the arc between b and c' */
+    float cosTheta = 1.f - sample.y() * (1.f - cp.dot(b));
+    float sinTheta = std::sqrt(std::max(0.f, 1.f - cosTheta * cosTheta));
+    return cosTheta * b + sinTheta * orthogonalize(cp, b);
+}
+
+float Warp::squareToSphericalTrianglePdf(const Vector3f &v,
+        const Vector3f &a, const Vector3f &b, const Vector3f &c) {
+    /* Inside when 'v' lies on the same side of each edge as the opposite vertex */
+    float orientation = a.dot(b.cross(c));
+    if (orientation == 0.f || v.dot(a.cross(b)) * orientation < 0.f ||
+        v.dot(b.cross(c)) * orientation < 0.f || v.dot(c.cross(a)) * orientation < 0.f)
+        return 0.f;
+    return 1.f / sphericalTriangleArea(a, b, c);
+}
+
+float Warp::sphericalTriangleArea(const Vector3f &a, const Vector3f &b, const Vector3f &c) {
+    /* Van Oosterom and Strackee */
+    return 2.f * std::atan2(std::abs(a.dot(b.cross(c))), 1.f + a.dot(b) + a.dot(c) + b.dot(c));
+}
+
 NORI_NAMESPACE_END
@@ -77,6 +77,7 @@ enum WarpType : int {
     Disk,
     UniformSphere,
     UniformSphereCap,
+    SphericalTriangle,
     UniformHemisphere,
     CosineHemisphere,
     Beckmann,
@@ -85,8 +86,8 @@ enum WarpType : int {
 };
 
 static const std::string kWarpTypeNames[WarpTypeCount] = {
-    "square", "disk", "uniform_sphere", "uniform_sphere_cap", "uniform_hemisphere",
-    "cosine_hemisphere", "beckmann", "microfacet_brdf"
+    "square", "disk", "uniform_sphere", "uniform_sphere_cap", "spherical_triangle",
+    "uniform_hemisphere", "cosine_hemisphere", "beckmann", "microfacet_brdf"
 };
 
 
@@ -170,7 +171,11 @@ struct WarpTest {
                     return Warp::squareToUniformSpherePdf(v);
                 else if (warpType == UniformSphereCap)
                     return Warp::squareToUniformSphereCapPdf(v, parameterValue);
-                else if (warpType == UniformHemisphere)
+                else if (warpType == SphericalTriangle) {
+                    nori::Vector3f a, b, c;
+                    sphericalTriangle(a, b, c);
+                    return Warp::squareToSphericalTrianglePdf(v, a, b, c);
+                } else if (warpType == UniformHemisphere)
                     return Warp::squareToUniformHemispherePdf(v);
                 else if (warpType == CosineHemisphere)
                     return Warp::squareToCosineHemispherePdf(v);
@@ -222,6 +227,22 @@ struct WarpTest {
     }
 
 
+    /**
+     * Vertices of the spherical triangle that is sampled. The parameter in
+     * [0, 1] opens the (deliberately irregular) triangle from a small one
+     * around the north pole until it reaches below the equator.
+     */
+    void sphericalTriangle(nori::Vector3f &a, nori::Vector3f &b, nori::Vector3f &c) const {
+        float theta = (float) M_PI * (0.1f + 0.45f * std::min(std::max(parameterValue, 0.f), 1.f));
+        auto vertex = [](float theta, float phi) {
+            return nori::Vector3f(std::sin(theta) * std::cos(phi),
+                                  std::sin(theta) * std::sin(phi), std::cos(theta));
+        };
+        a = vertex(theta, 0.f);
+        b = vertex(0.6f * theta, 2.1f);
+        c = vertex(1.2f * theta, 4.2f);
+    }
+
     std::pair<Point3f, float> warpPoint(const Point2f &sample) {
         Point3f result;
 
@@ -234,6 +255,12 @@ struct WarpTest {
                 result << Warp::squareToUniformSphere(sample); break;
             case UniformSphereCap:
                 result << Warp::squareToUniformSphereCap(sample, parameterValue); break;
+            case SphericalTriangle: {
+                nori::Vector3f a, b, c;
+                sphericalTriangle(a, b, c);
+                result << Warp::squareToSphericalTriangle(sample, a, b, c);
+                break;
+            }
             case UniformHemisphere:
                 result << Warp::squareToUniformHemisphere(sample); break;
             case CosineHemisphere:
@@ -531,8 +558,10 @@ public:
         m_parameterBox->set_value(tfm::format("%.1g", parameterValue));
         m_parameter2Box->set_value(tfm::format("%.1g", parameter2Value));
         m_angleBox->set_value(tfm::format("%.1f", m_angleSlider->value() * 180-90));
-        m_parameterSlider->set_enabled(warpType == Beckmann || warpType == MicrofacetBRDF || warpType == UniformSphereCap);
-        m_parameterBox->set_enabled(warpType == Beckmann || warpType == MicrofacetBRDF || warpType == UniformSphereCap);
+        bool hasParameter = warpType == Beckmann || warpType == MicrofacetBRDF ||
+                            warpType == UniformSphereCap || warpType == SphericalTriangle;
+        m_parameterSlider->set_enabled(hasParameter);
+        m_parameterBox->set_enabled(hasParameter);
         m_parameter2Slider->set_enabled(warpType == MicrofacetBRDF);
         m_parameter2Box->set_enabled(warpType == MicrofacetBRDF);
         m_angleBox->set_enabled(warpType == MicrofacetBRDF);
@@ -722,7 +751,7 @@ public:
         m_pointTypeBox->set_callback([&](int) { refresh(); });
 
         new Label(m_window, "Warping method", "sans-bold");
-        m_warpTypeBox = new ComboBox(m_window, { "Square", "Disk", "Sphere", "Spherical cap", "Hemisphere (unif.)",
+        m_warpTypeBox = new ComboBox(m_window, { "Square", "Disk", "Sphere", "Spherical cap", "Spherical triangle", "Hemisphere (unif.)",
                 "Hemisphere (cos)", "Beckmann distr.", "Microfacet BRDF" });
         m_warpTypeBox->set_callback([&](int) { refresh(); });
 